@@ -1,12 +1,11 @@
 #include "AirQualityService.h"
 
-#include <HTTPClient.h>
 #include <ArduinoJson.h>
 
-bool AirQualityService::fetchAirQuality(const Config& config, AirQualityData &data) {
-  Serial.println("AirQualityService: Fetching Air Quality data from Open-Meteo..."); 
-  HTTPClient http;
+AirQualityService::AirQualityService(HttpConnectionPool& pool) : pool(pool) {}
 
+bool AirQualityService::fetchAirQuality(const Config& config, AirQualityData &data, uint16_t timeoutMs) {
+  Serial.println("AirQualityService: Fetching Air Quality data from Open-Meteo..."); 
   String typeParam = (config.aqi_type == "EU") ? "european_aqi" : "us_aqi";
   
   String url = String(AIR_QUALITY_API_URL) + "?latitude=" + String(config.latitude, 4) + 
@@ -14,15 +13,19 @@ bool AirQualityService::fetchAirQuality(const Config& config, AirQualityData &da
                "&current=pm2_5,pm10,nitrogen_dioxide," + typeParam;
   
   Serial.println("AirQualityService: Requesting Air Quality data from: " + url); 
-  http.setReuse(false); 
-  http.begin(url);
-  http.setTimeout(10000); 
-  int httpCode = http.GET();
+  int httpCode;
+  HTTPClient& http = pool.get(url, timeoutMs, httpCode);
 
   if (httpCode == 200) {
-    String payload = http.getString();
-    DynamicJsonDocument doc(1024);
-    DeserializationError error = deserializeJson(doc, payload);
+    StaticJsonDocument<128> filter;
+    JsonObject fields = filter.createNestedObject("current");
+    fields["pm2_5"] = true;
+    fields["pm10"] = true;
+    fields["nitrogen_dioxide"] = true;
+    fields[typeParam] = true;
+
+    StaticJsonDocument<256> doc;
+    DeserializationError error = deserializeJson(doc, pool.body(http), DeserializationOption::Filter(filter));
     
     if (!error) {
       JsonObject current = doc["current"];
@@ -31,12 +34,13 @@ bool AirQualityService::fetchAirQuality(const Config& config, AirQualityData &da
       data.pm10 = current["pm10"].as<float>();
       data.no2 = current["nitrogen_dioxide"].as<float>();
       data.status = getAQIDescription(data.aqi, config.aqi_type == "EU");
+      data.version++;
       
       Serial.printf("AirQualityService: Success! %s AQI: %d (%s), PM2.5: %.1f, PM10: %.1f, NO2: %.1f\n", 
                     config.aqi_type.c_str(), data.aqi, data.status.c_str(), 
                     data.pm25, data.pm10, data.no2);
                     
-      http.end();
+      pool.release(http);
       return true;
     } else {
       Serial.printf("AirQualityService: JSON parsing failed: %s\n", error.c_str());
@@ -45,7 +49,7 @@ bool AirQualityService::fetchAirQuality(const Config& config, AirQualityData &da
     Serial.printf("AirQualityService: API failed, HTTP Code: %d\n", httpCode);
   }
   
-  http.end();
+  pool.release(http);
   return false;
 }
 
@@ -2,12 +2,15 @@
 #define AIR_QUALITY_SERVICE_H
 
 #include "structs.h"
+#include "HttpConnectionPool.h"
 
 class AirQualityService {
 public:
-  bool fetchAirQuality(const Config& config, AirQualityData &data);
+  AirQualityService(HttpConnectionPool& pool);
+  bool fetchAirQuality(const Config& config, AirQualityData &data, uint16_t timeoutMs = 10000);
 
 private:
+  HttpConnectionPool& pool;
   const char* AIR_QUALITY_API_URL = "https://air-quality-api.open-meteo.com/v1/air-quality";
 
   String getAQIDescription(int aqi, bool is_eu);
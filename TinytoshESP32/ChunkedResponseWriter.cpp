@@ -0,0 +1,51 @@
+#include "ChunkedResponseWriter.h"
+
+ChunkedResponseWriter::ChunkedResponseWriter(httpd_req_t* req, const char* contentType) : req(req) {
+    httpd_resp_set_type(req, contentType);
+}
+
+ChunkedResponseWriter::~ChunkedResponseWriter() {
+    finish();
+}
+
+void ChunkedResponseWriter::sendBuffer() {
+    if (used == 0) return;
+    if (!failed && httpd_resp_send_chunk(req, buffer, used) != ESP_OK) failed = true;
+    used = 0;
+}
+
+size_t ChunkedResponseWriter::write(uint8_t c) {
+    if (used == CHUNK_SIZE) sendBuffer();
+    buffer[used++] = (char)c;
+    return 1;
+}
+
+size_t ChunkedResponseWriter::write(const uint8_t* data, size_t len) {
+    size_t remaining = len;
+    while (remaining > 0) {
+        if (used == CHUNK_SIZE) sendBuffer();
+        size_t n = min(remaining, CHUNK_SIZE - used);
+        memcpy(buffer + used, data, n);
+        used += n;
+        data += n;
+        remaining -= n;
+    }
+    return len;
+}
+
+ChunkedResponseWriter& ChunkedResponseWriter::operator+=(const char* text) {
+    write((const uint8_t*)text, strlen(text));
+    return *this;
+}
+
+ChunkedResponseWriter& ChunkedResponseWriter::operator+=(const String& text) {
+    write((const uint8_t*)text.c_str(), text.length());
+    return *this;
+}
+
+void ChunkedResponseWriter::finish() {
+    if (finished) return;
+    sendBuffer();
+    if (!failed) httpd_resp_send_chunk(req, nullptr, 0);
+    finished = true;
+}
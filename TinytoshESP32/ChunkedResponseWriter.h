@@ -0,0 +1,38 @@
+#ifndef CHUNKED_RESPONSE_WRITER_H
+#define CHUNKED_RESPONSE_WRITER_H
+
+#include <Arduino.h>
+#include <esp_http_server.h>
+
+// Streams a response body as HTTP chunks. Appends are copied into a single
+// segment-sized buffer that is sent whenever it fills, so a page of any size
+// costs one fixed buffer instead of a heap String holding the whole body.
+class ChunkedResponseWriter : public Print {
+public:
+    ChunkedResponseWriter(httpd_req_t* req, const char* contentType);
+    ~ChunkedResponseWriter();
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t len) override;
+    using Print::write;
+
+    ChunkedResponseWriter& operator+=(const char* text);
+    ChunkedResponseWriter& operator+=(const String& text);
+
+    // Sends the buffered tail and the terminating empty chunk
+    void finish();
+
+private:
+    // One TCP segment's worth of payload after the chunk-size line
+    static const size_t CHUNK_SIZE = 1400;
+
+    httpd_req_t* req;
+    char buffer[CHUNK_SIZE];
+    size_t used = 0;
+    bool finished = false;
+    bool failed = false;    // client went away; the rest of the page is discarded
+
+    void sendBuffer();
+};
+
+#endif
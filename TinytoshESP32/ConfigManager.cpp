@@ -1,11 +1,201 @@
 #include "ConfigManager.h"
+#include "ConfigSchema.h"
 #include <Arduino.h>
 
+// Record layout: magic "TTCF", schema version (u16), payload length (u16),
+// CRC-32 of the payload (u32), then the payload. The payload is the fields in
+// CONFIG_FIELDS order (ConfigSchema.h), little-endian, strings as a length byte plus bytes.
+static const uint32_t RECORD_MAGIC = 0x46435454;
+static const size_t HEADER_SIZE = 12;
+static const char* RECORD_KEY = "cfg";
+
+// Keys of the per-setting layout used before the single record
+static const char* LEGACY_KEYS[] = {
+  "auto_detect", "latitude", "longitude", "timezone", "city", "time_format", "date_display", "refresh_min",
+  "auto_cycle", "scr_int", "scr_order", "show_time", "show_weather", "show_aqi", "show_stock", "show_crypto",
+  "show_curr", "show_pc", "show_media", "hide_pc", "hide_media", "pc_multi", "pc_view", "round_temps",
+  "temp_unit", "aqi_type", "crypto_id", "cur_base", "cur_targ", "cur_m", "stock_sym", "crypto_fn",
+  "crypto_chart", "cur_fn", "stock_fn", "stock_chart", "anim_mask", "night_mode", "night_start", "night_end",
+  "night_action"
+};
+
+static uint32_t crc32(const uint8_t* data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+static void writeU16(uint8_t* p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+static void writeU32(uint8_t* p, uint32_t v) { for (int i = 0; i < 4; i++) p[i] = v >> (8 * i); }
+static uint16_t readU16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+static uint32_t readU32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+class RecordWriter {
+public:
+  RecordWriter(uint8_t* buffer, size_t capacity) : buf(buffer), cap(capacity) {}
+
+  void field(bool v) { put((uint32_t)v, 1); }
+  void field(int v) { put((uint32_t)v, 4); }
+  void field(unsigned long v) { put((uint32_t)v, 4); }
+  void field(uint16_t v) { put(v, 2); }
+  void field(float v) { uint32_t bits; memcpy(&bits, &v, 4); put(bits, 4); }
+  void field(const String& v) {
+    size_t n = v.length() > 255 ? 255 : v.length();
+    put(n, 1);
+    if (!reserve(n)) return;
+    memcpy(buf + length, v.c_str(), n);
+    length += n;
+  }
+  template <size_t N>
+  void field(const int (&v)[N]) {
+    put(N, 1);
+    for (size_t i = 0; i < N; i++) field(v[i]);
+  }
+
+  size_t length = 0;
+  bool overflow = false;
+
+private:
+  uint8_t* buf;
+  size_t cap;
+
+  bool reserve(size_t n) {
+    if (length + n > cap) overflow = true;
+    return !overflow;
+  }
+  void put(uint32_t v, size_t n) {
+    if (!reserve(n)) return;
+    for (size_t i = 0; i < n; i++) buf[length++] = v >> (8 * i);
+  }
+};
+
+// Fields past the end of the payload (added by a newer schema than the one
+// that wrote it) keep their current value
+class RecordReader {
+public:
+  RecordReader(const uint8_t* data, size_t length) : data(data), end(length) {}
+
+  void field(bool& v) { uint32_t x; if (get(x, 1)) v = x != 0; }
+  void field(int& v) { uint32_t x; if (get(x, 4)) v = (int32_t)x; }
+  void field(unsigned long& v) { uint32_t x; if (get(x, 4)) v = x; }
+  void field(uint16_t& v) { uint32_t x; if (get(x, 2)) v = x; }
+  void field(float& v) { uint32_t x; if (get(x, 4)) memcpy(&v, &x, 4); }
+  void field(String& v) {
+    uint32_t n;
+    if (!get(n, 1) || pos + n > end) {
+      pos = end;
+      return;
+    }
+    char text[256];
+    memcpy(text, data + pos, n);
+    text[n] = '\0';
+    v = text;
+    pos += n;
+  }
+  template <size_t N>
+  void field(int (&v)[N]) {
+    uint32_t n;
+    if (!get(n, 1)) return;
+    // A different count means the screen list changed; keep the default order
+    int values[N];
+    for (uint32_t i = 0; i < n; i++) {
+      int x = 0;
+      field(x);
+      if (i < N) values[i] = x;
+    }
+    if (n == N) memcpy(v, values, sizeof(values));
+  }
+
+private:
+  const uint8_t* data;
+  size_t end;
+  size_t pos = 0;
+
+  bool get(uint32_t& v, size_t n) {
+    if (pos + n > end) {
+      pos = end;
+      return false;
+    }
+    v = 0;
+    for (size_t i = 0; i < n; i++) v |= (uint32_t)data[pos++] << (8 * i);
+    return true;
+  }
+};
+
 ConfigManager::ConfigManager(const char* ns) : PREF_NAMESPACE(ns) {}
 
+size_t ConfigManager::encode(const Config& config, uint8_t* record) {
+  RecordWriter writer(record + HEADER_SIZE, MAX_RECORD_SIZE - HEADER_SIZE);
+  ConfigSchema::visit(writer, config);
+  if (writer.overflow) return 0;
+
+  writeU32(record, RECORD_MAGIC);
+  writeU16(record + 4, SCHEMA_VERSION);
+  writeU16(record + 6, writer.length);
+  writeU32(record + 8, crc32(record + HEADER_SIZE, writer.length));
+  return HEADER_SIZE + writer.length;
+}
+
+bool ConfigManager::decode(const uint8_t* record, size_t length, Config& config) {
+  if (length < HEADER_SIZE || readU32(record) != RECORD_MAGIC) return false;
+
+  uint16_t version = readU16(record + 4);
+  size_t payloadLength = readU16(record + 6);
+  if (HEADER_SIZE + payloadLength != length) return false;
+  if (crc32(record + HEADER_SIZE, payloadLength) != readU32(record + 8)) {
+    Serial.println("ConfigManager: Stored config failed its CRC check.");
+    return false;
+  }
+
+  RecordReader reader(record + HEADER_SIZE, payloadLength);
+  ConfigSchema::visit(reader, config);
+  migrate(version, config);
+  return true;
+}
+
+void ConfigManager::migrate(uint16_t fromVersion, Config& config) {
+  // Appended fields already default through RecordReader; conversions of
+  // existing fields between schema versions go here
+  (void)fromVersion;
+  (void)config;
+}
+
 void ConfigManager::loadConfig(Config& config) {
+  unsigned long start = micros();
   preferences.begin(PREF_NAMESPACE, true);
 
+  bool fromRecord = false;
+  size_t length = preferences.getBytesLength(RECORD_KEY);
+  if (length > 0 && length <= MAX_RECORD_SIZE && preferences.getBytes(RECORD_KEY, stored, length) == length) {
+    fromRecord = decode(stored, length, config);
+  }
+
+  // First boot after the update, or a damaged record: fall back to the
+  // per-key layout, which also supplies the defaults on a fresh device
+  bool hasLegacy = !fromRecord && preferences.isKey("show_time");
+  if (!fromRecord) loadLegacy(config);
+  preferences.end();
+
+  // Compare later saves against what is actually in flash. A record from an
+  // older schema re-encodes differently, so it is rewritten in the current one.
+  storedLength = fromRecord ? length : 0;
+  if (fromRecord) {
+    uint8_t current[MAX_RECORD_SIZE];
+    size_t currentLength = encode(config, current);
+    if (currentLength != length || memcmp(current, stored, length) != 0) storedLength = 0;
+  }
+
+  Serial.printf("ConfigManager: Configuration loaded from %s in %lu us.\n",
+                fromRecord ? "record" : (hasLegacy ? "legacy keys" : "defaults"), micros() - start);
+
+  if (storedLength == 0) saveConfig(config);
+  if (hasLegacy && storedLength > 0) removeLegacyKeys();
+}
+
+void ConfigManager::loadLegacy(Config& config) {
   // Global Settings
   config.auto_detect = preferences.getBool("auto_detect", true);
   config.latitude = preferences.getFloat("latitude", 0.0);
@@ -37,6 +227,8 @@ void ConfigManager::loadConfig(Config& config) {
 
   config.hide_empty_pc = preferences.getBool("hide_pc", true);
   config.hide_empty_media = preferences.getBool("hide_media", true);
+  config.pc_multi = preferences.getInt("pc_multi", 0);
+  config.pc_view = preferences.getInt("pc_view", 0);
 
   // Weather & AQI Settings
   config.round_temps = preferences.getBool("round_temps", true);
@@ -50,8 +242,10 @@ void ConfigManager::loadConfig(Config& config) {
   config.currency_multiplier = preferences.getInt("cur_m", 1);
   config.stock_symbol = preferences.getString("stock_sym", "GOOG");
   config.crypto_fn = preferences.getBool("crypto_fn", true);
+  config.crypto_chart = preferences.getBool("crypto_chart", false);
   config.currency_fn = preferences.getBool("cur_fn", true);
   config.stock_fn = preferences.getBool("stock_fn", true);
+  config.stock_chart = preferences.getBool("stock_chart", false);
 
   // Animation Settings
   config.anim_mask = preferences.getUShort("anim_mask", 62);
@@ -61,73 +255,52 @@ void ConfigManager::loadConfig(Config& config) {
   config.night_start = preferences.getString("night_start", "22:00");
   config.night_end = preferences.getString("night_end", "06:00");
   config.night_action = preferences.getInt("night_action", 1);
+}
 
+void ConfigManager::removeLegacyKeys() {
+  preferences.begin(PREF_NAMESPACE, false);
+  for (const char* key : LEGACY_KEYS) preferences.remove(key);
   preferences.end();
-  Serial.println("ConfigManager: Configuration loaded from NVS.");
+  Serial.println("ConfigManager: Migrated legacy settings to the config record.");
 }
 
 void ConfigManager::saveConfig(const Config& config) {
-  Serial.println("ConfigManager: Saving config to NVS...");
-  preferences.begin(PREF_NAMESPACE, false);
-
-  // Global Settings
-  preferences.putBool("auto_detect", config.auto_detect);
-  preferences.putFloat("latitude", config.latitude);
-  preferences.putFloat("longitude", config.longitude);
-  preferences.putString("timezone", config.timezone);
-  preferences.putString("city", config.city);
-  preferences.putString("time_format", config.time_format);
-  preferences.putBool("date_display", config.date_display);
-  preferences.putULong("refresh_min", config.refresh_interval_min);
-
-  // Screens Settings
-  preferences.putBool("auto_cycle", config.screen_auto_cycle);
-  preferences.putInt("scr_int", config.screen_interval_sec);
-  preferences.putBytes("scr_order", config.screen_order, sizeof(config.screen_order));
-
-  preferences.putBool("show_time", config.show_time);
-  preferences.putBool("show_weather", config.show_weather);
-  preferences.putBool("show_aqi", config.show_aqi);
-  preferences.putBool("show_stock", config.show_stock);
-  preferences.putBool("show_crypto", config.show_crypto);
-  preferences.putBool("show_curr", config.show_currency);
-  preferences.putBool("show_pc", config.show_pc);
-  preferences.putBool("show_media", config.show_media);
-
-  preferences.putBool("hide_pc", config.hide_empty_pc);
-  preferences.putBool("hide_media", config.hide_empty_media);
-
-  // Weather & AQI Settings
-  preferences.putBool("round_temps", config.round_temps);
-  preferences.putString("temp_unit", config.temp_unit);
-  preferences.putString("aqi_type", config.aqi_type);
+  uint8_t record[MAX_RECORD_SIZE];
+  size_t length = encode(config, record);
+  if (length == 0) {
+    Serial.println("ConfigManager: Config does not fit the record, not saved.");
+    return;
+  }
 
-  // Crypto, Currency & Stock Settings
-  preferences.putInt("crypto_id", config.crypto_id);
-  preferences.putString("cur_base", config.currency_base);
-  preferences.putString("cur_targ", config.currency_target);
-  preferences.putInt("cur_m", config.currency_multiplier);
-  preferences.putString("stock_sym", config.stock_symbol);
-  preferences.putBool("crypto_fn", config.crypto_fn);
-  preferences.putBool("cur_fn", config.currency_fn);
-  preferences.putBool("stock_fn", config.stock_fn);
+  // Most callers save after every refresh or button press; only real changes reach flash
+  if (length == storedLength && memcmp(record, stored, length) == 0) {
+    skippedWrites++;
+    Serial.printf("ConfigManager: Config unchanged, write skipped (%lu skipped so far).\n", (unsigned long)skippedWrites);
+    return;
+  }
 
-  // Animation Settings
-  preferences.putUShort("anim_mask", config.anim_mask);
+  unsigned long start = micros();
+  preferences.begin(PREF_NAMESPACE, false);
+  size_t written = preferences.putBytes(RECORD_KEY, record, length);
+  preferences.end();
 
-  // Night Mode Settings
-  preferences.putBool("night_mode", config.night_mode);
-  preferences.putString("night_start", config.night_start);
-  preferences.putString("night_end", config.night_end);
-  preferences.putInt("night_action", config.night_action);
+  if (written != length) {
+    storedLength = 0;
+    Serial.println("ConfigManager: Failed to write config record.");
+    return;
+  }
 
-  preferences.end();
-  Serial.println("ConfigManager: Config saved.");
+  memcpy(stored, record, length);
+  storedLength = length;
+  flashWrites++;
+  Serial.printf("ConfigManager: Config saved, %u bytes in %lu us (%lu writes since boot).\n",
+                (unsigned)length, micros() - start, (unsigned long)flashWrites);
 }
 
 void ConfigManager::clearAllPreferences() {
   preferences.begin(PREF_NAMESPACE, false);
   preferences.clear();
   preferences.end();
+  storedLength = 0;
   Serial.println("Preferences cleared!");
 }
\ No newline at end of file
@@ -4,6 +4,10 @@
 #include "structs.h"
 #include <Preferences.h>
 
+// Persists Config as a single versioned, CRC-checked record under one NVS
+// key. Settings stored by older firmware as one key each are migrated on the
+// first boot. saveConfig() skips the flash write when the encoded record
+// matches what is already stored.
 class ConfigManager {
 public:
     ConfigManager(const char* ns);
@@ -12,8 +16,23 @@ public:
     void clearAllPreferences();
 
 private:
+    static const uint16_t SCHEMA_VERSION = 1;
+    static const size_t MAX_RECORD_SIZE = 768;
+
     const char* PREF_NAMESPACE;
     Preferences preferences;
+
+    // Copy of the record in flash; storedLength is 0 when unknown
+    uint8_t stored[MAX_RECORD_SIZE];
+    size_t storedLength = 0;
+    uint32_t flashWrites = 0;
+    uint32_t skippedWrites = 0;
+
+    static size_t encode(const Config& config, uint8_t* record);
+    static bool decode(const uint8_t* record, size_t length, Config& config);
+    static void migrate(uint16_t fromVersion, Config& config);
+    void loadLegacy(Config& config);
+    void removeLegacyKeys();
 };
 
 #endif
\ No newline at end of file
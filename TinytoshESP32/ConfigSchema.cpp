@@ -0,0 +1,206 @@
+#include "ConfigSchema.h"
+#include <type_traits>
+
+enum ConfigKind { KIND_BOOL, KIND_INT, KIND_ULONG, KIND_U16, KIND_FLOAT, KIND_STRING, KIND_ORDER };
+enum ConfigForm { FORM_CHECKBOX, FORM_VALUE };
+
+template <ConfigKind K> struct KindType;
+template <> struct KindType<KIND_BOOL> { typedef bool type; };
+template <> struct KindType<KIND_INT> { typedef int type; };
+template <> struct KindType<KIND_ULONG> { typedef unsigned long type; };
+template <> struct KindType<KIND_U16> { typedef uint16_t type; };
+template <> struct KindType<KIND_FLOAT> { typedef float type; };
+template <> struct KindType<KIND_STRING> { typedef String type; };
+template <> struct KindType<KIND_ORDER> { typedef int type[NUM_SCREENS]; };
+
+// A kind that doesn't match the member's type would corrupt it through fieldPtr()
+#define CONFIG_FIELD_CHECK(kind, member, key, form, gate) \
+    static_assert(std::is_same<decltype(Config::member), KindType<KIND_##kind>::type>::value, "Config::" #member " is not " #kind);
+CONFIG_FIELDS(CONFIG_FIELD_CHECK)
+#undef CONFIG_FIELD_CHECK
+
+struct FieldInfo {
+    const char* key;
+    ConfigKind kind;
+    ConfigForm form;
+};
+
+static constexpr FieldInfo FIELDS[] = {
+#define CONFIG_FIELD_INFO(kind, member, key, form, gate) { key, KIND_##kind, FORM_##form },
+    CONFIG_FIELDS(CONFIG_FIELD_INFO)
+#undef CONFIG_FIELD_INFO
+};
+
+static void* fieldPtr(Config& c, int field) {
+    switch (field) {
+#define CONFIG_FIELD_PTR(kind, member, key, form, gate) case ConfigSchema::FIELD_##member: return &c.member;
+        CONFIG_FIELDS(CONFIG_FIELD_PTR)
+#undef CONFIG_FIELD_PTR
+        default: return nullptr;
+    }
+}
+
+static const void* fieldPtr(const Config& c, int field) {
+    return fieldPtr(const_cast<Config&>(c), field);
+}
+
+static bool gateOpen(const Config& c, int field) {
+    switch (field) {
+#define CONFIG_FIELD_GATE(kind, member, key, form, gate) case ConfigSchema::FIELD_##member: return (gate);
+        CONFIG_FIELDS(CONFIG_FIELD_GATE)
+#undef CONFIG_FIELD_GATE
+        default: return false;
+    }
+}
+
+// Perfect hash over the keys: a seeded FNV-1a whose seed is searched at
+// compile time so that every key lands in its own slot of HASH_SLOTS.
+static const int HASH_SLOTS = 128;
+static const uint32_t NO_SEED = 0xFFFFFFFF;
+static_assert(ConfigSchema::NUM_FIELDS < HASH_SLOTS / 2, "Grow HASH_SLOTS with the schema");
+
+static constexpr size_t keyLength(const char* key) {
+    size_t n = 0;
+    while (key[n]) n++;
+    return n;
+}
+
+static constexpr uint32_t keySlot(uint32_t seed, const char* key, size_t length) {
+    uint32_t h = 2166136261u ^ seed;
+    for (size_t i = 0; i < length; i++) {
+        h ^= (uint8_t)key[i];
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    return h % HASH_SLOTS;
+}
+
+static constexpr uint32_t findSeed() {
+    for (uint32_t seed = 0; seed < 4096; seed++) {
+        bool used[HASH_SLOTS] = {};
+        bool ok = true;
+        for (int f = 0; f < ConfigSchema::NUM_FIELDS && ok; f++) {
+            uint32_t slot = keySlot(seed, FIELDS[f].key, keyLength(FIELDS[f].key));
+            ok = !used[slot];
+            used[slot] = true;
+        }
+        if (ok) return seed;
+    }
+    return NO_SEED;
+}
+
+struct SlotTable {
+    uint8_t slots[HASH_SLOTS];      // field index + 1, 0 for an empty slot
+};
+
+static constexpr uint32_t HASH_SEED = findSeed();
+static_assert(HASH_SEED != NO_SEED, "No collision-free seed for the config keys; grow HASH_SLOTS");
+
+static constexpr SlotTable buildSlots() {
+    SlotTable table = {};
+    for (int f = 0; f < ConfigSchema::NUM_FIELDS; f++) {
+        table.slots[keySlot(HASH_SEED, FIELDS[f].key, keyLength(FIELDS[f].key))] = f + 1;
+    }
+    return table;
+}
+
+static constexpr SlotTable SLOTS = buildSlots();
+
+int ConfigSchema::find(const char* key, size_t length) {
+    int field = SLOTS.slots[keySlot(HASH_SEED, key, length)] - 1;
+    if (field < 0) return -1;
+    const char* name = FIELDS[field].key;
+    return strncmp(name, key, length) == 0 && name[length] == '\0' ? field : -1;
+}
+
+void ConfigSchema::toJson(const Config& config, JsonDocument& doc) {
+    for (int f = 0; f < NUM_FIELDS; f++) {
+        const void* p = fieldPtr(config, f);
+        const char* key = FIELDS[f].key;
+        switch (FIELDS[f].kind) {
+            case KIND_BOOL:   doc[key] = *(const bool*)p ? 1 : 0; break;
+            case KIND_INT:    doc[key] = *(const int*)p; break;
+            case KIND_ULONG:  doc[key] = *(const unsigned long*)p; break;
+            case KIND_U16:    doc[key] = *(const uint16_t*)p; break;
+            case KIND_FLOAT:  doc[key] = *(const float*)p; break;
+            case KIND_STRING: doc[key] = *(const String*)p; break;
+            case KIND_ORDER:  doc[key] = formatScreenOrder((const int*)p); break;
+        }
+    }
+}
+
+void ConfigSchema::fromJson(Config& config, int field, JsonVariantConst value) {
+    void* p = fieldPtr(config, field);
+    if (p == nullptr) return;
+    switch (FIELDS[field].kind) {
+        case KIND_BOOL:   *(bool*)p = value.is<bool>() ? value.as<bool>() : value.as<int>() == 1; break;
+        case KIND_INT:    *(int*)p = value.as<int>(); break;
+        case KIND_ULONG:  *(unsigned long*)p = value.as<unsigned long>(); break;
+        case KIND_U16:    *(uint16_t*)p = value.as<uint16_t>(); break;
+        case KIND_FLOAT:  *(float*)p = value.as<float>(); break;
+        case KIND_STRING: *(String*)p = value.as<String>(); break;
+        case KIND_ORDER:  parseScreenOrder(value.as<String>().c_str(), (int*)p); break;
+    }
+}
+
+void ConfigSchema::applyFormValue(Config& config, int field, const char* text) {
+    void* p = fieldPtr(config, field);
+    if (p == nullptr) return;
+    switch (FIELDS[field].kind) {
+        case KIND_BOOL:   *(bool*)p = true; break;     // a checkbox is only submitted when ticked
+        case KIND_INT:    *(int*)p = atoi(text); break;
+        case KIND_ULONG:  *(unsigned long*)p = atol(text); break;
+        case KIND_U16:    *(uint16_t*)p = atoi(text); break;
+        case KIND_FLOAT:  *(float*)p = atof(text); break;
+        case KIND_STRING: *(String*)p = text; break;
+        case KIND_ORDER:  parseScreenOrder(text, (int*)p); break;
+    }
+}
+
+template <typename T>
+static void assign(T& to, const T& from) { to = from; }
+
+template <typename T, size_t N>
+static void assign(T (&to)[N], const T (&from)[N]) {
+    for (size_t i = 0; i < N; i++) to[i] = from[i];
+}
+
+static void copyField(Config& to, const Config& from, int field) {
+    switch (field) {
+#define CONFIG_FIELD_COPY(kind, member, key, form, gate) \
+        case ConfigSchema::FIELD_##member: assign(to.member, from.member); break;
+        CONFIG_FIELDS(CONFIG_FIELD_COPY)
+#undef CONFIG_FIELD_COPY
+    }
+}
+
+void ConfigSchema::finishForm(const Config& before, Config& after, const bool* submitted) {
+    for (int f = 0; f < NUM_FIELDS; f++) {
+        if (!gateOpen(after, f)) {
+            // The input sits in a disabled screen's panel; keep what was there
+            copyField(after, before, f);
+        } else if (FIELDS[f].form == FORM_CHECKBOX && !submitted[f]) {
+            *(bool*)fieldPtr(after, f) = false;
+        }
+    }
+}
+
+void ConfigSchema::parseScreenOrder(const char* text, int* order) {
+    int idx = 0;
+    const char* p = text;
+    while (*p && idx < NUM_SCREENS) {
+        order[idx++] = atoi(p);
+        const char* comma = strchr(p, ',');
+        if (comma == nullptr) break;
+        p = comma + 1;
+    }
+}
+
+String ConfigSchema::formatScreenOrder(const int* order) {
+    String text;
+    for (int i = 0; i < NUM_SCREENS; i++) {
+        if (i) text += ",";
+        text += String(order[i]);
+    }
+    return text;
+}
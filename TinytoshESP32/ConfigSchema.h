@@ -0,0 +1,101 @@
+#ifndef CONFIG_SCHEMA_H
+#define CONFIG_SCHEMA_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "structs.h"
+
+// Every persisted setting, one line each:
+//
+//     X(kind, member, key, form, gate)
+//
+//   kind    storage type: BOOL, INT, ULONG, U16, FLOAT, STRING or ORDER (screen_order)
+//   member  Config field
+//   key     name in the JSON state, the USB config payload and the web form
+//   form    CHECKBOX (missing from the form means off) or VALUE (missing means unchanged)
+//   gate    the web form only changes the field while this holds for the submitted
+//           config `c`, e.g. while the screen whose panel holds the input is enabled
+//
+// NVS load/save, the JSON state, the USB config payload and the web form are
+// all generated from this list. The order is the layout of the NVS record:
+// only append, and bump ConfigManager::SCHEMA_VERSION when doing so.
+#define CONFIG_FIELDS(X) \
+    X(BOOL,   auto_detect,          "auto_detect",         CHECKBOX, true) \
+    X(FLOAT,  latitude,             "latitude",            VALUE,    !c.auto_detect) \
+    X(FLOAT,  longitude,            "longitude",           VALUE,    !c.auto_detect) \
+    X(STRING, timezone,             "timezone",            VALUE,    !c.auto_detect) \
+    X(STRING, city,                 "city",                VALUE,    !c.auto_detect) \
+    X(STRING, time_format,          "time_format",         VALUE,    true) \
+    X(BOOL,   date_display,         "date_display",        CHECKBOX, c.show_time) \
+    X(ULONG,  refresh_interval_min, "refresh_min",         VALUE,    true) \
+    X(BOOL,   screen_auto_cycle,    "auto_cycle",          CHECKBOX, true) \
+    X(INT,    screen_interval_sec,  "screen_int",          VALUE,    true) \
+    X(ORDER,  screen_order,         "screen_order",        VALUE,    true) \
+    X(BOOL,   show_time,            "show_time",           CHECKBOX, true) \
+    X(BOOL,   show_weather,         "show_weather",        CHECKBOX, true) \
+    X(BOOL,   show_aqi,             "show_aqi",            CHECKBOX, true) \
+    X(BOOL,   show_stock,           "show_stock",          CHECKBOX, true) \
+    X(BOOL,   show_crypto,          "show_crypto",         CHECKBOX, true) \
+    X(BOOL,   show_currency,        "show_currency",       CHECKBOX, true) \
+    X(BOOL,   show_pc,              "show_pc",             CHECKBOX, true) \
+    X(BOOL,   show_media,           "show_media",          CHECKBOX, true) \
+    X(BOOL,   hide_empty_pc,        "hide_empty_pc",       CHECKBOX, true) \
+    X(BOOL,   hide_empty_media,     "hide_empty_media",    CHECKBOX, true) \
+    X(INT,    pc_multi,             "pc_multi",            VALUE,    true) \
+    X(INT,    pc_view,              "pc_view",             VALUE,    true) \
+    X(BOOL,   round_temps,          "round_temps",         CHECKBOX, c.show_weather) \
+    X(STRING, temp_unit,            "temp_unit",           VALUE,    true) \
+    X(STRING, aqi_type,             "aqi_type",            VALUE,    true) \
+    X(INT,    crypto_id,            "crypto_id",           VALUE,    true) \
+    X(STRING, currency_base,        "currency_base",       VALUE,    true) \
+    X(STRING, currency_target,      "currency_target",     VALUE,    true) \
+    X(INT,    currency_multiplier,  "currency_multiplier", VALUE,    true) \
+    X(STRING, stock_symbol,         "stock_symbol",        VALUE,    true) \
+    X(BOOL,   crypto_fn,            "crypto_fn",           CHECKBOX, c.show_crypto) \
+    X(BOOL,   crypto_chart,         "crypto_chart",        CHECKBOX, c.show_crypto) \
+    X(BOOL,   currency_fn,          "currency_fn",         CHECKBOX, c.show_currency) \
+    X(BOOL,   stock_fn,             "stock_fn",            CHECKBOX, c.show_stock) \
+    X(BOOL,   stock_chart,          "stock_chart",         CHECKBOX, c.show_stock) \
+    X(U16,    anim_mask,            "anim_mask",           VALUE,    true) \
+    X(BOOL,   night_mode,           "night_mode",          CHECKBOX, true) \
+    X(STRING, night_start,          "night_start",         VALUE,    true) \
+    X(STRING, night_end,            "night_end",           VALUE,    true) \
+    X(INT,    night_action,         "night_action",        VALUE,    true)
+
+class ConfigSchema {
+public:
+    enum Field {
+#define CONFIG_FIELD_ENUM(kind, member, key, form, gate) FIELD_##member,
+        CONFIG_FIELDS(CONFIG_FIELD_ENUM)
+#undef CONFIG_FIELD_ENUM
+        NUM_FIELDS
+    };
+
+    // Index of the field named key, or -1. One hash and one strcmp,
+    // however many settings there are.
+    static int find(const char* key, size_t length);
+    static int find(const char* key) { return find(key, strlen(key)); }
+
+    static void toJson(const Config& config, JsonDocument& doc);
+    // Applies one value from the USB config payload
+    static void fromJson(Config& config, int field, JsonVariantConst value);
+
+    // Web form: applyFormValue() for each submitted field, then finishForm()
+    // turns unsubmitted checkboxes off and restores fields whose gate is closed
+    static void applyFormValue(Config& config, int field, const char* text);
+    static void finishForm(const Config& before, Config& after, const bool* submitted);
+
+    // screen_order travels as "0,1,2,..."
+    static void parseScreenOrder(const char* text, int* order);
+    static String formatScreenOrder(const int* order);
+
+    // Hands every field to codec.field(member), in schema order
+    template <typename Codec, typename ConfigT>
+    static void visit(Codec& codec, ConfigT& config) {
+#define CONFIG_FIELD_VISIT(kind, member, key, form, gate) codec.field(config.member);
+        CONFIG_FIELDS(CONFIG_FIELD_VISIT)
+#undef CONFIG_FIELD_VISIT
+    }
+};
+
+#endif
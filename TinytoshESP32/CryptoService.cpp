@@ -1,36 +1,46 @@
 #include "CryptoService.h"
-#include <HTTPClient.h>
 #include <ArduinoJson.h>
 
-bool CryptoService::fetchPrice(int id, CryptoData &data) {
-    HTTPClient http;
+CryptoService::CryptoService(HttpConnectionPool& pool) : pool(pool) {}
+
+bool CryptoService::fetchPrice(int id, CryptoData &data, uint16_t timeoutMs) {
     String url = String(CRYPTO_API_URL) + "?id=" + String(id);
 
     Serial.printf("CryptoService: Requesting Crypto Data from CoinLore: %d\n", id); 
     Serial.printf("CryptoService: URL: %s\n", url.c_str()); 
-    http.setReuse(false); 
-    http.begin(url);
-    http.setTimeout(10000);
-    int httpCode = http.GET();
+    int httpCode;
+    HTTPClient& http = pool.get(url, timeoutMs, httpCode);
 
     if (httpCode == 200) {
-        String payload = http.getString();
-        StaticJsonDocument<512> doc;
-        DeserializationError error = deserializeJson(doc, payload);
+        StaticJsonDocument<128> filter;
+        JsonObject fields = filter.createNestedObject();
+        fields["name"] = true;
+        fields["symbol"] = true;
+        fields["price_usd"] = true;
+        fields["percent_change_24h"] = true;
+
+        StaticJsonDocument<384> doc;
+        DeserializationError error = deserializeJson(doc, pool.body(http), DeserializationOption::Filter(filter));
 
         if (!error) {
             JsonObject obj = doc[0];
+            String symbol = obj["symbol"].as<String>();
+            if (data.symbol != symbol) data.history.clear();
+
             data.name = obj["name"].as<String>();
-            data.symbol = obj["symbol"].as<String>();
+            data.symbol = symbol;
             data.price_usd = obj["price_usd"].as<float>();
+            // CoinLore has no history endpoint, so the chart is built from our own fetches
+            data.history.push(data.price_usd);
             data.percent_change_24h = obj["percent_change_24h"].as<float>();
             data.updated = true;
+            data.version++;
             
             Serial.printf("CryptoService: Success! %s (%s): $%.2f (24h Change: %.2f%%)\n", 
                           data.name.c_str(), data.symbol.c_str(), 
                           data.price_usd, data.percent_change_24h);
                           
-            http.end();
+            pool.release(http);
             return true;
         } else {
             Serial.printf("CryptoService: JSON parsing failed: %s\n", error.c_str());
@@ -39,6 +49,6 @@ bool CryptoService::fetchPrice(int id, CryptoData &data) {
         Serial.printf("CryptoService: API failed, HTTP Code: %d\n", httpCode);
     }
     
-    http.end();
+    pool.release(http);
     return false;
 }
\ No newline at end of file
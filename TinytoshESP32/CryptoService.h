@@ -2,12 +2,15 @@
 #define CRYPTO_SERVICE_H
 
 #include "structs.h"
+#include "HttpConnectionPool.h"
 
 class CryptoService {
 public:
-    bool fetchPrice(int id, CryptoData &data);
+    CryptoService(HttpConnectionPool& pool);
+    bool fetchPrice(int id, CryptoData &data, uint16_t timeoutMs = 10000);
 
 private:
+    HttpConnectionPool& pool;
     const char* CRYPTO_API_URL = "https://api.coinlore.net/api/ticker/";
 };
 
@@ -1,8 +1,9 @@
 #include "CurrencyService.h"
-#include <HTTPClient.h>
 #include <ArduinoJson.h>
 
-bool CurrencyService::fetchRate(const String& base, const String& target, CurrencyData &data) {
+CurrencyService::CurrencyService(HttpConnectionPool& pool) : pool(pool) {}
+
+bool CurrencyService::fetchRate(const String& base, const String& target, CurrencyData &data, uint16_t timeoutMs) {
     String safeBase = base;
     safeBase.toLowerCase();
     safeBase.trim();
@@ -17,21 +18,16 @@ bool CurrencyService::fetchRate(const String& base, const String& target, Curren
         String url = String(CURRENCY_API_URLS[i]) + safeBase + ".min.json";
         Serial.printf("CurrencyService: Attempt %d - URL: %s\n", i + 1, url.c_str()); 
 
-        HTTPClient http;
-        http.setReuse(false); 
-        http.begin(url);
-        http.setTimeout(10000); 
-        int httpCode = http.GET();
+        int httpCode;
+        HTTPClient& http = pool.get(url, timeoutMs, httpCode);
 
         if (httpCode == 200) {
-            String payload = http.getString();
-
-            DynamicJsonDocument filter(256);
+            StaticJsonDocument<128> filter;
             filter["date"] = true;
             filter[safeBase.c_str()][safeTarget.c_str()] = true; 
 
-            DynamicJsonDocument doc(1024);
-            DeserializationError error = deserializeJson(doc, payload, DeserializationOption::Filter(filter));
+            StaticJsonDocument<192> doc;
+            DeserializationError error = deserializeJson(doc, pool.body(http), DeserializationOption::Filter(filter));
 
             if (!error && doc.containsKey("date") && doc.containsKey(safeBase)) {
                 data.base = safeBase;
@@ -42,10 +38,11 @@ bool CurrencyService::fetchRate(const String& base, const String& target, Curren
                 data.date = doc["date"].as<String>();
                 data.rate = doc[safeBase][safeTarget].as<float>();
                 data.updated = true;
+                data.version++;
                 
                 Serial.printf("CurrencyService: Success! %s -> %s = %.6f (Date: %s)\n", 
                               data.base.c_str(), data.target.c_str(), data.rate, data.date.c_str());
-                http.end();
+                pool.release(http);
                 return true; 
             } else {
                 Serial.println("CurrencyService: JSON parse failed or missing keys on this endpoint.");
@@ -54,7 +51,7 @@ bool CurrencyService::fetchRate(const String& base, const String& target, Curren
             Serial.printf("CurrencyService: API failed, HTTP Code: %d\n", httpCode);
         }
         
-        http.end();
+        pool.release(http);
 
         if (i == 0) {
             Serial.println("CurrencyService: Primary API failed. Switching to fallback...");
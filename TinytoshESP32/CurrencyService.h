@@ -2,12 +2,15 @@
 #define CURRENCY_SERVICE_H
 
 #include "structs.h"
+#include "HttpConnectionPool.h"
 
 class CurrencyService {
 public:
-    bool fetchRate(const String& base, const String& target, CurrencyData &data);
+    CurrencyService(HttpConnectionPool& pool);
+    bool fetchRate(const String& base, const String& target, CurrencyData &data, uint16_t timeoutMs = 10000);
 
 private:
+    HttpConnectionPool& pool;
     const char* CURRENCY_API_URLS[2] = {
         "https://cdn.jsdelivr.net/npm/@fawazahmed0/currency-api@latest/v1/currencies/",
         "https://latest.currency-api.pages.dev/v1/currencies/"
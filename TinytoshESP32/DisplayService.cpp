@@ -1,8 +1,20 @@
 #include "DisplayService.h"
 #include "images.h"
+#include "PageChart.h"
 #include <Arduino.h>
 #include <Fonts/Picopixel.h>
 
+#if defined(I2C_BUFFER_LENGTH)
+#define OLED_WIRE_MAX min(256, I2C_BUFFER_LENGTH)
+#elif defined(BUFFER_LENGTH)
+#define OLED_WIRE_MAX min(256, BUFFER_LENGTH)
+#else
+#define OLED_WIRE_MAX 32
+#endif
+
+static const uint32_t OLED_I2C_CLOCK = 400000;
+static const uint32_t OLED_I2C_CLOCK_IDLE = 100000;
+
 String DisplayService::getWeatherDescription(int wmo_code) {
     if (wmo_code == 0) return "Clear Sky";
     if (wmo_code >= 1 && wmo_code <= 3) return "Cloudy";
@@ -51,18 +63,128 @@ DisplayService::DisplayService(int width, int height, int reset_pin) :
     display(width, height, &Wire, reset_pin) {}
 
 void DisplayService::begin() {
-    if(!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) { 
+    panelShadowValid = false;
+    shownFingerprintValid = false;
+    lastContrast = -1;
+    if(!display.begin(SSD1306_SWITCHCAPVCC, I2C_ADDRESS)) { 
         Serial.println(F("DisplayService: SSD1306 allocation failed."));
     } else {
         Serial.println("DisplayService: Display initialized.");
         display.clearDisplay();
         display.drawBitmap(0, 0, icon_hello, 128, 64, SSD1306_WHITE);
+        flush();
+    }
+}
+
+void DisplayService::setMetrics(MetricsService* metricsService) {
+    metrics = metricsService;
+}
+
+void DisplayService::flush() {
+    unsigned long start = micros();
+    size_t bytesSent;
+
+    if (!panelShadowValid) {
         display.display();
+        memcpy(panelShadow, display.getBuffer(), FRAME_BUFFER_SIZE);
+        panelShadowValid = true;
+        bytesSent = FRAME_BUFFER_SIZE;
+    } else {
+        bytesSent = flushChangedPages();
+    }
+
+    if (metrics) {
+        uint32_t elapsed = micros() - start;
+        if (activeAnim != ANIM_NONE) metrics->recordAnimationFlush(activeAnim, elapsed);
+        else metrics->recordFlush(flushScreen, elapsed);
+        metrics->recordFlushBytes(bytesSent);
+    }
+}
+
+size_t DisplayService::flushChangedPages() {
+    const uint8_t* buf = display.getBuffer();
+    size_t sent = 0;
+
+    for (int page = 0; page < 8; page++) {
+        const uint8_t* next = &buf[page * 128];
+        uint8_t* shown = &panelShadow[page * 128];
+
+        int first = 0;
+        while (first < 128 && next[first] == shown[first]) first++;
+        if (first == 128) continue;
+
+        int last = 127;
+        while (last > first && next[last] == shown[last]) last--;
+
+        sendPageWindow(page, first, last, &next[first]);
+        memcpy(&shown[first], &next[first], last - first + 1);
+        sent += last - first + 1;
+    }
+    return sent;
+}
+
+void DisplayService::sendPageWindow(uint8_t page, uint8_t colStart, uint8_t colEnd, const uint8_t* data) {
+    Wire.setClock(OLED_I2C_CLOCK);
+
+    Wire.beginTransmission(I2C_ADDRESS);
+    Wire.write((uint8_t)0x00);
+    Wire.write((uint8_t)SSD1306_PAGEADDR);
+    Wire.write(page);
+    Wire.write(page);
+    Wire.write((uint8_t)SSD1306_COLUMNADDR);
+    Wire.write(colStart);
+    Wire.write(colEnd);
+    Wire.endTransmission();
+
+    size_t remaining = colEnd - colStart + 1;
+    while (remaining > 0) {
+        size_t chunk = min((size_t)(OLED_WIRE_MAX - 1), remaining);
+        Wire.beginTransmission(I2C_ADDRESS);
+        Wire.write((uint8_t)0x40);
+        Wire.write(data, chunk);
+        Wire.endTransmission();
+        data += chunk;
+        remaining -= chunk;
+    }
+
+    Wire.setClock(OLED_I2C_CLOCK_IDLE);
+}
+
+void DisplayService::setContrast(uint8_t level) {
+    if (lastContrast == level) return;
+    lastContrast = level;
+
+    display.ssd1306_command(SSD1306_SETCONTRAST);
+    display.ssd1306_command(level);
+}
+
+size_t DisplayService::encodeFramePBM(uint8_t* out, size_t capacity) {
+    // Binary PBM (P4): rows of 16 bytes, MSB first, 1 = lit pixel.
+    if (capacity < FRAME_PBM_SIZE) return 0;
+
+    const char header[] = "P4\n128 64\n";
+    size_t len = sizeof(header) - 1;
+    memcpy(out, header, len);
+
+    const uint8_t* buf = display.getBuffer();
+    for (int y = 0; y < 64; y++) {
+        const uint8_t* page = &buf[(y >> 3) * 128];
+        uint8_t bit = 1 << (y & 7);
+        for (int xByte = 0; xByte < 16; xByte++) {
+            uint8_t packed = 0;
+            for (int i = 0; i < 8; i++) {
+                if (page[xByte * 8 + i] & bit) packed |= 0x80 >> i;
+            }
+            out[len++] = packed;
+        }
     }
+    return len;
 }
 
 void DisplayService::showOLEDStatus(std::initializer_list<String> lines, bool clear) {
     if (clear) display.clearDisplay();
+    flushScreen = MetricsService::SYSTEM_SLOT;
+    invalidateScreen();
 
     display.setTextColor(SSD1306_WHITE);
     display.setTextWrap(false);
@@ -91,7 +213,7 @@ void DisplayService::showOLEDStatus(std::initializer_list<String> lines, bool cl
         if (cursorY >= display.height()) break;
     }
     
-    display.display();
+    flush();
 }
 
 void DisplayService::drawTimeScreen(const Config& config, String timeStr, String dateStr) {
@@ -350,8 +472,11 @@ void DisplayService::drawCryptoScreen(const Config& config, const CryptoData& da
     display.setCursor(4, 6);
     display.print(data.symbol);
 
-    // 2. Full Name
-    if (config.crypto_fn) {
+    // 2. Price chart, or the full name
+    if (config.crypto_chart && data.history.ring.count >= 2) {
+        // Baseline at the price 24 hours ago, which is what the percentage compares against
+        drawPriceChart(data.history, data.price_usd / (1.0f + data.percent_change_24h / 100.0f));
+    } else if (config.crypto_fn) {
         display.setTextSize(1);
         display.setCursor(4, 32); 
         String displayName = data.name;
@@ -446,8 +571,10 @@ void DisplayService::drawStockScreen(const Config& config, const StockData& data
     display.setCursor(4, 6);
     display.print(data.symbol);
 
-    // 2. Company Name
-    if (config.stock_fn) {
+    // 2. Intraday chart, or the company name
+    if (config.stock_chart && data.history.ring.count >= 2) {
+        drawPriceChart(data.history, data.previous_close);
+    } else if (config.stock_fn) {
         display.setTextSize(1);
         display.setCursor(4, 32);
         String displayName = data.name;
@@ -473,9 +600,32 @@ void DisplayService::drawStockScreen(const Config& config, const StockData& data
     display.print(trendPrefix + String(data.percent_change, 1) + "%");
 }
 
-void DisplayService::drawPcScreen(const PcStats& pcStats) {
+void DisplayService::drawPriceChart(const PriceSeries& series, float baseline) {
+    // Fills the name row between the symbol and the price, below the percentage
+    const int CHART_X = 4;
+    const int CHART_Y = 31;
+    const int CHART_W = 120;
+    const int CHART_H = 12;
+
+    uint8_t values[PriceSeries::Ring::LENGTH];
+    int n = series.copyScaled(values, PriceSeries::Ring::LENGTH, CHART_H - 1);
+    uint8_t* buf = display.getBuffer();
+
+    if (!isnan(baseline) && baseline > 0) {
+        int y = CHART_Y + CHART_H - 1 - series.scaledPrice(baseline, CHART_H - 1);
+        PageChart::dottedHLine(buf, CHART_X, CHART_X + CHART_W - 1, y, 3);
+    }
+    PageChart::sparkline(buf, CHART_X, CHART_Y, CHART_H, values, n, CHART_H - 1);
+}
+
+void DisplayService::drawPcScreen(const PcStats& pcStats, const PcHosts& hosts, const PcHistory& history, const Config& config) {
     bool isInvalid = (isnan(pcStats.cpu_percent) || pcStats.cpu_percent == 0) && (isnan(pcStats.mem_percent) || pcStats.mem_percent == 0); 
 
+    // pc_view 1-3 swaps the bars for sparklines of the matching history tier
+    int tier = config.pc_view - 1;
+    bool historyMode = tier >= 0 && tier < PcHistory::NUM_TIERS;
+    if (historyMode && history.rings[tier][PcHistory::CPU].count > 0) isInvalid = false;
+
     if (isInvalid) {
         drawInfoScreen(icon_monitor); 
         return; 
@@ -498,6 +648,8 @@ void DisplayService::drawPcScreen(const PcStats& pcStats) {
     const int FILL_H = 2;
     const int TEXT_X = 110;
 
+    const int SPARK_H = 12;
+
     auto drawInfilledBar = [&](int y, float percent) {
         display.drawRect(BAR_X, y, BAR_W, BAR_H, 1);
         int fillW = (int)((constrain(percent, 0, 100) / 100.0) * MAX_FILL_W);
@@ -506,21 +658,58 @@ void DisplayService::drawPcScreen(const PcStats& pcStats) {
         }
     };
 
+    // Newest sample at the right edge, one column per sample, over a dotted baseline
+    auto drawSparkline = [&](int y, const PcHistory::MetricRing& ring, int scale) {
+        uint8_t* buf = display.getBuffer();
+        uint8_t values[BAR_W];
+        int n = ring.copyLast(values, BAR_W);
+        int top = y - 3;
+        PageChart::dottedHLine(buf, BAR_X, BAR_X + BAR_W - 1, top + SPARK_H - 1);
+        PageChart::sparkline(buf, BAR_X + BAR_W - n, top, SPARK_H, values, n, scale);
+    };
+
+    auto drawRow = [&](int y, float percent, PcHistory::Metric metric) {
+        if (!historyMode) {
+            drawInfilledBar(y, percent);
+            return;
+        }
+        // Percentages keep a fixed 0-100 scale; download scales to the busiest sample held
+        const PcHistory::MetricRing& ring = history.rings[tier][metric];
+        int scale = metric == PcHistory::NET ? (ring.max > 0 ? ring.max : 1) : 100;
+        drawSparkline(y, ring, scale);
+    };
+
     // 1. CPU
     display.drawBitmap(0, 0, icon_cpu_percent, 16, 16, 1);
-    drawInfilledBar(5, pcStats.cpu_percent);
+    drawRow(5, pcStats.cpu_percent, PcHistory::CPU);
     display.setCursor(TEXT_X, 4);
     display.print(String((int)round(pcStats.cpu_percent)) + "%");
 
+    // One dot per connected PC under the CPU value, the one on screen drawn larger
+    int live = 0;
+    for (const PcHost& host : hosts.slots) {
+        if (host.id_hash != 0) live++;
+    }
+    if (live > 1) {
+        bool combined = config.pc_multi == 1;
+        int dotX = TEXT_X;
+        for (int i = 0; i < MAX_PC_HOSTS; i++) {
+            if (hosts.slots[i].id_hash == 0) continue;
+            if (combined || i == hosts.shown) display.fillRect(dotX, 12, 3, 3, 1);
+            else display.drawPixel(dotX + 1, 13, 1);
+            dotX += 5;
+        }
+    }
+
     // 2. RAM
     display.drawBitmap(0, 16, icon_ram_percent, 16, 16, 1);
-    drawInfilledBar(21, pcStats.mem_percent);
+    drawRow(21, pcStats.mem_percent, PcHistory::MEM);
     display.setCursor(TEXT_X, 20);
     display.print(String((int)round(pcStats.mem_percent)) + "%");
 
     // 3. Disk
     display.drawBitmap(0, 32, icon_disk_percent, 16, 16, 1);
-    drawInfilledBar(37, pcStats.disk_percent);
+    drawRow(37, pcStats.disk_percent, PcHistory::DISK);
     display.setCursor(TEXT_X, 36);
     display.print(String((int)round(pcStats.disk_percent)) + "%");
 
@@ -528,7 +717,7 @@ void DisplayService::drawPcScreen(const PcStats& pcStats) {
     display.drawBitmap(0, 48, icon_net_down, 16, 16, 1); 
     
     float netPercent = (pcStats.net_down_kb / 5120.0) * 100.0;
-    drawInfilledBar(53, netPercent);
+    drawRow(53, netPercent, PcHistory::NET);
     
     display.setCursor(TEXT_X, 52);
     
@@ -647,6 +836,7 @@ void DisplayService::drawMediaScreen(const PcMedia& media) {
 
 void DisplayService::drawInfoScreen(const unsigned char* image, String text) {
     display.clearDisplay();
+    invalidateScreen();
 
     display.setTextColor(SSD1306_WHITE);
     display.setTextWrap(false);
@@ -711,6 +901,9 @@ bool DisplayService::isScreenEnabled(const AppState& state, int screenIndex) {
 }
 
 void DisplayService::drawScreen(int screenIndex, const AppState& state, TimeService& timeService) {
+  unsigned long start = micros();
+  flushScreen = screenIndex;
+
   switch(screenIndex) {
     case SCREEN_TIME:
       drawTimeScreen(state.config, timeService.getCurrentTimeShort(state.config.time_format), timeService.getFullDate());
@@ -731,12 +924,62 @@ void DisplayService::drawScreen(int screenIndex, const AppState& state, TimeServ
       drawCurrencyScreen(state.config, state.currency);
       break;
     case SCREEN_PC_MONITOR:
-      drawPcScreen(state.pc);
+      drawPcScreen(state.pc, state.pc_hosts, state.pc_history, state.config);
       break;
     case SCREEN_PC_MEDIA:
       drawMediaScreen(state.media);
       break;
   }
+
+  if (metrics) metrics->recordRender(screenIndex, micros() - start);
+}
+
+uint32_t DisplayService::screenFingerprint(int screenIndex, const AppState& state) {
+    unsigned long dataVersion = 0;
+    bool showsClock = false;
+
+    switch (screenIndex) {
+        case SCREEN_TIME:        showsClock = true; break;
+        case SCREEN_WEATHER:     dataVersion = state.weather.version; showsClock = true; break;
+        case SCREEN_AIR_QUALITY: dataVersion = state.aqi.version; showsClock = true; break;
+        case SCREEN_STOCK:       dataVersion = state.stock.version; break;
+        case SCREEN_CRYPTO:      dataVersion = state.crypto.version; break;
+        case SCREEN_CURRENCY:    dataVersion = state.currency.version; break;
+        case SCREEN_PC_MONITOR:
+            dataVersion = state.pc.version + state.pc_hosts.version;
+            if (state.config.pc_view != 0) dataVersion += state.pc_history.version;
+            break;
+        case SCREEN_PC_MEDIA:    dataVersion = state.media.version; break;
+    }
+
+    uint32_t minute = showsClock ? (uint32_t)(time(nullptr) / 60) : 0;
+    uint32_t words[4] = { (uint32_t)screenIndex, (uint32_t)state.config.version, (uint32_t)dataVersion, minute };
+
+    // FNV-1a over the inputs
+    uint32_t hash = 2166136261u;
+    const uint8_t* bytes = (const uint8_t*)words;
+    for (size_t i = 0; i < sizeof(words); i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool DisplayService::drawScreenIfChanged(int screenIndex, const AppState& state, TimeService& timeService) {
+    uint32_t fingerprint = screenFingerprint(screenIndex, state);
+    if (shownFingerprintValid && fingerprint == shownFingerprint) return false;
+
+    drawScreen(screenIndex, state, timeService);
+    shownFingerprint = fingerprint;
+    shownFingerprintValid = true;
+    return true;
+}
+
+void DisplayService::invalidateScreen() {
+    // Whatever is drawing over the buffer now wins over a running transition
+    transitionActive = false;
+    activeAnim = ANIM_NONE;
+    shownFingerprintValid = false;
 }
 
 int DisplayService::getNextAnimationEffect(uint16_t mask) {
@@ -755,143 +998,134 @@ int DisplayService::getNextAnimationEffect(uint16_t mask) {
     return enabledAnims[randomIndex];
 }
 
-void DisplayService::animateTransition(int prevScreen, int nextScreen, const AppState& state, TimeService& timeService) {
+void DisplayService::startTransition(int prevScreen, int nextScreen, const AppState& state, TimeService& timeService) {
+    if (transitionActive) finishTransition();
+
     int selectedEffect = getNextAnimationEffect(state.config.anim_mask);
+    transitionStart = micros();
 
-    switch(selectedEffect) {
-        case ANIM_SLIDE_HORIZONTAL:
-            animateHorizontal(prevScreen, nextScreen, state, timeService);
-            break;
-        case ANIM_SLIDE_VERTICAL:
-            animateVertical(prevScreen, nextScreen, state, timeService);
-            break;
-        case ANIM_DISSOLVE:
-            animateDissolve(prevScreen, nextScreen, state, timeService);
-            break;
-        case ANIM_CURTAIN:
-            animateCurtain(prevScreen, nextScreen, state, timeService);
-            break;
-        case ANIM_BLINDS:
-            animateBlinds(prevScreen, nextScreen, state, timeService);
-            break;
-        default:
-            display.clearDisplay();
-            drawScreen(nextScreen, state, timeService);
-            display.display();
-            break;
-    }
+    display.clearDisplay(); drawScreen(prevScreen, state, timeService); memcpy(screenBufferOld, display.getBuffer(), 1024);
+    display.clearDisplay(); drawScreen(nextScreen, state, timeService); memcpy(screenBufferNew, display.getBuffer(), 1024);
+
+    transitionEffect = selectedEffect;
+    transitionNext = nextScreen;
+    transitionFingerprint = screenFingerprint(nextScreen, state);
+    transitionFrame = 0;
+    lastTransitionFrame = 0;
+    transitionActive = true;
+    activeAnim = selectedEffect;
+
+    // Without an effect the new screen goes out right away
+    if (selectedEffect == ANIM_NONE) finishTransition();
 }
 
-// Animations
+bool DisplayService::isAnimating() const {
+    return transitionActive;
+}
 
-void DisplayService::animateHorizontal(int prev, int next, const AppState& state, TimeService& t) {
-  display.clearDisplay(); drawScreen(prev, state, t); memcpy(screenBufferOld, display.getBuffer(), 1024);
-  display.clearDisplay(); drawScreen(next, state, t); memcpy(screenBufferNew, display.getBuffer(), 1024);
+void DisplayService::stepTransition() {
+    if (!transitionActive) return;
+    if (transitionFrame > 0 && millis() - lastTransitionFrame < TRANSITION_FRAME_MS) return;
+    lastTransitionFrame = millis();
 
-  int step = 8;
-  for (int offset = 0; offset <= 128; offset += step) {
-    uint8_t* displayBuf = display.getBuffer();
-    for (int page = 0; page < 8; page++) {
-      int start = page * 128; 
-      if (offset < 128) memcpy(&displayBuf[start], &screenBufferOld[start + offset], 128 - offset);
-      if (offset > 0) memcpy(&displayBuf[start + (128 - offset)], &screenBufferNew[start], offset);
+    if (!composeTransitionFrame(transitionEffect, transitionFrame, display.getBuffer())) {
+        finishTransition();
+        return;
     }
-    display.display();
-  }
+    flush();
+    transitionFrame++;
 }
 
-void DisplayService::animateVertical(int prev, int next, const AppState& state, TimeService& t) {
-  display.clearDisplay(); drawScreen(prev, state, t); memcpy(screenBufferOld, display.getBuffer(), 1024);
-  display.clearDisplay(); drawScreen(next, state, t); memcpy(screenBufferNew, display.getBuffer(), 1024);
+void DisplayService::finishTransition() {
+    memcpy(display.getBuffer(), screenBufferNew, 1024);
+    flush();
 
-  for (int step = 0; step <= 8; step++) {
-    uint8_t* displayBuf = display.getBuffer();
-    for (int page = 0; page < 8; page++) {
-        int oldPageIdx = page + step;
-        int newPageIdx = page - (8 - step);
+    if (metrics) metrics->recordAnimation(transitionEffect, micros() - transitionStart);
+
+    transitionActive = false;
+    activeAnim = ANIM_NONE;
+    flushScreen = transitionNext;
+    shownFingerprint = transitionFingerprint;
+    shownFingerprintValid = true;
+}
+
+// Animations: each effect is a pure function of the frame index, so a
+// transition can be advanced one frame per loop() pass. Returns false once
+// the frame index is past the effect's last frame.
+
+bool DisplayService::composeTransitionFrame(int effect, int frame, uint8_t* displayBuf) {
+  switch (effect) {
+    case ANIM_SLIDE_HORIZONTAL: {
+      int offset = frame * 8;
+      if (offset > 128) return false;
+      for (int page = 0; page < 8; page++) {
+        int start = page * 128; 
+        if (offset < 128) memcpy(&displayBuf[start], &screenBufferOld[start + offset], 128 - offset);
+        if (offset > 0) memcpy(&displayBuf[start + (128 - offset)], &screenBufferNew[start], offset);
+      }
+      return true;
+    }
+
+    case ANIM_SLIDE_VERTICAL: {
+      if (frame > 8) return false;
+      for (int page = 0; page < 8; page++) {
+        int oldPageIdx = page + frame;
+        int newPageIdx = page - (8 - frame);
         int destIndex = page * 128;
 
         if (oldPageIdx < 8) memcpy(&displayBuf[destIndex], &screenBufferOld[oldPageIdx * 128], 128);
         else if (newPageIdx >= 0) memcpy(&displayBuf[destIndex], &screenBufferNew[newPageIdx * 128], 128);
+      }
+      return true;
     }
-    display.display();
-    delay(10); 
-  }
-}
 
-void DisplayService::animateDissolve(int prev, int next, const AppState& state, TimeService& t) {
-  display.clearDisplay(); drawScreen(prev, state, t); memcpy(screenBufferOld, display.getBuffer(), 1024);
-  display.clearDisplay(); drawScreen(next, state, t); memcpy(screenBufferNew, display.getBuffer(), 1024);
-
-  uint8_t* displayBuf = display.getBuffer();
-  for (int step = 0; step < 8; step++) {
-    uint8_t mask = 0;
-    switch(step) {
-        case 0: mask = 0b10000000; break;
-        case 1: mask = 0b11000000; break;
-        case 2: mask = 0b11100000; break;
-        case 3: mask = 0b11100100; break;
-        case 4: mask = 0b11110100; break;
-        case 5: mask = 0b11111100; break;
-        case 6: mask = 0b11111110; break;
-        case 7: mask = 0b11111111; break;
-    }
-    for (int i = 0; i < 1024; i++) {
+    case ANIM_DISSOLVE: {
+      static const uint8_t masks[8] = {
+        0b10000000, 0b11000000, 0b11100000, 0b11100100,
+        0b11110100, 0b11111100, 0b11111110, 0b11111111
+      };
+      if (frame >= 8) return false;
+      uint8_t mask = masks[frame];
+      for (int i = 0; i < 1024; i++) {
         displayBuf[i] = (screenBufferNew[i] & mask) | (screenBufferOld[i] & ~mask);
+      }
+      return true;
     }
-    display.display();
-    delay(10);
-  }
-}
-
-void DisplayService::animateCurtain(int prev, int next, const AppState& state, TimeService& t) {
-  display.clearDisplay(); drawScreen(prev, state, t); memcpy(screenBufferOld, display.getBuffer(), 1024);
-  display.clearDisplay(); drawScreen(next, state, t); memcpy(screenBufferNew, display.getBuffer(), 1024);
 
-  int maxRadius = 80; 
-  int step = 4;
-  uint8_t* displayBuf = display.getBuffer();
+    case ANIM_CURTAIN: {
+      int maxRadius = 80; 
+      int r = frame * 4;
+      if (r > maxRadius) return false;
 
-  for (int r = 0; r <= maxRadius; r += step) {
       int startX = 64 - r; if (startX < 0) startX = 0;
       int endX = 64 + r; if (endX > 128) endX = 128;
       
-      for (int x = 0; x < 128; x++) {
-          bool insideCurtain = (x >= startX && x < endX);
-          for (int page = 0; page < 8; page++) {
-              int idx = x + (page * 128);
-              displayBuf[idx] = insideCurtain ? screenBufferNew[idx] : screenBufferOld[idx];
-          }
+      for (int page = 0; page < 8; page++) {
+        int start = page * 128;
+        memcpy(&displayBuf[start], &screenBufferOld[start], 128);
+        if (endX > startX) memcpy(&displayBuf[start + startX], &screenBufferNew[start + startX], endX - startX);
       }
-      display.display();
-  }
-}
+      return true;
+    }
+
+    case ANIM_BLINDS: {
+      int blindWidth = 16;
+      int stepSize = 2; 
+      // Frame 0 shows the old screen, then each frame opens stepSize more columns per blind
+      int opened = frame * stepSize;
+      if (opened > blindWidth) return false;
 
-void DisplayService::animateBlinds(int prev, int next, const AppState& state, TimeService& t) {
-  display.clearDisplay(); drawScreen(prev, state, t); memcpy(screenBufferOld, display.getBuffer(), 1024);
-  display.clearDisplay(); drawScreen(next, state, t); memcpy(screenBufferNew, display.getBuffer(), 1024);
-
-  uint8_t* displayBuf = display.getBuffer();
-  memcpy(displayBuf, screenBufferOld, 1024); 
-  display.display();
-
-  int blindWidth = 16;
-  int numBlinds = 8;
-  int stepSize = 2; 
-
-  for (int progress = 0; progress < blindWidth; progress += stepSize) {
-      for (int blind = 0; blind < numBlinds; blind++) {
-          int blindStartX = blind * blindWidth;
-          for (int i = 0; i < stepSize; i++) {
-              int currentX = blindStartX + progress + i;
-              if (currentX >= 128) continue;
-              for (int page = 0; page < 8; page++) {
-                  int idx = currentX + (page * 128);
-                  displayBuf[idx] = screenBufferNew[idx];
-              }
-          }
+      for (int x = 0; x < 128; x++) {
+        bool isOpen = (x % blindWidth) < opened;
+        for (int page = 0; page < 8; page++) {
+          int idx = x + (page * 128);
+          displayBuf[idx] = isOpen ? screenBufferNew[idx] : screenBufferOld[idx];
+        }
       }
-      display.display();
-      delay(5);
+      return true;
+    }
+
+    default:
+      return false;
   }
 }
\ No newline at end of file
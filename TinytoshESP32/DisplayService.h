@@ -5,6 +5,7 @@
 #include <Adafruit_SSD1306.h>
 #include <Wire.h>
 #include "TimeService.h"
+#include "MetricsService.h"
 
 class DisplayService {
 public:
@@ -12,6 +13,13 @@ public:
 
     DisplayService(int width, int height, int reset_pin);
     void begin();
+    void setMetrics(MetricsService* metricsService);
+
+    // Panel I/O is confined to begin(), flush() and setContrast(); the draw* and
+    // transition paths only touch the 1024-byte page-major buffer.
+    void flush();
+    void setContrast(uint8_t level);
+    size_t encodeFramePBM(uint8_t* out, size_t capacity);
     
     void showOLEDStatus(std::initializer_list<String> lines, bool clear = true);
     void drawTimeScreen(const Config& config, String timeStr, String dateStr);
@@ -20,25 +28,64 @@ public:
     void drawCryptoScreen(const Config& config, const CryptoData& data);
     void drawCurrencyScreen(const Config& config, const CurrencyData& data);
     void drawStockScreen(const Config& config, const StockData& data);
-    void drawPcScreen(const PcStats& pcStats);
+    void drawPcScreen(const PcStats& pcStats, const PcHosts& hosts, const PcHistory& history, const Config& config);
     void drawMediaScreen(const PcMedia& media);
     void drawInfoScreen(const unsigned char* image = nullptr, String text = "No Data");
 
     void drawScreen(int screenIndex, const AppState& state, TimeService& timeService);
-    void animateTransition(int prevScreen, int nextScreen, const AppState& state, TimeService& timeService);
+    // Redraws only when the screen's inputs (config, its data source, the
+    // displayed minute) changed since the last draw; returns true if it drew.
+    bool drawScreenIfChanged(int screenIndex, const AppState& state, TimeService& timeService);
+    void invalidateScreen();
+
+    // Transitions render both screens up front, then stepTransition() pushes at
+    // most one frame per TRANSITION_FRAME_MS so loop() keeps servicing input.
+    // Starting a new transition snaps a running one to its final frame.
+    void startTransition(int prevScreen, int nextScreen, const AppState& state, TimeService& timeService);
+    void stepTransition();
+    bool isAnimating() const;
 
     bool isScreenEnabled(const AppState& state, int screenIndex);
 
+    static const uint8_t I2C_ADDRESS = 0x3C;
+    static const size_t FRAME_BUFFER_SIZE = 1024;
+    static const size_t FRAME_PBM_SIZE = 10 + FRAME_BUFFER_SIZE;
+    static const unsigned long TRANSITION_FRAME_MS = 15;
+
 private:    
     uint8_t screenBufferOld[1024];
     uint8_t screenBufferNew[1024];
 
+    // Copy of what the panel's GDDRAM currently holds; flush() only sends the
+    // column span of each page that differs from it.
+    uint8_t panelShadow[1024];
+    bool panelShadowValid = false;
+
+    uint32_t shownFingerprint = 0;
+    bool shownFingerprintValid = false;
+    int lastContrast = -1;
+
+    bool transitionActive = false;
+    int transitionEffect = ANIM_NONE;
+    int transitionNext = 0;
+    int transitionFrame = 0;
+    uint32_t transitionFingerprint = 0;
+    unsigned long transitionStart = 0;
+    unsigned long lastTransitionFrame = 0;
+
+    MetricsService* metrics = nullptr;
+    int flushScreen = MetricsService::SYSTEM_SLOT;
+    int activeAnim = ANIM_NONE;
+
+    uint32_t screenFingerprint(int screenIndex, const AppState& state);
+    size_t flushChangedPages();
+    void sendPageWindow(uint8_t page, uint8_t colStart, uint8_t colEnd, const uint8_t* data);
+
+    void drawPriceChart(const PriceSeries& series, float baseline);
+
     int getNextAnimationEffect(uint16_t mask);
-    void animateHorizontal(int prev, int next, const AppState& state, TimeService& t);
-    void animateVertical(int prev, int next, const AppState& state, TimeService& t);
-    void animateDissolve(int prev, int next, const AppState& state, TimeService& t);
-    void animateCurtain(int prev, int next, const AppState& state, TimeService& t);
-    void animateBlinds(int prev, int next, const AppState& state, TimeService& t);
+    void finishTransition();
+    bool composeTransitionFrame(int effect, int frame, uint8_t* displayBuf);
 
     String getWeatherDescription(int wmo_code);
     const unsigned char* getWeatherBitmap(int wmo_code, bool is_day);
@@ -0,0 +1,194 @@
+#include "FetchScheduler.h"
+#include <WiFi.h>
+
+static const char* SOURCE_NAMES[NUM_FETCH_SOURCES] = { "Weather", "AQI", "Stock", "Crypto", "Currency" };
+
+// Replaces the published struct but keeps its version counter monotonic for DisplayService
+template <typename T>
+static void adopt(T& target, const T& staged) {
+    unsigned long version = target.version;
+    target = staged;
+    target.version = version + 1;
+}
+
+FetchScheduler::FetchScheduler(HttpConnectionPool& httpPool, TimeService& timeService, WeatherService& weatherService, AirQualityService& airQualityService,
+                               StockService& stockService, CryptoService& cryptoService, CurrencyService& currencyService) :
+    httpPool(httpPool), timeService(timeService), weatherService(weatherService), airQualityService(airQualityService),
+    stockService(stockService), cryptoService(cryptoService), currencyService(currencyService) {
+
+    // Currency APIs publish daily rates, so that source polls at a quarter of the rate
+    schedule[FETCH_WEATHER]  = {1, 8000, 0, 0, 0, false};
+    schedule[FETCH_AQI]      = {1, 8000, 0, 0, 0, false};
+    schedule[FETCH_STOCK]    = {1, 10000, 0, 0, 0, false};
+    schedule[FETCH_CRYPTO]   = {1, 8000, 0, 0, 0, false};
+    schedule[FETCH_CURRENCY] = {4, 6000, 0, 0, 0, false};
+}
+
+void FetchScheduler::begin() {
+    if (task) return;
+    mutex = xSemaphoreCreateMutex();
+    if (xTaskCreate(taskEntry, "fetch", TASK_STACK_SIZE, this, 1, &task) != pdPASS) {
+        Serial.println("FetchScheduler: Failed to start fetch task.");
+        task = nullptr;
+        return;
+    }
+    Serial.println("FetchScheduler: Fetch task started.");
+}
+
+void FetchScheduler::setConfig(const Config& newConfig, int intervalMultiplier) {
+    if (!mutex) return;
+    if (configSet && newConfig.version == configVersion && intervalMultiplier == multiplier) return;
+    xSemaphoreTake(mutex, portMAX_DELAY);
+
+    config = newConfig;
+    configVersion = newConfig.version;
+    multiplier = intervalMultiplier;
+    configSet = true;
+
+    xSemaphoreGive(mutex);
+}
+
+void FetchScheduler::requestRefresh() {
+    if (!mutex) return;
+    xSemaphoreTake(mutex, portMAX_DELAY);
+    refreshRequested = true;
+    xSemaphoreGive(mutex);
+}
+
+bool FetchScheduler::publish(AppState& state) {
+    if (!mutex) return false;
+    if (xSemaphoreTake(mutex, 0) != pdTRUE) return false;
+
+    bool published = false;
+    for (int i = 0; i < NUM_FETCH_SOURCES; i++) {
+        if (!schedule[i].staged) continue;
+        switch (i) {
+            case FETCH_WEATHER:  adopt(state.weather, stagedWeather); break;
+            case FETCH_AQI:      adopt(state.aqi, stagedAqi); break;
+            case FETCH_STOCK:    adopt(state.stock, stagedStock); break;
+            case FETCH_CRYPTO:   adopt(state.crypto, stagedCrypto); break;
+            case FETCH_CURRENCY: adopt(state.currency, stagedCurrency); break;
+        }
+        schedule[i].staged = false;
+        published = true;
+    }
+
+    xSemaphoreGive(mutex);
+    return published;
+}
+
+void FetchScheduler::taskEntry(void* arg) {
+    static_cast<FetchScheduler*>(arg)->run();
+}
+
+void FetchScheduler::run() {
+    unsigned long taskConfigVersion = 0;
+    bool haveConfig = false;
+
+    for (;;) {
+        int due = -1;
+        uint16_t deadlineMs = 0;
+
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        if (configSet) {
+            if (!haveConfig || taskConfigVersion != configVersion) {
+                taskConfig = config;
+                taskConfigVersion = configVersion;
+                haveConfig = true;
+            }
+
+            unsigned long now = millis();
+            if (refreshRequested) {
+                for (auto& s : schedule) {
+                    s.nextDue = now;
+                    s.backoffMs = 0;
+                    s.failures = 0;
+                }
+                refreshRequested = false;
+            }
+
+            for (int i = 0; i < NUM_FETCH_SOURCES; i++) {
+                if (isEnabled(i, taskConfig) && (long)(now - schedule[i].nextDue) >= 0) {
+                    due = i;
+                    deadlineMs = schedule[i].deadlineMs;
+                    break;
+                }
+            }
+        }
+        xSemaphoreGive(mutex);
+
+        if (due < 0 || WiFi.status() != WL_CONNECTED) {
+            httpPool.closeIdle();
+            vTaskDelay(pdMS_TO_TICKS(TASK_TICK_MS));
+            continue;
+        }
+
+        unsigned long start = millis();
+        bool ok = fetch(due, deadlineMs);
+
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        SourceSchedule& s = schedule[due];
+        unsigned long now = millis();
+        unsigned long intervalMs = taskConfig.refresh_interval_min * 60000UL * s.intervalFactor * multiplier;
+
+        if (ok) {
+            stage(due);
+            s.staged = true;
+            s.failures = 0;
+            s.backoffMs = 0;
+            s.nextDue = now + intervalMs;
+        } else {
+            s.failures++;
+            s.backoffMs = s.backoffMs ? min(s.backoffMs * 2, intervalMs) : min(BACKOFF_BASE_MS, intervalMs);
+            s.nextDue = now + s.backoffMs;
+        }
+        uint8_t failures = s.failures;
+        unsigned long retryMs = s.backoffMs;
+        xSemaphoreGive(mutex);
+
+        if (ok) {
+            Serial.printf("FetchScheduler: %s updated in %lu ms (stack headroom %u bytes, free heap %u).\n", SOURCE_NAMES[due], now - start,
+                          (unsigned)uxTaskGetStackHighWaterMark(nullptr), (unsigned)ESP.getFreeHeap());
+        } else {
+            Serial.printf("FetchScheduler: %s failed (%u in a row), retrying in %lu s.\n", SOURCE_NAMES[due], failures, retryMs / 1000);
+        }
+    }
+}
+
+bool FetchScheduler::isEnabled(int source, const Config& cfg) {
+    switch (source) {
+        case FETCH_WEATHER:  return cfg.show_weather;
+        case FETCH_AQI:      return cfg.show_aqi;
+        case FETCH_STOCK:    return cfg.show_stock;
+        case FETCH_CRYPTO:   return cfg.show_crypto;
+        case FETCH_CURRENCY: return cfg.show_currency;
+        default:             return false;
+    }
+}
+
+bool FetchScheduler::fetch(int source, uint16_t deadlineMs) {
+    switch (source) {
+        case FETCH_WEATHER:
+            return weatherService.fetchWeather(taskConfig, weather, timeService.getCurrentTime(taskConfig.time_format), deadlineMs);
+        case FETCH_AQI:
+            return airQualityService.fetchAirQuality(taskConfig, aqi, deadlineMs);
+        case FETCH_STOCK:
+            return stockService.fetchStock(taskConfig.stock_symbol, stock, deadlineMs, taskConfig.stock_chart);
+        case FETCH_CRYPTO:
+            return cryptoService.fetchPrice(taskConfig.crypto_id, crypto, deadlineMs);
+        case FETCH_CURRENCY:
+            return currencyService.fetchRate(taskConfig.currency_base, taskConfig.currency_target, currency, deadlineMs);
+        default:
+            return false;
+    }
+}
+
+void FetchScheduler::stage(int source) {
+    switch (source) {
+        case FETCH_WEATHER:  stagedWeather = weather; break;
+        case FETCH_AQI:      stagedAqi = aqi; break;
+        case FETCH_STOCK:    stagedStock = stock; break;
+        case FETCH_CRYPTO:   stagedCrypto = crypto; break;
+        case FETCH_CURRENCY: stagedCurrency = currency; break;
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef FETCH_SCHEDULER_H
+#define FETCH_SCHEDULER_H
+
+#include <Arduino.h>
+#include "structs.h"
+#include "TimeService.h"
+#include "WeatherService.h"
+#include "AirQualityService.h"
+#include "StockService.h"
+#include "CryptoService.h"
+#include "CurrencyService.h"
+#include "HttpConnectionPool.h"
+
+enum FetchSource {
+    FETCH_WEATHER,
+    FETCH_AQI,
+    FETCH_STOCK,
+    FETCH_CRYPTO,
+    FETCH_CURRENCY,
+    NUM_FETCH_SOURCES
+};
+
+// Runs the API fetchers on their own FreeRTOS task. Each source keeps its own
+// interval, request deadline and failure backoff; finished results are staged
+// under a mutex and only copied into AppState by publish(), which loop() calls,
+// so the render path never waits on the network.
+class FetchScheduler {
+public:
+    FetchScheduler(HttpConnectionPool& httpPool, TimeService& timeService, WeatherService& weatherService, AirQualityService& airQualityService,
+                   StockService& stockService, CryptoService& cryptoService, CurrencyService& currencyService);
+
+    void begin();
+
+    // Called from loop(); the config is only copied when its version or the multiplier changed
+    void setConfig(const Config& config, int intervalMultiplier);
+    void requestRefresh();
+    bool publish(AppState& state);
+
+private:
+    struct SourceSchedule {
+        unsigned long intervalFactor;   // multiples of config.refresh_interval_min
+        uint16_t deadlineMs;            // HTTP timeout handed to the fetcher
+        unsigned long nextDue;
+        unsigned long backoffMs;
+        uint8_t failures;
+        bool staged;
+    };
+
+    static const unsigned long TASK_TICK_MS = 250;
+    static const unsigned long BACKOFF_BASE_MS = 30000;
+    static const uint32_t TASK_STACK_SIZE = 12288;
+
+    HttpConnectionPool& httpPool;
+    TimeService& timeService;
+    WeatherService& weatherService;
+    AirQualityService& airQualityService;
+    StockService& stockService;
+    CryptoService& cryptoService;
+    CurrencyService& currencyService;
+
+    SemaphoreHandle_t mutex = nullptr;
+    TaskHandle_t task = nullptr;
+
+    // Shared with the task, guarded by mutex
+    Config config;
+    unsigned long configVersion = 0;
+    bool configSet = false;
+    int multiplier = 1;
+    bool refreshRequested = false;
+    SourceSchedule schedule[NUM_FETCH_SOURCES];
+
+    WeatherData stagedWeather;
+    AirQualityData stagedAqi;
+    StockData stagedStock;
+    CryptoData stagedCrypto;
+    CurrencyData stagedCurrency;
+
+    // Task-private working copies the fetchers write into
+    Config taskConfig;
+    WeatherData weather;
+    AirQualityData aqi;
+    StockData stock;
+    CryptoData crypto;
+    CurrencyData currency;
+
+    static void taskEntry(void* arg);
+    void run();
+    bool isEnabled(int source, const Config& cfg);
+    bool fetch(int source, uint16_t deadlineMs);
+    void stage(int source);
+};
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef HISTORY_RING_H
+#define HISTORY_RING_H
+
+#include <Arduino.h>
+
+// Fixed ring of quantized samples; once full, each push overwrites the oldest.
+// min/max always describe the samples currently held. They come from two
+// monotonic queues of ring slots (rising values for min, falling for max),
+// so a push is amortized O(1) whatever is evicted, flat series included. The
+// queues cost two bytes per sample on top of the samples themselves.
+template <typename T, int N>
+struct HistoryRing {
+    static_assert(N <= 256, "queue slots are one byte");
+    static const int LENGTH = N;
+
+    T samples[N] = {};
+    uint16_t head = 0;                  // next write position
+    uint16_t count = 0;
+    T min = 0;
+    T max = 0;
+
+    void clear() {
+        head = 0;
+        count = 0;
+        min = max = 0;
+        minQueue.clear();
+        maxQueue.clear();
+    }
+
+    void push(T value) {
+        if (count == N) {
+            // The oldest sample leaves; if a queue still holds it, it is at the front
+            minQueue.dropFront(head);
+            maxQueue.dropFront(head);
+        } else {
+            count++;
+        }
+
+        samples[head] = value;
+        while (minQueue.length > 0 && samples[minQueue.back()] >= value) minQueue.length--;
+        while (maxQueue.length > 0 && samples[maxQueue.back()] <= value) maxQueue.length--;
+        minQueue.pushBack(head);
+        maxQueue.pushBack(head);
+        head = (head + 1) % N;
+
+        min = samples[minQueue.front()];
+        max = samples[maxQueue.front()];
+    }
+
+    // i = 0 is the oldest sample held
+    T at(int i) const { return samples[(head - count + i + N) % N]; }
+
+    // Copies up to n of the newest samples, oldest first; returns how many
+    int copyLast(T* out, int n) const {
+        if (n > count) n = count;
+        for (int i = 0; i < n; i++) out[i] = at(count - n + i);
+        return n;
+    }
+
+private:
+    // Ring slots, oldest first
+    struct SlotQueue {
+        uint8_t slots[N] = {};
+        uint16_t first = 0;
+        uint16_t length = 0;
+
+        void clear() { first = length = 0; }
+        uint8_t front() const { return slots[first]; }
+        uint8_t back() const { return slots[(first + length - 1) % N]; }
+        void pushBack(uint16_t slot) { slots[(first + length++) % N] = (uint8_t)slot; }
+        void dropFront(uint16_t slot) {
+            if (length > 0 && slots[first] == slot) {
+                first = (first + 1) % N;
+                length--;
+            }
+        }
+    };
+
+    SlotQueue minQueue;
+    SlotQueue maxQueue;
+};
+
+#endif
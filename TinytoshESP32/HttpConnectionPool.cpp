@@ -0,0 +1,259 @@
+#include "HttpConnectionPool.h"
+
+static const char* BODY_HEADERS[] = { "Transfer-Encoding" };
+
+void HttpBodyStream::begin(WiFiClient* streamClient, int contentLength, bool isChunked) {
+    client = streamClient;
+    chunked = isChunked;
+    firstChunk = true;
+    remaining = chunked ? 0 : contentLength;
+    done = (client == nullptr) || (!chunked && contentLength == 0);
+}
+
+bool HttpBodyStream::readByte(uint8_t& c) {
+    return client->readBytes(&c, 1) == 1;
+}
+
+bool HttpBodyStream::readChunkHeader() {
+    uint8_t c;
+    if (!firstChunk) {
+        // CRLF that terminates the previous chunk's data
+        if (!readByte(c) || !readByte(c)) return false;
+    }
+    firstChunk = false;
+
+    long size = 0;
+    bool inExtension = false;
+    for (;;) {
+        if (!readByte(c)) return false;
+        if (c == '\n') break;
+        if (c == '\r' || inExtension) continue;
+        if (c == ';') { inExtension = true; continue; }
+
+        int digit = (c >= '0' && c <= '9') ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+        if (digit < 0) return false;
+        size = (size << 4) | digit;
+    }
+
+    if (size == 0) {
+        // Skip trailer headers up to the terminating empty line
+        int lineLength = 0;
+        for (;;) {
+            if (!readByte(c)) return false;
+            if (c == '\n') {
+                if (lineLength == 0) break;
+                lineLength = 0;
+            } else if (c != '\r') {
+                lineLength++;
+            }
+        }
+        done = true;
+    }
+
+    remaining = size;
+    return true;
+}
+
+bool HttpBodyStream::ensureData() {
+    if (done) return false;
+    if (chunked && remaining == 0) {
+        if (!readChunkHeader()) done = true;
+        if (done) return false;
+    }
+    if (remaining < 0 && !client->connected() && !client->available()) {
+        done = true;
+        return false;
+    }
+    return true;
+}
+
+int HttpBodyStream::available() {
+    if (!ensureData()) return 0;
+    int avail = client->available();
+    return (remaining > 0 && avail > remaining) ? remaining : avail;
+}
+
+int HttpBodyStream::read() {
+    if (!ensureData()) return -1;
+    int c = client->read();
+    if (c < 0) return -1;
+
+    if (remaining > 0) {
+        remaining--;
+        if (remaining == 0 && !chunked) done = true;
+    }
+    return c;
+}
+
+int HttpBodyStream::peek() {
+    if (!ensureData()) return -1;
+    return client->peek();
+}
+
+bool HttpBodyStream::drain(size_t limit) {
+    // A body delimited only by connection close can never be reused
+    if (!done && !chunked && remaining < 0) return false;
+
+    uint8_t c;
+    while (!done && limit-- > 0) {
+        if (readBytes(&c, 1) != 1) break;
+    }
+    return done;
+}
+
+HttpConnectionPool::~HttpConnectionPool() {
+    for (auto& slot : slots) close(slot);
+    for (auto& saved : sessions) TlsClient::freeSession(saved.session);
+}
+
+String HttpConnectionPool::originOf(const String& url) {
+    int schemeEnd = url.indexOf("://");
+    int pathStart = url.indexOf('/', schemeEnd < 0 ? 0 : schemeEnd + 3);
+    return pathStart < 0 ? url : url.substring(0, pathStart);
+}
+
+HttpConnectionPool::Slot& HttpConnectionPool::slotFor(const String& origin, bool secure) {
+    Slot* lru = &slots[0];
+    for (auto& slot : slots) {
+        if (slot.client && slot.origin == origin) return slot;
+        if (!slot.client) lru = &slot;
+        else if (lru->client && slot.lastUsed < lru->lastUsed) lru = &slot;
+    }
+
+    close(*lru);
+    if (secure) {
+        lru->tls = new TlsClient();
+        lru->client = lru->tls;
+    } else {
+        lru->client = new WiFiClient();
+    }
+    lru->origin = origin;
+    return *lru;
+}
+
+void HttpConnectionPool::close(Slot& slot) {
+    if (!slot.client) return;
+    slot.http.end();
+    slot.client->stop();
+    delete slot.client;
+    slot.client = nullptr;
+    slot.tls = nullptr;
+    slot.origin = "";
+}
+
+HttpConnectionPool::SavedSession* HttpConnectionPool::sessionFor(const String& origin) {
+    for (auto& saved : sessions) {
+        if (saved.session && saved.origin == origin) return &saved;
+    }
+    return nullptr;
+}
+
+void HttpConnectionPool::saveSession(Slot& slot) {
+    TlsSession* session = slot.tls->saveSession();
+    if (!session) return;
+
+    SavedSession* target = sessionFor(slot.origin);
+    if (!target) {
+        target = &sessions[0];
+        for (auto& saved : sessions) {
+            if (!saved.session) { target = &saved; break; }
+            if (saved.lastUsed < target->lastUsed) target = &saved;
+        }
+    }
+    TlsClient::freeSession(target->session);
+    target->origin = slot.origin;
+    target->session = session;
+    target->lastUsed = millis();
+}
+
+void HttpConnectionPool::forgetSession(const String& origin) {
+    SavedSession* saved = sessionFor(origin);
+    if (!saved) return;
+    TlsClient::freeSession(saved->session);
+    saved->session = nullptr;
+    saved->origin = "";
+}
+
+HTTPClient& HttpConnectionPool::get(const String& url, uint16_t timeoutMs, int& httpCode) {
+    bool secure = url.startsWith("https://");
+    Slot& slot = slotFor(originOf(url), secure);
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        bool warm = slot.client->connected();
+        SavedSession* saved = nullptr;
+        if (slot.tls && !warm) {
+            saved = sessionFor(slot.origin);
+            slot.tls->setSession(saved ? saved->session : nullptr);
+        }
+
+        slot.http.setReuse(true);
+        slot.http.setConnectTimeout(timeoutMs);
+        slot.http.setTimeout(timeoutMs);
+        slot.http.begin(*slot.client, url);
+        slot.http.collectHeaders(BODY_HEADERS, 1);
+        httpCode = slot.http.GET();
+
+        // The server may have dropped a kept-alive socket; retry once on a fresh connection
+        if (httpCode < 0 && warm) {
+            slot.http.end();
+            slot.client->stop();
+            continue;
+        }
+
+        if (warm) reused++;
+        else opened++;
+        if (saved) offered++;
+        if (slot.tls && !warm) {
+            // A server may reject the saved session and handshake in full; either way the fresh one replaces it
+            if (httpCode < 0 && saved) forgetSession(slot.origin);
+            else if (httpCode >= 0) saveSession(slot);
+        }
+        Serial.printf("HttpConnectionPool: %s %s%s (opened %lu, reused %lu, TLS sessions offered %lu)\n",
+                      warm ? "Reused" : "Opened", slot.origin.c_str(), saved ? " with a saved TLS session" : "",
+                      (unsigned long)opened, (unsigned long)reused, (unsigned long)offered);
+        break;
+    }
+
+    slot.timeoutMs = timeoutMs;
+    slot.lastUsed = millis();
+    return slot.http;
+}
+
+HttpConnectionPool::Slot* HttpConnectionPool::slotOf(HTTPClient& http) {
+    for (auto& slot : slots) {
+        if (&slot.http == &http) return &slot;
+    }
+    return nullptr;
+}
+
+HttpBodyStream& HttpConnectionPool::body(HTTPClient& http) {
+    Slot* slot = slotOf(http);
+    bool chunked = http.header("Transfer-Encoding").equalsIgnoreCase("chunked");
+
+    slot->body.begin(http.getStreamPtr(), http.getSize(), chunked);
+    slot->body.setTimeout(slot->timeoutMs);
+    slot->bodyOpened = true;
+    return slot->body;
+}
+
+void HttpConnectionPool::release(HTTPClient& http) {
+    Slot* slot = slotOf(http);
+    if (slot) {
+        // Leftover body bytes would be read as the next response's status line
+        if (!slot->bodyOpened) body(http);
+        if (!slot->body.drain(DRAIN_LIMIT)) slot->client->stop();
+        slot->bodyOpened = false;
+    }
+
+    // With reuse enabled, end() leaves the socket open when the response allowed keep-alive
+    http.end();
+    if (slot) slot->lastUsed = millis();
+}
+
+void HttpConnectionPool::closeIdle() {
+    unsigned long now = millis();
+    for (auto& slot : slots) {
+        if (!slot.client) continue;
+        if (!slot.client->connected() || now - slot.lastUsed > IDLE_TIMEOUT_MS) close(slot);
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef HTTP_CONNECTION_POOL_H
+#define HTTP_CONNECTION_POOL_H
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include "TlsClient.h"
+
+// Response body on top of a pooled socket. Honours Content-Length and decodes
+// chunked transfer encoding so ArduinoJson can parse straight off the wire
+// while the connection stays usable for the next keep-alive request.
+class HttpBodyStream : public Stream {
+public:
+    void begin(WiFiClient* client, int contentLength, bool chunked);
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t write(uint8_t) override { return 0; }
+
+    bool finished() const { return done; }
+    bool drain(size_t limit);
+
+private:
+    WiFiClient* client = nullptr;
+    long remaining = 0;     // bytes left in the body, or in the current chunk; -1 reads until close
+    bool chunked = false;
+    bool firstChunk = true;
+    bool done = true;
+
+    bool ensureData();
+    bool readChunkHeader();
+    bool readByte(uint8_t& c);
+};
+
+// Shares one HTTPClient and transport per origin (scheme://host:port) among
+// the fetchers. A socket is only reused when requests to the same origin come
+// back to back, e.g. a stock quote followed by its intraday history; servers
+// and closeIdle() drop it long before the next refresh cycle. The TLS session
+// outlives the socket, though: each https origin keeps its last session, so
+// the next cycle's connection resumes it instead of running a full handshake.
+// Live TLS connections cost ~40 KB each, so only a couple are kept; a saved
+// session is a few hundred bytes plus the server certificate. Not thread-safe:
+// only the fetch task uses it.
+class HttpConnectionPool {
+public:
+    ~HttpConnectionPool();
+
+    // Issues a GET on a pooled connection; the caller reads the response from
+    // the returned client and must hand it back with release().
+    HTTPClient& get(const String& url, uint16_t timeoutMs, int& httpCode);
+    // Streams the body of the response get() returned; release() drains what
+    // was left unread, or drops the socket if too much is left.
+    HttpBodyStream& body(HTTPClient& http);
+    void release(HTTPClient& http);
+
+    // Closes idle sockets; saved TLS sessions stay for the next cycle
+    void closeIdle();
+
+private:
+    struct Slot {
+        String origin;
+        WiFiClient* client = nullptr;
+        TlsClient* tls = nullptr;      // client, when the origin is https
+        HTTPClient http;
+        HttpBodyStream body;
+        bool bodyOpened = false;
+        uint16_t timeoutMs = 0;
+        unsigned long lastUsed = 0;
+    };
+
+    struct SavedSession {
+        String origin;
+        TlsSession* session = nullptr;
+        unsigned long lastUsed = 0;
+    };
+
+    static const int MAX_CONNECTIONS = 2;
+    // One per https origin the fetchers use, plus the currency API's fallback
+    static const int MAX_SESSIONS = 6;
+    static const unsigned long IDLE_TIMEOUT_MS = 30000;
+    static const size_t DRAIN_LIMIT = 512;
+
+    Slot slots[MAX_CONNECTIONS];
+    SavedSession sessions[MAX_SESSIONS];
+    uint32_t opened = 0;
+    uint32_t reused = 0;
+    uint32_t offered = 0;
+
+    Slot& slotFor(const String& origin, bool secure);
+    Slot* slotOf(HTTPClient& http);
+    void close(Slot& slot);
+    SavedSession* sessionFor(const String& origin);
+    void saveSession(Slot& slot);
+    void forgetSession(const String& origin);
+    static String originOf(const String& url);
+};
+
+#endif
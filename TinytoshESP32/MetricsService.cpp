@@ -0,0 +1,103 @@
+#include "MetricsService.h"
+
+static const char* ANIM_KEYS[MetricsService::NUM_ANIMS] = {
+    "none", "slide_horizontal", "slide_vertical", "dissolve", "curtain", "blinds"
+};
+
+void LatencyHistogram::record(uint32_t us, uint32_t budgetUs) {
+    int idx = 0;
+    uint32_t scaled = us / FIRST_BOUND_US;
+    while (scaled > 0 && idx < NUM_BUCKETS - 1) {
+        scaled >>= 1;
+        idx++;
+    }
+
+    buckets[idx]++;
+    count++;
+    total_us += us;
+    if (us > max_us) max_us = us;
+    if (us > budgetUs) over_budget++;
+}
+
+MetricsService::MetricsService(unsigned long frameBudgetMs) : budgetUs(frameBudgetMs * 1000UL) {}
+
+void MetricsService::recordRender(int screen, uint32_t us) {
+    if (screen < 0 || screen >= NUM_SCREENS) return;
+    render[screen].record(us, budgetUs);
+}
+
+void MetricsService::recordFlush(int screen, uint32_t us) {
+    if (screen < 0 || screen >= NUM_SCREENS) screen = SYSTEM_SLOT;
+    flush[screen].record(us, budgetUs);
+}
+
+void MetricsService::recordAnimation(int anim, uint32_t us) {
+    if (anim < 0 || anim >= NUM_ANIMS) return;
+    this->anim[anim].record(us, budgetUs);
+}
+
+void MetricsService::recordAnimationFlush(int anim, uint32_t us) {
+    if (anim < 0 || anim >= NUM_ANIMS) return;
+    animFlush[anim].record(us, budgetUs);
+}
+
+void MetricsService::recordFlushBytes(uint32_t bytes) {
+    flushCount++;
+    flushBytes += bytes;
+}
+
+void MetricsService::reset() {
+    for (auto& h : render) h = LatencyHistogram();
+    for (auto& h : flush) h = LatencyHistogram();
+    for (auto& h : anim) h = LatencyHistogram();
+    for (auto& h : animFlush) h = LatencyHistogram();
+    flushCount = 0;
+    flushBytes = 0;
+}
+
+void MetricsService::writeHistogram(Print& out, const LatencyHistogram& h) {
+    uint32_t mean = h.count ? (uint32_t)(h.total_us / h.count) : 0;
+    out.printf("{\"count\":%lu,\"mean_us\":%lu,\"max_us\":%lu,\"over_budget\":%lu,\"buckets\":[",
+               (unsigned long)h.count, (unsigned long)mean, (unsigned long)h.max_us, (unsigned long)h.over_budget);
+    for (int i = 0; i < LatencyHistogram::NUM_BUCKETS; i++) {
+        if (i) out.print(',');
+        out.print((unsigned long)h.buckets[i]);
+    }
+    out.print("]}");
+}
+
+void MetricsService::writeJson(Print& out) const {
+    out.printf("{\"uptime_ms\":%lu,\"budget_us\":%lu,\"bucket_bounds_us\":[", millis(), (unsigned long)budgetUs);
+    for (int i = 0; i < LatencyHistogram::NUM_BUCKETS - 1; i++) {
+        if (i) out.print(',');
+        out.print((unsigned long)(LatencyHistogram::FIRST_BOUND_US << i));
+    }
+
+    out.printf("],\"i2c\":{\"flushes\":%lu,\"bytes\":%llu,\"full_frame_bytes\":%llu}",
+               (unsigned long)flushCount, (unsigned long long)flushBytes, (unsigned long long)flushCount * 1024ULL);
+
+    out.print(",\"render\":{");
+    for (int i = 0; i < NUM_SCREENS; i++) {
+        if (i) out.print(',');
+        out.printf("\"%s\":", SCREEN_NAMES[i]);
+        writeHistogram(out, render[i]);
+    }
+
+    out.print("},\"flush\":{");
+    for (int i = 0; i <= NUM_SCREENS; i++) {
+        if (i) out.print(',');
+        out.printf("\"%s\":", i == SYSTEM_SLOT ? "System" : SCREEN_NAMES[i]);
+        writeHistogram(out, flush[i]);
+    }
+
+    out.print("},\"animation\":{");
+    for (int i = 1; i < NUM_ANIMS; i++) {
+        if (i > 1) out.print(',');
+        out.printf("\"%s\":{\"total\":", ANIM_KEYS[i]);
+        writeHistogram(out, anim[i]);
+        out.print(",\"flush\":");
+        writeHistogram(out, animFlush[i]);
+        out.print('}');
+    }
+    out.print("}}");
+}
@@ -0,0 +1,52 @@
+#ifndef METRICS_SERVICE_H
+#define METRICS_SERVICE_H
+
+#include <Arduino.h>
+#include "structs.h"
+
+// Log2 latency histogram: bucket i counts samples below (128us << i), the last
+// bucket collects everything slower (~2 s and up).
+struct LatencyHistogram {
+    static const int NUM_BUCKETS = 16;
+    static const uint32_t FIRST_BOUND_US = 128;
+
+    uint32_t buckets[NUM_BUCKETS] = {0};
+    uint32_t count = 0;
+    uint64_t total_us = 0;
+    uint32_t max_us = 0;
+    uint32_t over_budget = 0;
+
+    void record(uint32_t us, uint32_t budgetUs);
+};
+
+class MetricsService {
+public:
+    static const int NUM_ANIMS = ANIM_RANDOM;
+    static const int SYSTEM_SLOT = NUM_SCREENS;
+
+    MetricsService(unsigned long frameBudgetMs);
+
+    void recordRender(int screen, uint32_t us);
+    void recordFlush(int screen, uint32_t us);
+    void recordAnimation(int anim, uint32_t us);
+    void recordAnimationFlush(int anim, uint32_t us);
+    void recordFlushBytes(uint32_t bytes);
+
+    void writeJson(Print& out) const;
+    void reset();
+
+private:
+    uint32_t budgetUs;
+
+    LatencyHistogram render[NUM_SCREENS];
+    LatencyHistogram flush[NUM_SCREENS + 1];
+    LatencyHistogram anim[NUM_ANIMS];
+    LatencyHistogram animFlush[NUM_ANIMS];
+
+    uint32_t flushCount = 0;
+    uint64_t flushBytes = 0;
+
+    static void writeHistogram(Print& out, const LatencyHistogram& h);
+};
+
+#endif
@@ -0,0 +1,88 @@
+#include "PageChart.h"
+
+void PageChart::column(uint8_t* buf, int x, int y0, int y1) {
+    if (y0 > y1) {
+        int t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+    if (x < 0 || x >= WIDTH || y1 < 0 || y0 >= HEIGHT) return;
+    if (y0 < 0) y0 = 0;
+    if (y1 >= HEIGHT) y1 = HEIGHT - 1;
+
+    uint8_t* col = buf + x;
+    int page0 = y0 >> 3;
+    int page1 = y1 >> 3;
+    uint8_t topMask = (uint8_t)(0xFF << (y0 & 7));
+    uint8_t bottomMask = (uint8_t)(0xFF >> (7 - (y1 & 7)));
+
+    if (page0 == page1) {
+        col[page0 * WIDTH] |= topMask & bottomMask;
+        return;
+    }
+    col[page0 * WIDTH] |= topMask;
+    for (int page = page0 + 1; page < page1; page++) col[page * WIDTH] = 0xFF;
+    col[page1 * WIDTH] |= bottomMask;
+}
+
+void PageChart::dottedHLine(uint8_t* buf, int x0, int x1, int y, int step) {
+    if (y < 0 || y >= HEIGHT || step < 1) return;
+    if (x0 < 0) x0 += ((-x0 + step - 1) / step) * step;
+    if (x1 >= WIDTH) x1 = WIDTH - 1;
+
+    uint8_t* row = buf + (y >> 3) * WIDTH;
+    uint8_t bit = 1 << (y & 7);
+    for (int x = x0; x <= x1; x += step) row[x] |= bit;
+}
+
+void PageChart::dottedVLine(uint8_t* buf, int x, int y0, int y1, int step) {
+    if (x < 0 || x >= WIDTH || step < 1) return;
+    if (y0 < 0) y0 += ((-y0 + step - 1) / step) * step;
+    if (y1 >= HEIGHT) y1 = HEIGHT - 1;
+
+    for (int y = y0; y <= y1; y += step) buf[(y >> 3) * WIDTH + x] |= 1 << (y & 7);
+}
+
+int PageChart::valueY(int y, int h, uint8_t value, int scale) {
+    if (scale < 1) scale = 1;
+    int v = value < scale ? value : scale;
+    return y + h - 1 - v * (h - 1) / scale;
+}
+
+void PageChart::bars(uint8_t* buf, int x, int y, int h, const uint8_t* values, int count, int scale, int barWidth, int gap) {
+    int bottom = y + h - 1;
+    for (int i = 0; i < count; i++) {
+        if (values[i] == 0) continue;
+        int top = valueY(y, h, values[i], scale);
+        int bx = x + i * (barWidth + gap);
+        for (int c = 0; c < barWidth; c++) column(buf, bx + c, top, bottom);
+    }
+}
+
+void PageChart::area(uint8_t* buf, int x, int y, int h, const uint8_t* values, int count, int scale) {
+    int bottom = y + h - 1;
+    for (int i = 0; i < count; i++) column(buf, x + i, valueY(y, h, values[i], scale), bottom);
+}
+
+void PageChart::sparkline(uint8_t* buf, int x, int y, int h, const uint8_t* values, int count, int scale) {
+    if (count <= 0) return;
+
+    int prev = valueY(y, h, values[0], scale);
+    int cur = prev;
+    for (int i = 0; i < count; i++) {
+        int next = i + 1 < count ? valueY(y, h, values[i + 1], scale) : cur;
+
+        // Halfway points towards both neighbours; the division truncates towards this point
+        int toPrev = cur + (prev - cur) / 2;
+        int toNext = cur + (next - cur) / 2;
+        int top = cur, bottom = cur;
+        if (toPrev < top) top = toPrev;
+        if (toNext < top) top = toNext;
+        if (toPrev > bottom) bottom = toPrev;
+        if (toNext > bottom) bottom = toNext;
+        column(buf, x + i, top, bottom);
+
+        prev = cur;
+        cur = next;
+    }
+}
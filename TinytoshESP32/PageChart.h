@@ -0,0 +1,39 @@
+#ifndef PAGE_CHART_H
+#define PAGE_CHART_H
+
+#include <Arduino.h>
+
+// Chart primitives that write straight into the SSD1306 frame buffer. The
+// buffer is page-major: byte (page * WIDTH + x) holds pixels y = page * 8 ..
+// page * 8 + 7 of column x, lowest bit on top. Everything here is built on
+// column spans, so a column costs at most one masked OR per page it touches
+// instead of one drawPixel() call per pixel.
+//
+// Values are 0..scale and map onto a box whose bottom row is the value 0.
+// Everything is clipped to the screen; pixels are only ever set.
+class PageChart {
+public:
+    static const int WIDTH = 128;
+    static const int HEIGHT = 64;
+
+    // Sets pixels y0..y1 (inclusive, either order) of column x
+    static void column(uint8_t* buf, int x, int y0, int y1);
+
+    // One pixel every `step` columns along row y, from x0 to x1 inclusive
+    static void dottedHLine(uint8_t* buf, int x0, int x1, int y, int step = 2);
+    // One pixel every `step` rows down column x, from y0 to y1 inclusive
+    static void dottedVLine(uint8_t* buf, int x, int y0, int y1, int step = 2);
+
+    // Bars of barWidth columns, `gap` columns apart, rising from the box bottom
+    static void bars(uint8_t* buf, int x, int y, int h, const uint8_t* values, int count, int scale, int barWidth = 1, int gap = 0);
+    // One column per value, filled from the value down to the box bottom
+    static void area(uint8_t* buf, int x, int y, int h, const uint8_t* values, int count, int scale);
+    // One column per value. Each column spans from its point halfway to each
+    // neighbour, which joins the points the way a one-pixel line would
+    static void sparkline(uint8_t* buf, int x, int y, int h, const uint8_t* values, int count, int scale);
+
+private:
+    static int valueY(int y, int h, uint8_t value, int scale);
+};
+
+#endif
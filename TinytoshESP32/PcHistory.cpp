@@ -0,0 +1,56 @@
+#include "PcHistory.h"
+
+const uint16_t PcHistory::TIER_SECONDS[PcHistory::NUM_TIERS] = {1, 10, 60};
+const char* const PcHistory::METRIC_KEYS[PcHistory::NUM_METRICS] = {"cpu", "mem", "disk", "net"};
+
+static uint8_t quantize(float value, float step) {
+    if (isnan(value) || value <= 0) return 0;
+    float steps = roundf(value / step);
+    return steps >= 255 ? 255 : (uint8_t)steps;
+}
+
+void PcHistory::record(float cpu, float mem, float disk, float netKb) {
+    uint8_t values[NUM_METRICS] = {
+        quantize(cpu, 1), quantize(mem, 1), quantize(disk, 1), quantize(netKb, NET_KB_PER_STEP)
+    };
+    push(TIER_1S, values);
+    version++;
+}
+
+void PcHistory::push(int tier, const uint8_t* values) {
+    for (int m = 0; m < NUM_METRICS; m++) rings[tier][m].push(values[m]);
+
+    int next = tier + 1;
+    if (next >= NUM_TIERS) return;
+
+    for (int m = 0; m < NUM_METRICS; m++) pending[next][m] += values[m];
+    int ratio = TIER_SECONDS[next] / TIER_SECONDS[tier];
+    if (++pendingCount[next] < ratio) return;
+
+    uint8_t averaged[NUM_METRICS];
+    for (int m = 0; m < NUM_METRICS; m++) {
+        averaged[m] = (pending[next][m] + ratio / 2) / ratio;
+        pending[next][m] = 0;
+    }
+    pendingCount[next] = 0;
+    push(next, averaged);
+}
+
+void PcHistory::writeJson(Print& out) const {
+    out.printf("{\"net_kb_per_step\":%u,\"tiers\":[", NET_KB_PER_STEP);
+    for (int t = 0; t < NUM_TIERS; t++) {
+        if (t) out.print(',');
+        out.printf("{\"interval_s\":%u", TIER_SECONDS[t]);
+        for (int m = 0; m < NUM_METRICS; m++) {
+            const MetricRing& ring = rings[t][m];
+            out.printf(",\"%s\":{\"min\":%u,\"max\":%u,\"samples\":[", METRIC_KEYS[m], ring.min, ring.max);
+            for (int i = 0; i < ring.count; i++) {
+                if (i) out.print(',');
+                out.print(ring.at(i));
+            }
+            out.print("]}");
+        }
+        out.print('}');
+    }
+    out.print("]}");
+}
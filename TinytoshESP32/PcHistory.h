@@ -0,0 +1,35 @@
+#ifndef PC_HISTORY_H
+#define PC_HISTORY_H
+
+#include <Arduino.h>
+#include "HistoryRing.h"
+
+// PC metrics at three resolutions. The 1 s tier is fed directly; every 10
+// samples of it are averaged into the 10 s tier, and every 6 of those into
+// the 1 min tier, so the rings cover about 2 minutes, 21 minutes and 2 hours.
+struct PcHistory {
+    enum Metric { CPU, MEM, DISK, NET, NUM_METRICS };
+    enum Tier { TIER_1S, TIER_10S, TIER_1M, NUM_TIERS };
+    typedef HistoryRing<uint8_t, 128> MetricRing;     // one sample per display column
+
+    static const uint16_t TIER_SECONDS[NUM_TIERS];
+    static const char* const METRIC_KEYS[NUM_METRICS];
+    // Percentages are stored as-is (0-100); download in steps of this many KB/s
+    static const uint16_t NET_KB_PER_STEP = 32;
+
+    MetricRing rings[NUM_TIERS][NUM_METRICS];
+    unsigned long last_sample = 0;
+    unsigned long version = 0;
+
+    void record(float cpu, float mem, float disk, float netKb);
+    void writeJson(Print& out) const;
+
+private:
+    // Running sums for the sample of the next tier up
+    uint16_t pending[NUM_TIERS][NUM_METRICS] = {{0}};
+    uint8_t pendingCount[NUM_TIERS] = {0};
+
+    void push(int tier, const uint8_t* values);
+};
+
+#endif
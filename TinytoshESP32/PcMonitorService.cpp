@@ -1,268 +1,434 @@
 #include <HardwareSerial.h>
 #include "PcMonitorService.h"
+#include "ConfigSchema.h"
 
 bool PcMonitorService::handleSerial(AppState &state) {
     bool configUpdated = false;
+    uint8_t consumed = 0;
 
-    while (Serial.available()) {
-        String incoming = Serial.readStringUntil('\n');
-        incoming.trim();
-        
-        if (incoming.length() > 0) {
-            if (incoming == "GET_UPDATE") {
-                sendUpdateOverSerial(state);
-            } 
-            else if (incoming.startsWith("SAVE_CFG:")) {
-                if (parseConfigJson(incoming.substring(9).c_str(), state)) {
-                    configUpdated = true;
-                }
-            } 
-            else if (incoming.startsWith("{")) {
-                parseJson(incoming.c_str(), state);
+    // Bounded, non-blocking drain: only bytes already in the driver's RX ring
+    // are taken, at most READ_BUDGET per call, so loop() never waits on the
+    // port. Leftovers are picked up on the next pass.
+    size_t budget = READ_BUDGET;
+    uint8_t chunk[READ_CHUNK_SIZE];
+    while (budget > 0) {
+        int available = Serial.available();
+        if (available <= 0) break;
+        size_t wanted = min((size_t)available, min(budget, sizeof(chunk)));
+        size_t count = Serial.read(chunk, wanted);
+        if (count == 0) break;
+        budget -= count;
+
+        for (size_t i = 0; i < count; i++) {
+            uint8_t c = chunk[i];
+
+            if (c == 0) {
+                // Frame delimiter. Whatever sat between two of them and fails to
+                // decode (log noise, a torn frame) is dropped.
+                inFrame = true;
+                if (rxLength > 0 && !rxOverflow && handleFrame(state, configUpdated) && consumed < 255) consumed++;
+                rxLength = 0;
+                rxOverflow = false;
+                continue;
             }
+
+            if (c == '\n' && !framed && !inFrame) {
+                if (!rxOverflow) handleLine(state, configUpdated);
+                rxLength = 0;
+                rxOverflow = false;
+                continue;
+            }
+
+            if (rxLength < RX_BUFFER_SIZE) rxBuffer[rxLength++] = c;
+            else rxOverflow = true;
         }
     }
 
-    if (millis() - state.pc.last_update > DATA_TIMEOUT_MS) {
-        state.pc.cpu_percent = 0;
-        state.pc.net_down_kb = 0;
-        state.pc.mem_percent = 0;
-        state.pc.disk_percent = 0;
+    if (consumed > 0) SerialFrame::send(Serial, SerialFrame::CREDIT, 0, &consumed, 1);
+
+    if (framed && millis() - lastFrameMs > FRAMED_IDLE_MS) {
+        // Bridge went away or an older one took over the port
+        framed = false;
+        inFrame = false;
+        rxLength = 0;
     }
 
-    if (millis() - state.media.last_update > DATA_TIMEOUT_MS) {
-        state.media.status = "stopped";
-        state.media.name = "";
-        state.media.author = "";
-        state.media.album = "";
+    updateView(state);
+
+    if (millis() - state.media.last_update > HOST_TIMEOUT_MS) {
+        if (state.media.status != "stopped" || state.media.name.length() > 0 || state.media.author.length() > 0 || state.media.album.length() > 0) {
+            state.media.status = "stopped";
+            state.media.name = "";
+            state.media.author = "";
+            state.media.album = "";
+            state.media.version++;
+        }
     }
 
     return configUpdated;
 }
 
-void PcMonitorService::parseJson(const char* jsonString, AppState &state) {
-    DynamicJsonDocument doc(1024); 
-    DeserializationError error = deserializeJson(doc, jsonString);
+void PcMonitorService::handleLine(AppState &state, bool &configUpdated) {
+    // Trimmed in place; the JSON parsers below read straight from rxBuffer
+    char* line = rxBuffer;
+    size_t length = rxLength;
+    while (length > 0 && isspace((unsigned char)line[length - 1])) length--;
+    while (length > 0 && isspace((unsigned char)*line)) { line++; length--; }
+    line[length] = '\0';
 
-    if (!error) {
-        state.pc.cpu_percent = doc["cpu_percent"] | 0.0;
-        state.pc.mem_percent = doc["mem_percent"] | 0.0;
-        state.pc.disk_percent = doc["disk_percent"] | 0.0;
-        state.pc.net_down_kb = doc["net_down_kb"] | 0.0;
-        
-        state.media.status = doc["media_status"] | "stopped";
-        state.media.name = doc["media_name"] | "";
-        state.media.author = doc["media_author"] | "";
-        state.media.album = doc["media_album"] | "";
-        
-        String incoming_id = doc["pc_id"] | "";
-        if (incoming_id != "") {
-            state.config.active_pc_id = incoming_id;
+    if (length == 0) return;
+
+    if (strcmp(line, "GET_UPDATE") == 0) {
+        sendUpdateOverSerial(state, false, 0, 0);
+    } 
+    else if (strncmp(line, "GET_UPDATE:", 11) == 0) {
+        // GET_UPDATE:<rev>:<boot> asks only for the keys changed after that revision of that boot
+        char* end;
+        uint32_t since = strtoul(line + 11, &end, 10);
+        uint32_t boot = (*end == ':') ? strtoul(end + 1, nullptr, 10) : 0;
+        sendUpdateOverSerial(state, true, since, boot);
+    } 
+    else if (strcmp(line, "GET_METRICS") == 0) {
+        sendMetricsOverSerial();
+    } 
+    else if (strncmp(line, "SAVE_CFG:", 9) == 0) {
+        if (parseConfigJson(line + 9, length - 9, state)) {
+            configUpdated = true;
         }
-        
-        unsigned long current_time = millis();
-        state.pc.last_update = current_time; 
-        state.media.last_update = current_time;
+    } 
+    else if (line[0] == '{') {
+        parseJson(line, length, state);
     }
 }
 
-void PcMonitorService::sendUpdateOverSerial(AppState &state) {
-    DynamicJsonDocument doc(3072);
-    Config& config = state.config;
+// Returns true when the frame used up one of the bridge's credits
+bool PcMonitorService::handleFrame(AppState &state, bool &configUpdated) {
+    uint8_t* frame = (uint8_t*)rxBuffer;
+    size_t length = SerialFrame::decode(frame, rxLength);
+    if (length < 2) return false;
 
-    // Pack Global Settings
-    doc["device_id"] = config.device_id;
-    doc["ip_address"] = config.ip_address;
-    doc["refresh_min"] = config.refresh_interval_min;
-    doc["auto_cycle"] = config.screen_auto_cycle ? 1 : 0;
-    doc["screen_int"] = config.screen_interval_sec;
-    doc["anim_mask"] = config.anim_mask;
-    doc["time_format"] = config.time_format;
-
-    // Pack Location & Night Mode
-    doc["auto_detect"] = config.auto_detect ? 1 : 0;
-    doc["city"] = config.city;
-    doc["latitude"] = config.latitude;
-    doc["longitude"] = config.longitude;
-    doc["timezone"] = config.timezone;
-    doc["night_mode"] = config.night_mode ? 1 : 0;
-    doc["night_start"] = config.night_start;
-    doc["night_end"] = config.night_end;
-    doc["night_action"] = config.night_action;
-
-    // Pack Screen Toggles
-    doc["show_time"] = config.show_time ? 1 : 0;
-    doc["date_display"] = config.date_display ? 1 : 0;
-    doc["show_weather"] = config.show_weather ? 1 : 0;
-    doc["temp_unit"] = config.temp_unit;
-    doc["round_temps"] = config.round_temps ? 1 : 0;
-    doc["show_aqi"] = config.show_aqi ? 1 : 0;
-    doc["aqi_type"] = config.aqi_type;
-    doc["show_pc"] = config.show_pc ? 1 : 0;
-    doc["show_stock"] = config.show_stock ? 1 : 0;
-    doc["stock_symbol"] = config.stock_symbol;
-    doc["stock_fn"] = config.stock_fn ? 1 : 0;
-    doc["show_crypto"] = config.show_crypto ? 1 : 0;
-    doc["crypto_id"] = config.crypto_id;
-    doc["crypto_fn"] = config.crypto_fn ? 1 : 0;
-    doc["show_currency"] = config.show_currency ? 1 : 0;
-    doc["currency_base"] = config.currency_base;
-    doc["currency_target"] = config.currency_target;
-    doc["currency_multiplier"] = config.currency_multiplier;
-    doc["currency_fn"] = config.currency_fn ? 1 : 0;
-    doc["show_media"] = config.show_media ? 1 : 0;
-    doc["hide_empty_pc"] = config.hide_empty_pc ? 1 : 0;
-    doc["hide_empty_media"] = config.hide_empty_media ? 1 : 0;
-
-    String orderStr = "";
-    for(int i = 0; i < NUM_SCREENS; i++) {
-        orderStr += String(config.screen_order[i]);
-        if(i < NUM_SCREENS - 1) orderStr += ",";
+    uint8_t type = frame[0];
+    uint8_t id = frame[1];
+    uint8_t* payload = frame + 2;
+    size_t payloadLength = length - 2;
+
+    if (type == SerialFrame::HELLO) {
+        // A bridge still on lines may retry HELLO while this one was queued during setup,
+        // so lines keep working until the first other frame shows it switched over
+        handleHello(id, payload, payloadLength);
+        if (!framed) inFrame = false;
+        return false;
     }
-    doc["screen_order"] = orderStr;
 
-    WeatherData& weather = state.weather;
-    AirQualityData& aqi = state.aqi;
-    CryptoData& crypto = state.crypto;
-    CurrencyData& currency = state.currency;
-    StockData& stock = state.stock;
-    PcStats& pc = state.pc;
-    PcMedia& media = state.media;
-
-    doc["update_time"] = weather.update_time;
-    if (!isnan(weather.temp)) {
-        doc["temp"] = String(weather.temp, 1);
-        doc["apparent_temperature"] = String(weather.apparent_temperature, 1);
-        doc["humidity"] = String(weather.humidity);
-        doc["wind_speed"] = String(weather.wind_speed, 1);
-        doc["temp_unit"] = config.temp_unit;
+    framed = true;
+    lastFrameMs = millis();
+
+    switch (type) {
+        case SerialFrame::TELEMETRY:
+            parseJson((char*)payload, payloadLength, state);
+            break;
+
+        case SerialFrame::GET_UPDATE: {
+            if (serializer == nullptr) break;
+            FrameWriter reply;
+            if (payloadLength >= 8) serializer->writeDelta(state, SerialFrame::readU32(payload), SerialFrame::readU32(payload + 4), reply);
+            else serializer->write(state, reply);
+            reply.send(Serial, SerialFrame::UPDATE, id);
+            break;
+        }
+
+        case SerialFrame::SAVE_CFG: {
+            uint8_t applied = parseConfigJson((char*)payload, payloadLength, state) ? 1 : 0;
+            if (applied) configUpdated = true;
+            SerialFrame::send(Serial, SerialFrame::ACK, id, &applied, 1);
+            break;
+        }
+
+        case SerialFrame::GET_METRICS: {
+            if (metrics == nullptr) break;
+            FrameWriter reply;
+            metrics->writeJson(reply);
+            reply.send(Serial, SerialFrame::METRICS, id);
+            break;
+        }
     }
+    return true;
+}
 
-    if (!isnan(aqi.pm25) && !isnan(aqi.pm10) && !isnan(aqi.no2)) {
-        doc["aqi"] = String(aqi.aqi);
-        doc["aqi_status"] = aqi.status;
-        doc["pm25"] = String(aqi.pm25, 1);
-        doc["pm10"] = String(aqi.pm10, 1);
-        doc["no2"] = String(aqi.no2, 1);
+void PcMonitorService::handleHello(uint8_t id, const uint8_t* payload, size_t length) {
+    uint32_t baud = 0;
+#if !ARDUINO_USB_CDC_ON_BOOT
+    // Only a UART bridge chip can change speed; native USB CDC ignores the
+    // line rate, so it answers 0 and the bridge keeps its port settings
+    if (length >= 5) {
+        uint32_t requested = SerialFrame::readU32(payload + 1);
+        if (requested >= MIN_BAUD && requested <= MAX_BAUD) baud = requested;
     }
+#endif
+
+    uint8_t reply[9];
+    reply[0] = SerialFrame::VERSION;
+    reply[1] = SerialFrame::CREDITS;
+    reply[2] = SerialFrame::MAX_FRAME & 0xFF;
+    reply[3] = SerialFrame::MAX_FRAME >> 8;
+    SerialFrame::writeU32(reply + 4, baud);
+    reply[8] = SerialFrame::FEATURE_TELEMETRY_DELTA;
+    SerialFrame::send(Serial, SerialFrame::HELLO, id, reply, sizeof(reply));
 
-    if (!isnan(crypto.price_usd) && crypto.price_usd > 0) {
-        doc["crypto_price"] = String(crypto.price_usd);
-        doc["crypto_change"] = String(crypto.percent_change_24h);
+#if !ARDUINO_USB_CDC_ON_BOOT
+    if (baud > 0) {
+        Serial.flush();
+        Serial.updateBaudRate(baud);
     }
+#endif
+}
+
+void PcMonitorService::setMetrics(MetricsService* metricsService) {
+    metrics = metricsService;
+}
+
+void PcMonitorService::setStateSerializer(StateSerializer* stateSerializer) {
+    serializer = stateSerializer;
+}
+
+void PcMonitorService::sendMetricsOverSerial() {
+    if (metrics == nullptr) return;
+
+    Serial.print("SYS_METRICS:");
+    metrics->writeJson(Serial);
+    Serial.println();
+}
 
-    if (currency.updated) {
-        float displayRate = currency.rate * config.currency_multiplier;
-        int decimals = (displayRate < 10.0) ? 3 : ((displayRate < 100.0) ? 2 : 1);
-        doc["currency_base_text"] = String(config.currency_multiplier) + " " + currency.base;
-        doc["currency_target_text"] = String(displayRate, decimals) + " " + currency.target;
+// Assigns only when the text differs, so a steady stream of identical samples
+// neither reallocates the String nor counts as a change
+static bool assignIfChanged(String& target, const char* value) {
+    if (target == value) return false;
+    target = value;
+    return true;
+}
+
+void PcMonitorService::parseJson(char* json, size_t length, AppState &state) {
+    // Parsing a mutable buffer is zero-copy: strings in the document point into
+    // `json`, and the fixed-size document lives on the stack
+    StaticJsonDocument<TELEMETRY_JSON_CAPACITY> doc;
+    DeserializationError error = deserializeJson(doc, json, length);
+
+    if (!error) {
+        // Bridges always send pc_id; anything older is treated as one anonymous USB host
+        const char* pcId = doc["pc_id"] | "usb";
+        applyTelemetry(state, pcId, doc.as<JsonVariantConst>());
     }
+}
 
-    if (stock.updated) {
-        doc["stock_symbol"] = stock.symbol;
-        doc["stock_price"] = String(stock.price, 2);
-        doc["stock_change"] = String(stock.percent_change, 2);
+uint32_t PcMonitorService::hashId(const char* id) {
+    uint32_t hash = 2166136261u;
+    while (*id) {
+        hash ^= (uint8_t)*id++;
+        hash *= 16777619u;
     }
+    return hash ? hash : 1;     // 0 marks a free slot
+}
+
+PcHost* PcMonitorService::findHost(PcHosts &hosts, const char* pcId) {
+    uint32_t hash = hashId(pcId);
+    unsigned long now = millis();
+    PcHost* victim = nullptr;
 
-    if (pc.cpu_percent > 0.1) {
-        doc["pc_cpu"] = String(pc.cpu_percent);
-        doc["pc_net"] = String(pc.net_down_kb);
-        doc["pc_ram"] = String(pc.mem_percent);
-        doc["pc_disk"] = String(pc.disk_percent);
+    // The table has a fixed handful of slots, so this scan is constant-time
+    for (PcHost& host : hosts.slots) {
+        if (host.id_hash == hash && strncmp(host.id, pcId, PC_ID_LEN - 1) == 0) return &host;
+
+        // A new PC takes a free slot, else evicts the one heard from least recently
+        if (victim == nullptr || (victim->id_hash != 0 &&
+            (host.id_hash == 0 || now - host.stats.last_update > now - victim->stats.last_update))) {
+            victim = &host;
+        }
     }
+
+    if (victim->id_hash != 0 && hosts.media_owner == victim->id_hash) hosts.media_owner = 0;
+    strlcpy(victim->id, pcId, PC_ID_LEN);
+    victim->id_hash = hash;
+    victim->stats = PcStats{0.0, 0.0, 0.0, 0.0};
+    victim->stats.last_update = now;
+    hosts.version++;
+    return victim;
+}
+
+// In a delta sample an absent key means "unchanged"; in a keyframe it falls back to the default
+static void applyNumber(float& target, JsonVariantConst value, bool delta) {
+    if (value.isNull()) {
+        if (!delta) target = 0;
+        return;
+    }
+    target = value.as<float>();
+}
+
+static bool applyText(String& target, JsonVariantConst value, bool delta, const char* fallback) {
+    if (value.isNull() && delta) return false;
+    return assignIfChanged(target, value | fallback);
+}
+
+void PcMonitorService::applyTelemetry(AppState &state, const char* pcId, JsonVariantConst doc) {
+    // "delta":1 samples carry only the fields that changed; the bridge sends a
+    // full keyframe every few samples so a lost delta doesn't stick
+    bool delta = doc["delta"] | 0;
+    unsigned long current_time = millis();
+
+    PcHost* host = findHost(state.pc_hosts, pcId);
+    PcStats& stats = host->stats;
+    applyNumber(stats.cpu_percent, doc["cpu_percent"], delta);
+    applyNumber(stats.mem_percent, doc["mem_percent"], delta);
+    applyNumber(stats.disk_percent, doc["disk_percent"], delta);
+    applyNumber(stats.net_down_kb, doc["net_down_kb"], delta);
+    stats.last_update = current_time;
+    stats.version++;
+
+    // The media screen follows one PC. Another PC takes it over only when it
+    // is playing and the current one is not (or has gone quiet).
+    PcHosts& hosts = state.pc_hosts;
+    if (hosts.media_owner != host->id_hash) {
+        const char* status = doc["media_status"] | "";
+        bool playing = status[0] != '\0' && strcmp(status, "stopped") != 0;
+        bool ownerIdle = state.media.status == "stopped" || current_time - state.media.last_update > HOST_TIMEOUT_MS;
+        if (hosts.media_owner != 0 && !(playing && ownerIdle)) return;
+        hosts.media_owner = host->id_hash;
+    }
+
+    bool mediaChanged = applyText(state.media.status, doc["media_status"], delta, "stopped");
+    mediaChanged |= applyText(state.media.name, doc["media_name"], delta, "");
+    mediaChanged |= applyText(state.media.author, doc["media_author"], delta, "");
+    mediaChanged |= applyText(state.media.album, doc["media_album"], delta, "");
     
-    if (media.status.length() > 0) {
-        doc["media_status"] = media.status;
-        doc["media_name"] = media.name;
-        doc["media_author"] = media.author;
-        doc["media_album"] = media.album;
+    state.media.last_update = current_time;
+    if (mediaChanged) state.media.version++;
+}
+
+void PcMonitorService::updateView(AppState &state) {
+    PcHosts& hosts = state.pc_hosts;
+    unsigned long now = millis();
+
+    int live = 0;
+    unsigned long latest = 0;
+    for (PcHost& host : hosts.slots) {
+        if (host.id_hash == 0) continue;
+        if (now - host.stats.last_update > HOST_TIMEOUT_MS) {
+            if (hosts.media_owner == host.id_hash) hosts.media_owner = 0;
+            host.id_hash = 0;
+            host.id[0] = '\0';
+            hosts.version++;
+            continue;
+        }
+        if (live == 0 || (long)(host.stats.last_update - latest) > 0) latest = host.stats.last_update;
+        live++;
+    }
+
+    // Combined: average load across PCs, total download
+    PcStats combined = {0.0, 0.0, 0.0, 0.0};
+    for (const PcHost& host : hosts.slots) {
+        if (host.id_hash == 0) continue;
+        combined.cpu_percent += host.stats.cpu_percent / live;
+        combined.mem_percent += host.stats.mem_percent / live;
+        combined.disk_percent += host.stats.disk_percent / live;
+        combined.net_down_kb += host.stats.net_down_kb;
     }
 
-    String activeId = config.active_pc_id;
-    int lastDashSync = activeId.lastIndexOf(':');
-    if (lastDashSync > 3) activeId = activeId.substring(0, lastDashSync);
-    bool isPcPaired = (activeId != "" && (millis() - pc.last_update < 5000));
-    doc["pc_status"] = isPcPaired ? ("🔒 Paired to " + activeId) : "";
+    PcHistory& history = state.pc_history;
+    if (live > 0 && now - history.last_sample >= 1000) {
+        // Step by whole seconds so the 1 s tier doesn't drift with loop timing
+        history.last_sample = now - history.last_sample < 2000 ? history.last_sample + 1000 : now;
+        history.record(combined.cpu_percent, combined.mem_percent, combined.disk_percent, combined.net_down_kb);
+    }
+
+    PcStats view = {0.0, 0.0, 0.0, 0.0};
+    bool switched = false;
+
+    if (live > 0 && state.config.pc_multi == 1) {
+        view = combined;
+    } else if (live > 0) {
+        bool shownGone = hosts.shown < 0 || hosts.slots[hosts.shown].id_hash == 0;
+        if (shownGone || (live > 1 && now - hosts.rotated_at > HOST_ROTATE_MS)) {
+            for (int i = 1; i <= MAX_PC_HOSTS; i++) {
+                int next = (hosts.shown + i + MAX_PC_HOSTS) % MAX_PC_HOSTS;
+                if (hosts.slots[next].id_hash != 0) {
+                    switched = next != hosts.shown;
+                    hosts.shown = next;
+                    break;
+                }
+            }
+            hosts.rotated_at = now;
+        }
+        view = hosts.slots[hosts.shown].stats;
+    }
+
+    PcStats& pc = state.pc;
+    if (live > 0) pc.last_update = latest;
+    if (switched || view.cpu_percent != pc.cpu_percent || view.mem_percent != pc.mem_percent ||
+        view.disk_percent != pc.disk_percent || view.net_down_kb != pc.net_down_kb) {
+        pc.cpu_percent = view.cpu_percent;
+        pc.mem_percent = view.mem_percent;
+        pc.disk_percent = view.disk_percent;
+        pc.net_down_kb = view.net_down_kb;
+        pc.version++;
+    }
+}
+
+int PcMonitorService::liveHosts(const AppState &state) {
+    int live = 0;
+    for (const PcHost& host : state.pc_hosts.slots) {
+        if (host.id_hash != 0) live++;
+    }
+    return live;
+}
+
+String PcMonitorService::describeHosts(const AppState &state) {
+    const PcHosts& hosts = state.pc_hosts;
+    const PcHost* named = nullptr;
+    if (hosts.shown >= 0 && hosts.slots[hosts.shown].id_hash != 0) named = &hosts.slots[hosts.shown];
+    for (const PcHost& host : hosts.slots) {
+        if (named == nullptr && host.id_hash != 0) named = &host;
+    }
+    if (named == nullptr) return "";
+
+    // Bridge ids are "pc-xxxx:<pid>"; the pid only tells app restarts apart
+    String name = named->id;
+    int lastColon = name.lastIndexOf(':');
+    if (lastColon > 3) name = name.substring(0, lastColon);
+
+    String text = "🔗 Connected to " + name;
+    int live = liveHosts(state);
+    if (live > 1) text += " +" + String(live - 1);
+    return text;
+}
+
+void PcMonitorService::sendUpdateOverSerial(AppState &state, bool delta, uint32_t since, uint32_t boot) {
+    if (serializer == nullptr) return;
 
-    String jsonResponse;
-    serializeJson(doc, jsonResponse);
     Serial.print("SYS_UPDATE:");
-    Serial.println(jsonResponse);
+    if (delta) serializer->writeDelta(state, since, boot, Serial);
+    else serializer->write(state, Serial);
+    Serial.println();
 }
 
-bool PcMonitorService::parseConfigJson(const char* jsonString, AppState &state) {
+bool PcMonitorService::parseConfigJson(char* json, size_t length, AppState &state) {
+    // Rare and larger than telemetry, so this one stays on the heap; the input is still parsed in place
     DynamicJsonDocument doc(2048);
-    DeserializationError error = deserializeJson(doc, jsonString);
+    DeserializationError error = deserializeJson(doc, json, length);
     
     if (error) {
-        Serial.println("SYS_MSG:Failed to parse incoming config");
+        if (!framed) Serial.println("SYS_MSG:Failed to parse incoming config");
         return false;
     }
 
+    // Unknown keys are skipped, so older or newer PC apps can still send theirs
     Config& config = state.config;
-
-    if (doc.containsKey("refresh_min")) config.refresh_interval_min = doc["refresh_min"];
-    if (doc.containsKey("auto_cycle")) config.screen_auto_cycle = doc["auto_cycle"] == 1;
-    if (doc.containsKey("screen_int")) config.screen_interval_sec = doc["screen_int"];
-    if (doc.containsKey("anim_mask")) config.anim_mask = doc["anim_mask"];
-    if (doc.containsKey("time_format")) config.time_format = doc["time_format"].as<String>();
-    
-    if (doc.containsKey("auto_detect")) config.auto_detect = doc["auto_detect"] == 1;
-    if (doc.containsKey("city")) config.city = doc["city"].as<String>();
-    if (doc.containsKey("latitude")) config.latitude = doc["latitude"].as<float>();
-    if (doc.containsKey("longitude")) config.longitude = doc["longitude"].as<float>();
-    if (doc.containsKey("timezone")) config.timezone = doc["timezone"].as<String>();
-
-    if (doc.containsKey("night_mode")) config.night_mode = doc["night_mode"] == 1;
-    if (doc.containsKey("night_start")) config.night_start = doc["night_start"].as<String>();
-    if (doc.containsKey("night_end")) config.night_end = doc["night_end"].as<String>();
-    if (doc.containsKey("night_action")) config.night_action = doc["night_action"];
-
-    if (doc.containsKey("show_time")) config.show_time = doc["show_time"] == 1;
-    if (doc.containsKey("date_display")) config.date_display = doc["date_display"] == 1;
-    if (doc.containsKey("show_weather")) config.show_weather = doc["show_weather"] == 1;
-    if (doc.containsKey("temp_unit")) config.temp_unit = doc["temp_unit"].as<String>();
-    if (doc.containsKey("round_temps")) config.round_temps = doc["round_temps"] == 1;
-    if (doc.containsKey("show_aqi")) config.show_aqi = doc["show_aqi"] == 1;
-    if (doc.containsKey("aqi_type")) config.aqi_type = doc["aqi_type"].as<String>();
-    
-    if (doc.containsKey("show_pc")) config.show_pc = doc["show_pc"] == 1;
-    if (doc.containsKey("show_stock")) config.show_stock = doc["show_stock"] == 1;
-    if (doc.containsKey("stock_symbol")) config.stock_symbol = doc["stock_symbol"].as<String>();
-    if (doc.containsKey("stock_fn")) config.stock_fn = doc["stock_fn"] == 1;
-    
-    if (doc.containsKey("show_crypto")) config.show_crypto = doc["show_crypto"] == 1;
-    if (doc.containsKey("crypto_id")) config.crypto_id = doc["crypto_id"].as<int>();
-    if (doc.containsKey("crypto_fn")) config.crypto_fn = doc["crypto_fn"] == 1;
-    
-    if (doc.containsKey("show_currency")) config.show_currency = doc["show_currency"] == 1;
-    if (doc.containsKey("currency_base")) config.currency_base = doc["currency_base"].as<String>();
-    if (doc.containsKey("currency_target")) config.currency_target = doc["currency_target"].as<String>();
-    if (doc.containsKey("currency_multiplier")) config.currency_multiplier = doc["currency_multiplier"];
-    if (doc.containsKey("currency_fn")) config.currency_fn = doc["currency_fn"] == 1;
-
-    if (doc.containsKey("show_media")) config.show_media = doc["show_media"] == 1;
-    
-    if (doc.containsKey("hide_empty_pc")) config.hide_empty_pc = doc["hide_empty_pc"] == 1;
-    if (doc.containsKey("hide_empty_media")) config.hide_empty_media = doc["hide_empty_media"] == 1;
-
-    if (doc.containsKey("screen_order")) {
-        String orderStr = doc["screen_order"].as<String>();
-        int idx = 0;
-        int startPos = 0;
-        while (startPos < orderStr.length() && idx < NUM_SCREENS) {
-            int commaPos = orderStr.indexOf(',', startPos);
-            if (commaPos == -1) {
-                config.screen_order[idx++] = orderStr.substring(startPos).toInt();
-                break;
-            } else {
-                config.screen_order[idx++] = orderStr.substring(startPos, commaPos).toInt();
-                startPos = commaPos + 1;
-            }
-        }
+    for (JsonPairConst kv : doc.as<JsonObjectConst>()) {
+        int field = ConfigSchema::find(kv.key().c_str());
+        if (field >= 0) ConfigSchema::fromJson(config, field, kv.value());
     }
 
-    Serial.println("SYS_MSG:Settings Saved Successfully");
+    config.version++;
+
+    if (!framed) Serial.println("SYS_MSG:Settings Saved Successfully");
     return true;
 }
 
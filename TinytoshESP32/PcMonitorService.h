@@ -4,24 +4,68 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include "structs.h"
+#include "MetricsService.h"
+#include "StateSerializer.h"
+#include "SerialFrame.h"
 
+// Talks to the PC bridge over USB serial. Starts in the line protocol
+// (JSON telemetry and GET_UPDATE/SAVE_CFG commands, one per line) and
+// switches to SerialFrame framing once a valid frame arrives.
 class PcMonitorService {
 public:
     bool handleSerial(AppState &state);
+    void setMetrics(MetricsService* metricsService);
+    void setStateSerializer(StateSerializer* stateSerializer);
     const PcStats& getStats() const;
 
+    // Shared by every telemetry transport (USB, POST /pc-stats, UDP); callers hold the state lock.
+    // Every pc_id gets its own slot in state.pc_hosts, and updateView() turns the
+    // slots into state.pc: one PC at a time in rotation, or all of them combined.
+    static void applyTelemetry(AppState &state, const char* pcId, JsonVariantConst doc);
+    static void updateView(AppState &state);
+    static int liveHosts(const AppState &state);
+    // Status line for the web panel, e.g. "🔗 Connected to pc-ab12 +1"
+    static String describeHosts(const AppState &state);
+    // FNV-1a of a pc_id, never 0 so zeroed tables read as empty. Also keys UDP sequence tracking.
+    static uint32_t hashId(const char* id);
+
+    // A PC that sent nothing for this long leaves the table
+    static const unsigned long HOST_TIMEOUT_MS = 5000;
+    static const unsigned long HOST_ROTATE_MS = 5000;
+    static const size_t TELEMETRY_JSON_CAPACITY = 512;
+
 private:
     PcStats currentStats = {0.0, 0.0, 0.0, 0.0};
 
-    static const int JSON_BUF_SIZE = 256;
-    char serialBuffer[JSON_BUF_SIZE];
-    int bufferIndex = 0;
+    // Bytes moved out of the driver's RX ring per handleSerial() call, in READ_CHUNK_SIZE reads
+    static const size_t READ_BUDGET = 1024;
+    static const size_t READ_CHUNK_SIZE = 128;
+
+    // Holds one line or one encoded frame, plus room for a terminator
+    static const size_t RX_BUFFER_SIZE = SerialFrame::MAX_ENCODED;
+    char rxBuffer[RX_BUFFER_SIZE + 1];
+    size_t rxLength = 0;
+    bool rxOverflow = false;
+    bool inFrame = false;       // a 0x00 opened a frame; newlines are frame bytes, not line ends
+    bool framed = false;
+    unsigned long lastFrameMs = 0;
+
+    MetricsService* metrics = nullptr;
+    StateSerializer* serializer = nullptr;
 
-    void sendUpdateOverSerial(AppState &state);
-    void parseJson(const char* jsonString, AppState &state);
-    bool parseConfigJson(const char* jsonString, AppState &state);
+    void handleLine(AppState &state, bool &configUpdated);
+    bool handleFrame(AppState &state, bool &configUpdated);
+    void handleHello(uint8_t id, const uint8_t* payload, size_t length);
+    void sendUpdateOverSerial(AppState &state, bool delta, uint32_t since, uint32_t boot);
+    void sendMetricsOverSerial();
+    void parseJson(char* json, size_t length, AppState &state);
+    bool parseConfigJson(char* json, size_t length, AppState &state);
+    static PcHost* findHost(PcHosts &hosts, const char* pcId);
 
-    const unsigned long DATA_TIMEOUT_MS = 5000;
+    // The bridge sends telemetry every second; after this long without a frame, fall back to lines
+    const unsigned long FRAMED_IDLE_MS = 10000;
+    const uint32_t MIN_BAUD = 115200;
+    const uint32_t MAX_BAUD = 2000000;
 };
 
 #endif
\ No newline at end of file
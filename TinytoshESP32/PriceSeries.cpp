@@ -0,0 +1,38 @@
+#include "PriceSeries.h"
+
+void PriceSeries::clear() {
+    reference = 0;
+    ring.clear();
+}
+
+void PriceSeries::push(float price) {
+    if (isnan(price) || price <= 0) return;
+    if (ring.count == 0 || reference <= 0) {
+        ring.clear();
+        reference = price;
+    }
+
+    float bps = roundf((price / reference - 1.0f) * 10000.0f);
+    if (bps > INT16_MAX) bps = INT16_MAX;
+    if (bps < INT16_MIN) bps = INT16_MIN;
+    ring.push((int16_t)bps);
+}
+
+int PriceSeries::copyScaled(uint8_t* out, int n, int scale) const {
+    if (n > ring.count) n = ring.count;
+    int32_t span = (int32_t)ring.max - ring.min;
+    for (int i = 0; i < n; i++) {
+        int32_t offset = (int32_t)ring.at(ring.count - n + i) - ring.min;
+        out[i] = span > 0 ? (uint8_t)((offset * scale + span / 2) / span) : (uint8_t)(scale / 2);
+    }
+    return n;
+}
+
+int PriceSeries::scaledPrice(float price, int scale) const {
+    if (ring.count == 0 || reference <= 0) return 0;
+    float bps = (price / reference - 1.0f) * 10000.0f;
+    int32_t span = (int32_t)ring.max - ring.min;
+    if (span <= 0) return scale / 2;
+    float pos = (bps - ring.min) * scale / span;
+    return pos < 0 ? 0 : pos > scale ? scale : (int)roundf(pos);
+}
@@ -0,0 +1,26 @@
+#ifndef PRICE_SERIES_H
+#define PRICE_SERIES_H
+
+#include <Arduino.h>
+#include "HistoryRing.h"
+
+// Recent prices for the stock and crypto mini charts, stored as basis points
+// relative to the first price since the last clear(), which covers moves of
+// +-327% in two bytes per sample.
+struct PriceSeries {
+    typedef HistoryRing<int16_t, 96> Ring;
+
+    float reference = 0;
+    Ring ring;
+
+    void clear();
+    void push(float price);
+
+    // Maps the held samples onto 0..scale across their min..max, oldest first;
+    // returns how many were written (at most n)
+    int copyScaled(uint8_t* out, int n, int scale) const;
+    // Where price falls on that same scale, clamped to it
+    int scaledPrice(float price, int scale) const;
+};
+
+#endif
@@ -0,0 +1,97 @@
+#include "SerialFrame.h"
+
+uint16_t SerialFrame::crcUpdate(uint16_t crc, uint8_t b) {
+    crc ^= (uint16_t)b << 8;
+    for (int bit = 0; bit < 8; bit++) {
+        crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+uint16_t SerialFrame::crc16(const uint8_t* data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) crc = crcUpdate(crc, data[i]);
+    return crc;
+}
+
+size_t SerialFrame::decode(uint8_t* data, size_t length) {
+    // The write position never overtakes the read position, so this works in place
+    size_t in = 0;
+    size_t out = 0;
+    while (in < length) {
+        uint8_t code = data[in++];
+        if (code == 0 || in + code - 1 > length) return 0;
+        for (uint8_t i = 1; i < code; i++) data[out++] = data[in++];
+        if (code < 0xFF && in < length) data[out++] = 0;
+    }
+
+    if (out < 4) return 0;
+    uint16_t crc = data[out - 2] | (data[out - 1] << 8);
+    if (crc16(data, out - 2) != crc) return 0;
+    return out - 2;
+}
+
+void SerialFrame::send(Print& out, uint8_t type, uint8_t id, const uint8_t* payload, size_t length) {
+    uint8_t header[2] = {type, id};
+    uint16_t crc = 0xFFFF;
+    std::vector<uint8_t> encoded;
+    encoded.reserve(length + length / 254 + 8);
+
+    encoded.push_back(0);
+    size_t codePos = encoded.size();
+    encoded.push_back(0);
+    uint8_t code = 1;
+
+    auto put = [&](uint8_t b) {
+        if (b != 0) {
+            encoded.push_back(b);
+            if (++code < 0xFF) return;
+        }
+        encoded[codePos] = code;
+        codePos = encoded.size();
+        encoded.push_back(0);
+        code = 1;
+    };
+    auto putChecked = [&](uint8_t b) {
+        crc = crcUpdate(crc, b);
+        put(b);
+    };
+
+    for (uint8_t b : header) putChecked(b);
+    for (size_t i = 0; i < length; i++) putChecked(payload[i]);
+    uint16_t frameCrc = crc;
+    put(frameCrc & 0xFF);
+    put(frameCrc >> 8);
+
+    encoded[codePos] = code;
+    encoded.push_back(0);
+
+    // One write: the serial driver holds its TX lock for the whole call, so
+    // prints from other tasks land before or after the frame, never inside it
+    out.write(encoded.data(), encoded.size());
+}
+
+uint32_t SerialFrame::readU32(const uint8_t* data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+void SerialFrame::writeU32(uint8_t* data, uint32_t value) {
+    data[0] = value & 0xFF;
+    data[1] = (value >> 8) & 0xFF;
+    data[2] = (value >> 16) & 0xFF;
+    data[3] = (value >> 24) & 0xFF;
+}
+
+size_t FrameWriter::write(uint8_t c) {
+    payload.push_back(c);
+    return 1;
+}
+
+size_t FrameWriter::write(const uint8_t* data, size_t len) {
+    payload.insert(payload.end(), data, data + len);
+    return len;
+}
+
+void FrameWriter::send(Print& out, uint8_t type, uint8_t id) {
+    SerialFrame::send(out, type, id, payload.data(), payload.size());
+}
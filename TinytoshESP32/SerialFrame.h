@@ -0,0 +1,64 @@
+#ifndef SERIAL_FRAME_H
+#define SERIAL_FRAME_H
+
+#include <Arduino.h>
+#include <vector>
+
+// Framed USB serial protocol, used once the PC bridge has sent HELLO.
+//
+// On the wire a frame is 0x00, COBS(type, id, payload, crc16 LE), 0x00 with a
+// CRC-16/CCITT-FALSE over type, id and payload. COBS output never contains
+// 0x00 and each frame goes out in one write, so log text printed between
+// frames is dropped by the reader instead of corrupting a reply.
+//
+// Replies echo the request id, so requests can be pipelined. The bridge keeps
+// at most CREDITS frames in flight; the device hands one credit back (CREDIT
+// frame) for every frame it has consumed.
+class SerialFrame {
+public:
+    static const uint8_t VERSION = 1;
+    static const uint8_t CREDITS = 3;
+    static const size_t MAX_FRAME = 2048;       // decoded type + id + payload + crc
+    static const size_t MAX_ENCODED = MAX_FRAME + MAX_FRAME / 254 + 1;
+
+    // PC -> device
+    static const uint8_t HELLO = 'H';           // [version, baud u32]; reply [version, credits, max frame u16, baud u32, features]
+    static const uint8_t TELEMETRY = 'T';       // PC stats JSON, no reply
+    static const uint8_t GET_UPDATE = 'G';      // optional [since u32, boot u32]; reply UPDATE
+    static const uint8_t SAVE_CFG = 'S';        // config JSON; reply ACK
+    static const uint8_t GET_METRICS = 'M';     // reply METRICS
+
+    // Device -> PC
+    static const uint8_t UPDATE = 'U';          // state JSON (delta when asked with a cursor)
+    static const uint8_t ACK = 'A';             // [1 = applied, 0 = rejected]
+    static const uint8_t METRICS = 'm';         // metrics JSON
+    static const uint8_t CREDIT = 'K';          // [frames consumed]
+
+    // HELLO reply feature bits
+    static const uint8_t FEATURE_TELEMETRY_DELTA = 0x01;   // TELEMETRY may be a "delta":1 document
+
+    static uint16_t crcUpdate(uint16_t crc, uint8_t b);
+    static uint16_t crc16(const uint8_t* data, size_t length);
+    // Decodes one COBS block in place and checks its CRC. Returns the length of
+    // type + id + payload, or 0 when the block is not a valid frame.
+    static size_t decode(uint8_t* data, size_t length);
+    static void send(Print& out, uint8_t type, uint8_t id, const uint8_t* payload, size_t length);
+
+    static uint32_t readU32(const uint8_t* data);
+    static void writeU32(uint8_t* data, uint32_t value);
+};
+
+// Collects a reply payload from Print-based writers, then sends it as one frame
+class FrameWriter : public Print {
+public:
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t len) override;
+    using Print::write;
+
+    void send(Print& out, uint8_t type, uint8_t id);
+
+private:
+    std::vector<uint8_t> payload;
+};
+
+#endif
@@ -0,0 +1,261 @@
+#include "StateSerializer.h"
+#include "PcMonitorService.h"
+#include "ConfigSchema.h"
+
+static String formatClock(const String& format) {
+    time_t now = time(nullptr);
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+
+    char time_str[12];
+    strftime(time_str, sizeof(time_str), format == "12" ? "%I:%M" : "%H:%M", &timeinfo);
+    return String(time_str);
+}
+
+static String formatDate() {
+    struct tm timeinfo;
+    if (!getLocalTime(&timeinfo, 0)) return "No Date";
+
+    char buffer[32];
+    strftime(buffer, sizeof(buffer), "%A, %b %d", &timeinfo);
+    return String(buffer);
+}
+
+// Hashes whatever is printed to it, so values can be compared without keeping copies
+class HashPrint : public Print {
+public:
+    uint32_t hash = 2166136261u;
+
+    size_t write(uint8_t c) override {
+        hash ^= c;
+        hash *= 16777619u;
+        return 1;
+    }
+    using Print::write;
+};
+
+StateSerializer::StateSerializer() {
+    // Revisions restart every boot, so cursors also carry a random id of the boot that issued them.
+    // Never 0, which clients send when they have no cursor yet
+    do {
+        boot = esp_random();
+    } while (boot == 0);
+}
+
+uint32_t StateSerializer::stateVersion(const AppState& state) {
+    // Derived input the version counters don't cover: the clock
+    uint32_t words[10] = {
+        (uint32_t)state.config.version, (uint32_t)state.weather.version, (uint32_t)state.aqi.version,
+        (uint32_t)state.stock.version, (uint32_t)state.crypto.version, (uint32_t)state.currency.version,
+        (uint32_t)state.pc.version, (uint32_t)state.media.version,
+        (uint32_t)state.pc_hosts.version, (uint32_t)(time(nullptr) / 60)
+    };
+
+    // FNV-1a over the inputs
+    uint32_t hash = 2166136261u;
+    const uint8_t* bytes = (const uint8_t*)words;
+    for (size_t i = 0; i < sizeof(words); i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+std::shared_ptr<const SerializedState> StateSerializer::get(const AppState& state) {
+    uint32_t version = stateVersion(state);
+    if (cached && cached->version == version) return cached;
+
+    DynamicJsonDocument doc(JSON_CAPACITY);
+    fillJson(state, doc);
+    trackChanges(doc.as<JsonObject>());
+    doc["rev"] = revision;
+    doc["boot"] = boot;
+
+    std::shared_ptr<const SerializedState> json = serialize(doc, version);
+    if (json) cached = json;
+    return cached;
+}
+
+std::shared_ptr<const SerializedState> StateSerializer::getDelta(const AppState& state, uint32_t since, uint32_t sinceBoot, bool& notModified) {
+    notModified = false;
+    std::shared_ptr<const SerializedState> full = get(state);
+
+    // A cursor from another boot means nothing against this boot's revisions; the caller gets everything
+    if (!full || sinceBoot != boot || since > revision) return full;
+    if (since == revision) {
+        notModified = true;
+        return nullptr;
+    }
+    if (cachedDelta && cachedDeltaSince == since && cachedDelta->version == full->version) return cachedDelta;
+
+    DynamicJsonDocument values(JSON_CAPACITY);
+    fillJson(state, values);
+
+    DynamicJsonDocument delta(JSON_CAPACITY);
+    for (const KeyRevision& entry : keys) {
+        if (entry.revision <= since) continue;
+        if (entry.present) delta[entry.key] = values[entry.key];
+        else delta[entry.key] = nullptr;
+    }
+    delta["rev"] = revision;
+    delta["boot"] = boot;
+
+    std::shared_ptr<const SerializedState> json = serialize(delta, full->version);
+    if (json) {
+        cachedDelta = json;
+        cachedDeltaSince = since;
+    }
+    return json;
+}
+
+void StateSerializer::trackChanges(JsonObject values) {
+    uint32_t next = revision + 1;
+    bool changed = false;
+
+    for (KeyRevision& entry : keys) entry.seen = false;
+
+    for (JsonPair pair : values) {
+        HashPrint hasher;
+        serializeJson(pair.value(), hasher);
+
+        KeyRevision* entry = nullptr;
+        for (KeyRevision& candidate : keys) {
+            if (candidate.key == pair.key().c_str()) {
+                entry = &candidate;
+                break;
+            }
+        }
+
+        if (entry == nullptr) {
+            keys.push_back({String(pair.key().c_str()), hasher.hash, next, true, true});
+            changed = true;
+        } else {
+            entry->seen = true;
+            if (!entry->present || entry->hash != hasher.hash) {
+                entry->hash = hasher.hash;
+                entry->revision = next;
+                entry->present = true;
+                changed = true;
+            }
+        }
+    }
+
+    // Keys the state stopped reporting (e.g. weather went invalid) count as changes too
+    for (KeyRevision& entry : keys) {
+        if (entry.present && !entry.seen) {
+            entry.present = false;
+            entry.revision = next;
+            changed = true;
+        }
+    }
+
+    if (changed) revision = next;
+}
+
+std::shared_ptr<const SerializedState> StateSerializer::serialize(const JsonDocument& doc, uint32_t version) {
+    // Sized exactly; the old buffer is freed once its last holder finishes sending
+    size_t length = measureJson(doc);
+    std::unique_ptr<char[]> data(new (std::nothrow) char[length + 1]);
+    if (!data) return nullptr;
+    serializeJson(doc, data.get(), length + 1);
+
+    return std::make_shared<SerializedState>(SerializedState{version, length, std::move(data)});
+}
+
+size_t StateSerializer::write(const AppState& state, Print& out) {
+    std::shared_ptr<const SerializedState> json = get(state);
+    if (!json) return 0;
+    return out.write((const uint8_t*)json->data.get(), json->length);
+}
+
+size_t StateSerializer::writeDelta(const AppState& state, uint32_t since, uint32_t sinceBoot, Print& out) {
+    bool notModified;
+    std::shared_ptr<const SerializedState> json = getDelta(state, since, sinceBoot, notModified);
+    // Nothing changed: a document holding only the cursor
+    if (notModified) return out.printf("{\"rev\":%lu,\"boot\":%lu}", (unsigned long)revision, (unsigned long)boot);
+    if (!json) return 0;
+    return out.write((const uint8_t*)json->data.get(), json->length);
+}
+
+void StateSerializer::fillJson(const AppState& state, JsonDocument& doc) {
+    const Config& config = state.config;
+    const WeatherData& weather = state.weather;
+    const AirQualityData& aqi = state.aqi;
+    const CryptoData& crypto = state.crypto;
+    const CurrencyData& currency = state.currency;
+    const StockData& stock = state.stock;
+    const PcStats& pc = state.pc;
+    const PcMedia& media = state.media;
+
+    // Global Settings
+    doc["device_id"] = config.device_id;
+    doc["ip_address"] = config.ip_address;
+    // Every persisted setting, under the same keys the web form and the PC app send back
+    ConfigSchema::toJson(config, doc);
+
+    doc["media_status"] = media.status;
+    doc["media_name"] = media.name;
+
+    doc["time"] = formatClock(config.time_format);
+    doc["date"] = formatDate();
+    doc["update_time"] = weather.update_time;
+    doc["temp_unit"] = config.temp_unit;
+    doc["time_format"] = config.time_format;
+
+    if (!isnan(weather.temp)) {
+      doc["temp"] = String(weather.temp, 1);
+      doc["apparent_temperature"] = String(weather.apparent_temperature, 1);
+      doc["humidity"] = String(weather.humidity);
+      doc["wind_speed"] = String(weather.wind_speed, 1);
+      doc["weather_code"] = weather.weather_code;
+    }
+
+    if (!isnan(aqi.pm25) && !isnan(aqi.pm10) && !isnan(aqi.no2)) {
+      doc["aqi"] = String(aqi.aqi);
+      doc["aqi_status"] = aqi.status;
+      doc["pm25"] = String(aqi.pm25, 1);
+      doc["pm10"] = String(aqi.pm10, 1);
+      doc["no2"] = String(aqi.no2, 1);
+    }
+
+    if (!isnan(crypto.price_usd) && crypto.price_usd > 0) {
+      doc["crypto_symbol"] = String(crypto.symbol);
+      doc["crypto_price"] = String(crypto.price_usd);
+      doc["crypto_change"] = String(crypto.percent_change_24h);
+    }
+
+    if (currency.updated) {
+      float displayRate = currency.rate * config.currency_multiplier;
+
+      int decimals = 0;
+      if (displayRate < 10.0) decimals = 3;
+      else if (displayRate < 100.0) decimals = 2;
+      else if (displayRate < 1000.0) decimals = 1;
+
+      doc["currency_base_text"] = String(config.currency_multiplier) + " " + currency.base;
+      doc["currency_target_text"] = String(displayRate, decimals) + " " + currency.target;
+      doc["currency_date"] = currency.date;
+    }
+
+    if (stock.updated) {
+      doc["stock_symbol"] = stock.symbol;
+      doc["stock_price"] = String(stock.price, 2);
+      doc["stock_change"] = String(stock.percent_change, 2);
+    }
+
+    if (pc.cpu_percent > 0.1) {
+      doc["pc_cpu"] = String(pc.cpu_percent);
+      doc["pc_net"] = String(pc.net_down_kb);
+      doc["pc_ram"] = String(pc.mem_percent);
+      doc["pc_disk"] = String(pc.disk_percent);
+    }
+
+    if (media.status.length() > 0) {
+      doc["media_status"] = media.status;
+      doc["media_name"] = media.name;
+      doc["media_author"] = media.author;
+      doc["media_album"] = media.album;
+    }
+
+    doc["pc_status"] = PcMonitorService::describeHosts(state);
+}
@@ -0,0 +1,65 @@
+#ifndef STATE_SERIALIZER_H
+#define STATE_SERIALIZER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <memory>
+#include <vector>
+#include "structs.h"
+
+// Serialized state JSON. Immutable once built, so a holder can keep sending it
+// after the state lock is released while newer versions are built alongside.
+struct SerializedState {
+    uint32_t version;
+    size_t length;
+    std::unique_ptr<char[]> data;
+};
+
+// Builds the state document shared by /update, /events and SYS_UPDATE. The
+// bytes are cached against stateVersion(), so repeat requests at the same
+// version cost no JSON work. Callers must hold the state lock.
+//
+// Each top-level key also remembers the revision it last changed at. Every
+// document carries the current "rev" and this boot's "boot" id, and getDelta()
+// returns only the keys changed after a given rev, with null for keys that
+// were dropped. A cursor from another boot gets the full document instead.
+class StateSerializer {
+public:
+    StateSerializer();
+
+    static uint32_t stateVersion(const AppState& state);
+
+    std::shared_ptr<const SerializedState> get(const AppState& state);
+    // Returns nullptr with notModified set when nothing changed since `since`
+    std::shared_ptr<const SerializedState> getDelta(const AppState& state, uint32_t since, uint32_t boot, bool& notModified);
+    size_t write(const AppState& state, Print& out);
+    size_t writeDelta(const AppState& state, uint32_t since, uint32_t boot, Print& out);
+
+    uint32_t currentRevision() const { return revision; }
+    uint32_t bootId() const { return boot; }
+
+private:
+    static const size_t JSON_CAPACITY = 3072;
+
+    struct KeyRevision {
+        String key;
+        uint32_t hash;          // FNV-1a of the serialized value
+        uint32_t revision;
+        bool present;
+        bool seen;
+    };
+
+    std::shared_ptr<const SerializedState> cached;
+    std::shared_ptr<const SerializedState> cachedDelta;
+    uint32_t cachedDeltaSince = 0;
+
+    std::vector<KeyRevision> keys;
+    uint32_t revision = 0;
+    uint32_t boot;
+
+    static void fillJson(const AppState& state, JsonDocument& doc);
+    void trackChanges(JsonObject values);
+    static std::shared_ptr<const SerializedState> serialize(const JsonDocument& doc, uint32_t version);
+};
+
+#endif
@@ -1,9 +1,9 @@
 #include "StockService.h"
-#include <HTTPClient.h>
-#include <WiFiClientSecure.h>
 #include <ArduinoJson.h>
 
-bool StockService::fetchStock(const String& symbol, StockData &data) {
+StockService::StockService(HttpConnectionPool& pool) : pool(pool) {}
+
+bool StockService::fetchStock(const String& symbol, StockData &data, uint16_t timeoutMs, bool withHistory) {
     String safeSymbol = symbol;
     safeSymbol.toLowerCase();
     safeSymbol.trim();
@@ -13,22 +13,20 @@ bool StockService::fetchStock(const String& symbol, StockData &data) {
     Serial.printf("StockService: Requesting Stock Data for '%s'\n", safeSymbol.c_str()); 
     Serial.printf("StockService: URL: %s\n", url.c_str()); 
 
-    WiFiClientSecure client;
-    client.setInsecure(); 
-    
-    HTTPClient http;
-    http.setReuse(false); 
-    
-    http.begin(client, url);
-    http.setConnectTimeout(10000); 
-    http.setTimeout(10000);        
-    
-    int httpCode = http.GET();
+    int httpCode;
+    HTTPClient& http = pool.get(url, timeoutMs, httpCode);
 
     if (httpCode == 200) {
-        String payload = http.getString();
-        DynamicJsonDocument doc(1024);
-        DeserializationError error = deserializeJson(doc, payload);
+        StaticJsonDocument<128> filter;
+        JsonObject fields = filter["symbols"].createNestedObject();
+        fields["name"] = true;
+        fields["close"] = true;
+        fields["c"] = true;
+        fields["previous"] = true;
+        fields["p"] = true;
+
+        StaticJsonDocument<384> doc;
+        DeserializationError error = deserializeJson(doc, pool.body(http), DeserializationOption::Filter(filter));
 
         if (!error) {
             JsonArray symbolsArray = doc["symbols"];
@@ -36,8 +34,10 @@ bool StockService::fetchStock(const String& symbol, StockData &data) {
                 JsonObject obj = symbolsArray[0];
                 
                 // 1. Directly assign the symbol we already know!
-                data.symbol = safeSymbol;
-                data.symbol.toUpperCase();
+                String upperSymbol = safeSymbol;
+                upperSymbol.toUpperCase();
+                if (data.symbol != upperSymbol) data.history.clear();
+                data.symbol = upperSymbol;
                 
                 // 2. Grab the full company name from the API
                 data.name = obj.containsKey("name") ? obj["name"].as<String>() : "Unknown";
@@ -56,11 +56,13 @@ bool StockService::fetchStock(const String& symbol, StockData &data) {
                 }
                 
                 data.updated = true;
+                data.version++;
 
                 Serial.printf("StockService: Success! %s (%s): $%.2f Change: %+.2f%%\n", 
                               data.symbol.c_str(), data.name.c_str(), data.price, data.percent_change);
                               
-                http.end();
+                pool.release(http);
+                if (withHistory) fetchHistory(safeSymbol, data.history, timeoutMs);
                 return true;
             } else {
                 Serial.println("StockService: ERROR! 'symbols' array missing or empty in JSON.");
@@ -72,6 +74,105 @@ bool StockService::fetchStock(const String& symbol, StockData &data) {
         Serial.printf("StockService: API failed, HTTP Code: %d\n", httpCode);
     }
     
-    http.end();
+    pool.release(http);
     return false;
+}
+
+bool StockService::fetchHistory(const String& symbol, PriceSeries& series, uint16_t timeoutMs) {
+    String url = String(STOCK_HISTORY_URL) + "?s=" + symbol + ".us&i=5";
+    Serial.printf("StockService: URL: %s\n", url.c_str());
+
+    int httpCode;
+    HTTPClient& http = pool.get(url, timeoutMs, httpCode);
+    if (httpCode != 200) {
+        Serial.printf("StockService: History failed, HTTP Code: %d\n", httpCode);
+        pool.release(http);
+        return false;
+    }
+
+    // Parsed as it streams in; only a 64-byte read chunk and one line are ever buffered
+    PriceSeries parsed;
+    HistoryCsvParser parser(parsed);
+    HttpBodyStream& body = pool.body(http);
+    uint8_t chunk[64];
+    unsigned long lastData = millis();
+
+    while (!body.finished()) {
+        int avail = body.available();
+        if (avail <= 0) {
+            if (millis() - lastData > timeoutMs) break;
+            delay(1);
+            continue;
+        }
+        size_t n = body.readBytes(chunk, avail < (int)sizeof(chunk) ? avail : sizeof(chunk));
+        parser.feed(chunk, n);
+        lastData = millis();
+    }
+    parser.finish();
+    pool.release(http);
+
+    if (parser.rows() == 0) {
+        Serial.println("StockService: History had no rows.");
+        return false;
+    }
+
+    series = parsed;
+    Serial.printf("StockService: History has %d points (%d rows parsed).\n", series.ring.count, parser.rows());
+    return true;
+}
+
+void StockService::HistoryCsvParser::feed(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        char c = (char)data[i];
+        if (c == '\n') {
+            line[lineLength] = '\0';
+            if (!lineOverflow) parseLine(line);
+            lineLength = 0;
+            lineOverflow = false;
+        } else if (c != '\r') {
+            if (lineLength < LINE_SIZE - 1) line[lineLength++] = c;
+            else lineOverflow = true;
+        }
+    }
+}
+
+void StockService::HistoryCsvParser::finish() {
+    // The last row may come without a trailing newline
+    if (lineLength > 0 && !lineOverflow) {
+        line[lineLength] = '\0';
+        parseLine(line);
+    }
+    lineLength = 0;
+}
+
+void StockService::HistoryCsvParser::parseLine(char* text) {
+    char* fields[8];
+    int count = 0;
+    fields[count++] = text;
+    for (char* p = text; *p && count < 8; p++) {
+        if (*p == ',') {
+            *p = '\0';
+            fields[count++] = p + 1;
+        }
+    }
+
+    // The header names the columns; anything before it (e.g. "No data") is skipped
+    if (closeColumn < 0) {
+        for (int i = 0; i < count; i++) {
+            if (strcmp(fields[i], "Date") == 0) dateColumn = i;
+            else if (strcmp(fields[i], "Close") == 0) closeColumn = i;
+        }
+        return;
+    }
+    if (closeColumn >= count) return;
+
+    float close = atof(fields[closeColumn]);
+    if (close <= 0) return;
+
+    if (dateColumn >= 0 && dateColumn < count && strcmp(fields[dateColumn], sessionDate) != 0) {
+        strlcpy(sessionDate, fields[dateColumn], sizeof(sessionDate));
+        series.clear();
+    }
+    series.push(close);
+    rowCount++;
 }
\ No newline at end of file
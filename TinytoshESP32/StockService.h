@@ -2,14 +2,46 @@
 #define STOCK_SERVICE_H
 
 #include "structs.h"
-
+#include "HttpConnectionPool.h"
 
 class StockService {
 public:
-    bool fetchStock(const String& symbol, StockData &data);
+    StockService(HttpConnectionPool& pool);
+    // With withHistory, also refreshes data.history from the intraday CSV; a
+    // failed history request leaves the previous series and the quote intact
+    bool fetchStock(const String& symbol, StockData &data, uint16_t timeoutMs = 10000, bool withHistory = false);
+
+    // Incremental parser for stooq's history CSV ("Date,Time,...,Close,...").
+    // Rows are pushed as they arrive; a new date starts the series over, so
+    // only the latest session is kept.
+    class HistoryCsvParser {
+    public:
+        explicit HistoryCsvParser(PriceSeries& series) : series(series) {}
+        void feed(const uint8_t* data, size_t length);
+        void finish();
+        int rows() const { return rowCount; }
+
+    private:
+        static const size_t LINE_SIZE = 96;
+
+        PriceSeries& series;
+        char line[LINE_SIZE];
+        size_t lineLength = 0;
+        bool lineOverflow = false;
+        int dateColumn = -1;
+        int closeColumn = -1;
+        char sessionDate[16] = "";
+        int rowCount = 0;
+
+        void parseLine(char* text);
+    };
 
 private:
+    HttpConnectionPool& pool;
     const char* STOCK_API_URL = "https://stooq.com/q/l/";
+    const char* STOCK_HISTORY_URL = "https://stooq.com/q/d/l/";
+
+    bool fetchHistory(const String& symbol, PriceSeries& series, uint16_t timeoutMs);
 };
 
 #endif
\ No newline at end of file
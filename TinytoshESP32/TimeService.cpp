@@ -12,20 +12,30 @@ bool TimeService::fetchLocationData(Config& config) {
   
   Serial.println("TimeService: Fetching location from ip-api.com..."); 
   HTTPClient http;
+  // HTTP/1.0 keeps the body un-chunked so it can be parsed straight off the socket
+  http.useHTTP10(true);
   http.begin(LOCATION_API_URL);
   http.setTimeout(10000); 
   int httpCode = http.GET();
   
   if (httpCode == HTTP_CODE_OK) {
-    String payload = http.getString();
-    DynamicJsonDocument doc(1024);
-    DeserializationError error = deserializeJson(doc, payload);
+    StaticJsonDocument<128> filter;
+    filter["status"] = true;
+    filter["lat"] = true;
+    filter["lon"] = true;
+    filter["timezone"] = true;
+    filter["city"] = true;
+
+    StaticJsonDocument<384> doc;
+    DeserializationError error = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter));
+    http.end();
 
     if (!error && doc["status"] == "success") {
       config.latitude = doc["lat"].as<float>();
       config.longitude = doc["lon"].as<float>();
       config.timezone = doc["timezone"].as<String>();
       config.city = doc["city"].as<String>(); 
+      config.version++;
       
       Serial.printf("TimeService: Success! Location: %s (Lat: %.4f, Lon: %.4f), TZ: %s\n", 
                     config.city.c_str(), config.latitude, 
@@ -42,14 +52,8 @@ bool TimeService::fetchLocationData(Config& config) {
 }
 
 String TimeService::lookupPosixTimezone(const String& ianaTimezone) {
-  DynamicJsonDocument doc(6144); 
-  DeserializationError error = deserializeJson(doc, POSIX_TIMEZONE_MAP); 
-  if (!error) {
-    if (doc.containsKey(ianaTimezone)) {
-      return doc[ianaTimezone].as<String>();
-    } 
-  }
-  return "GMT0";
+  const char* posix = findPosixTimezone(ianaTimezone.c_str());
+  return posix ? String(posix) : String("GMT0");
 }
 
 void TimeService::syncNTP(const String& ianaTimezone) {
@@ -14,6 +14,11 @@
 #include "CurrencyService.h"
 #include "StockService.h"
 #include "PcMonitorService.h"
+#include "MetricsService.h"
+#include "FetchScheduler.h"
+#include "HttpConnectionPool.h"
+#include "StateSerializer.h"
+#include "UdpTelemetryService.h"
 
 // Global Constants
 const char* AP_SSID = "Tinytosh";
@@ -39,16 +44,21 @@ AppState appState;
 void updateAllDataCallback();
 
 // Service Instances
+HttpConnectionPool httpPool;
 ConfigManager configManager(PREF_NAMESPACE);
 TimeService timeService;
-WeatherService weatherService;
-AirQualityService airQualityService;
+WeatherService weatherService(httpPool);
+AirQualityService airQualityService(httpPool);
 DisplayService displayService(128, 64, -1);
 WebServerService webServerService(80, updateAllDataCallback);
-CryptoService cryptoService;
-CurrencyService currencyService;
-StockService stockService;
+CryptoService cryptoService(httpPool);
+CurrencyService currencyService(httpPool);
+StockService stockService(httpPool);
 PcMonitorService pcMonitorService;
+UdpTelemetryService udpTelemetryService;
+MetricsService metricsService(NORMAL_REFRESH_MS);
+StateSerializer stateSerializer;
+FetchScheduler fetchScheduler(httpPool, timeService, weatherService, airQualityService, stockService, cryptoService, currencyService);
 
 unsigned long lastScreenSwitch = 0;
 int currentScreen = 0;
@@ -60,8 +70,8 @@ unsigned long lastScreenUpdate = 0;
 
 // Helper Functions
 
-void drawCurrentScreen() {
-  displayService.drawScreen(currentScreen, appState, timeService);
+bool drawCurrentScreen() {
+  return displayService.drawScreenIfChanged(currentScreen, appState, timeService);
 }
 
 void switchToNextScreen() {
@@ -95,8 +105,8 @@ void switchToNextScreen() {
 
   if (!foundVisible || currentScreen == nextScreenCandidate) return;
 
-  // 3. Animate and switch using the newly discovered screen ID
-  displayService.animateTransition(currentScreen, nextScreenCandidate, appState, timeService);
+  // 3. Animate and switch using the newly discovered screen ID (frames are stepped from loop())
+  displayService.startTransition(currentScreen, nextScreenCandidate, appState, timeService);
   currentScreen = nextScreenCandidate;
 }
 
@@ -135,23 +145,24 @@ bool isNightModeActive() {
 
 // Core Application Logic
 
+// Button callbacks run from button.tick() outside the state lock and take it themselves
 void handleSingleClick() {
+  webServerService.lockState();
   bool wasScreenOff = (nightModeLatched && appState.config.night_action == 2 && (millis() - lastInteractionTime >= NIGHT_WAKE_DURATION_MS));
 
   if (wasScreenOff) {
     Serial.println("🌙 Night Mode: Waking display temporarily on Primary Screen.");
     currentScreen = getFirstEnabledScreen();
     
-    displayService.display.ssd1306_command(SSD1306_SETCONTRAST);
-    displayService.display.ssd1306_command(CONTRAST_DIM);
+    displayService.setContrast(CONTRAST_DIM);
   } else {
     Serial.println("👆 Button Pressed: Switching Screen");
     if (nightModeLatched) {
-      displayService.display.ssd1306_command(SSD1306_SETCONTRAST);
-      displayService.display.ssd1306_command((appState.config.night_action == 0) ? CONTRAST_MAX : CONTRAST_DIM);
+      displayService.setContrast((appState.config.night_action == 0) ? CONTRAST_MAX : CONTRAST_DIM);
     }
     switchToNextScreen();
   }
+  webServerService.unlockState();
   
   lastScreenSwitch = millis();
   lastInteractionTime = millis();
@@ -159,19 +170,23 @@ void handleSingleClick() {
 }
 
 void handleLongPress() {
+  webServerService.lockState();
   appState.config.screen_auto_cycle = !appState.config.screen_auto_cycle;
+  appState.config.version++;
+  Config config = appState.config;
   
-  if (appState.config.screen_auto_cycle) {
+  if (config.screen_auto_cycle) {
     Serial.println("🔄 Auto Cycle: ENABLED");
     displayService.drawInfoScreen(icon_unlock, "Auto Cycle On");
-    displayService.display.display();
+    displayService.flush();
   } else {
     Serial.println("🔒 Auto Cycle: DISABLED (Screen Locked)");
     displayService.drawInfoScreen(icon_lock, "Auto Cycle Off");
-    displayService.display.display();
+    displayService.flush();
   }
+  webServerService.unlockState();
   
-  configManager.saveConfig(appState.config);
+  configManager.saveConfig(config);
   
   delay(1000); 
   
@@ -180,63 +195,55 @@ void handleLongPress() {
   lastInteractionTime = millis();
 }
 
+void showStatus(std::initializer_list<String> lines) {
+  webServerService.lockState();
+  displayService.showOLEDStatus(lines, true);
+  webServerService.unlockState();
+}
+
+// Called without the state lock: the location lookup, NTP sync and flash write
+// take seconds, so they work on a copy and only the results are published
 void updateAllData() {
+  webServerService.lockState();
   nightModeLatched = false;
+  Config config = appState.config;
+  webServerService.unlockState();
 
   // 1. Location Detection
-  if (appState.config.auto_detect) {
-    displayService.showOLEDStatus({"\n", "\n", "Detecting Location...", "\n", "Please wait..."}, true);
-    if (timeService.fetchLocationData(appState.config)) {
+  bool located = false;
+  if (config.auto_detect) {
+    showStatus({"\n", "\n", "Detecting Location...", "\n", "Please wait..."});
+    located = timeService.fetchLocationData(config);
+    if (located) {
       Serial.println("Location updated via IP");
     }
   }
 
   // 2. Sync Time (Depends on Location/Timezone)
-  displayService.showOLEDStatus({"\n", "\n", "Syncing Time...", "\n", "Timezone:", appState.config.timezone}, true);
-  timeService.syncNTP(appState.config.timezone);
-
-  // 3. Fetch Weather (Depends on Lat/Lon)
-  if (appState.config.show_weather) {  
-    displayService.showOLEDStatus({"\n", "\n", "Updating Weather...", "\n", "Location:", appState.config.city}, true);
-    String updateTime = timeService.getCurrentTime(appState.config.time_format);
-    weatherService.fetchWeather(appState.config, appState.weather, updateTime);
+  showStatus({"\n", "\n", "Syncing Time...", "\n", "Timezone:", config.timezone});
+  timeService.syncNTP(config.timezone);
+
+  // 3. Publish the location (a save that landed meanwhile keeps its other changes),
+  // hand the config to the fetch task and make every source due now
+  webServerService.lockState();
+  if (located) {
+    appState.config.latitude = config.latitude;
+    appState.config.longitude = config.longitude;
+    appState.config.timezone = config.timezone;
+    appState.config.city = config.city;
+    appState.config.version++;
   }
+  fetchScheduler.setConfig(appState.config, 1);
+  fetchScheduler.requestRefresh();
 
-  // 4. Fetch Air Quality (Depends on Lat/Lon)
-  if (appState.config.show_aqi) {  
-    displayService.showOLEDStatus({"\n", "\n", "Updating AQI...", "\n", "Location:", appState.config.city}, true);
-    airQualityService.fetchAirQuality(appState.config, appState.aqi);
-  }
-
-  // 5. Fetch Stocks (Independent)
-  if (appState.config.show_stock) {
-    displayService.showOLEDStatus({"\n", "\n", "Updating Stocks...", "\n", "Stock:", appState.config.stock_symbol}, true);
-    stockService.fetchStock(appState.config.stock_symbol, appState.stock);
-  }
-
-  // 6. Fetch Crypto (Independent)
-  if (appState.config.show_crypto) { 
-    displayService.showOLEDStatus({"\n", "\n", "Updating Crypto...", "\n", "Ticker ID:", String(appState.config.crypto_id)}, true);
-    cryptoService.fetchPrice(appState.config.crypto_id, appState.crypto);
-  }
-
-  // 7. Fetch Currency (Independent)
-  if (appState.config.show_currency) { 
-    String baseUpper = String(appState.config.currency_base);
-    baseUpper.toUpperCase();
-    String targetUpper = String(appState.config.currency_target);
-    targetUpper.toUpperCase();
-
-    displayService.showOLEDStatus({"\n", "\n", "Updating Currency...", "\n", "Currencies:", baseUpper + " -> " + targetUpper}, true);
-    currencyService.fetchRate(String(appState.config.currency_base), String(appState.config.currency_target), appState.currency);
-  }
-
-  // 8. Save Everything
-  configManager.saveConfig(appState.config);
-
-  // 9. Find the first enabled screen to show immediately
+  // 4. Find the first enabled screen to show immediately
   currentScreen = getFirstEnabledScreen();
   lastScreenSwitch = millis();
+  config = appState.config;
+  webServerService.unlockState();
+
+  // 5. Save Everything
+  configManager.saveConfig(config);
 }
 
 // Global function wrapper for the class method
@@ -245,7 +252,9 @@ void updateAllDataCallback() {
 }
 
 void setup() {
-  Serial.setRxBufferSize(1024);
+  // Room for every frame the bridge may have in flight (SerialFrame::CREDITS)
+  Serial.setRxBufferSize(8192);
+  Serial.setTxBufferSize(4096);
   Serial.begin(115200);
   button.attachClick(handleSingleClick);
   button.attachLongPressStart(handleLongPress);
@@ -256,6 +265,9 @@ void setup() {
   // configManager.clearAllPreferences();
 
   // 1. Initialize Display and show startup message
+  displayService.setMetrics(&metricsService);
+  pcMonitorService.setMetrics(&metricsService);
+  pcMonitorService.setStateSerializer(&stateSerializer);
   displayService.begin();
   delay(3000);
 
@@ -295,7 +307,10 @@ void setup() {
     
     delay(3000); 
 
+    udpTelemetryService.begin();
+
     // 4. Initial Data Fetch
+    fetchScheduler.begin();
     updateAllData(); 
   } else {
     Serial.println("Failed to connect and timed out. Staying in AP Mode.");
@@ -304,18 +319,20 @@ void setup() {
 
   // 5. Initialize Web Server
   webServerService.setAppState(&appState);
+  webServerService.setDisplayService(&displayService);
+  webServerService.setMetrics(&metricsService);
+  webServerService.setStateSerializer(&stateSerializer);
   webServerService.begin();
 }
 
-void loop() {
-  webServerService.handleClient();
-  button.tick();
-
-  if (pcMonitorService.handleSerial(appState)) {
+// Runs with the state lock held; returns true when a config arrived over USB
+// and updateAllData() should apply it once the lock is released
+bool updateAndDraw() {
+  bool configChanged = pcMonitorService.handleSerial(appState);
+  if (configChanged) {
     Serial.println("Config updated via USB! Saving and applying...");
-    configManager.saveConfig(appState.config);
-    updateAllData();
   }
+  udpTelemetryService.handle(appState);
 
   // 1. Night Latch Logic
   bool nightScheduleActive = isNightModeActive();
@@ -341,22 +358,9 @@ void loop() {
     }
   }
 
-  // 2. Scheduled Data Refresh
-  static unsigned long lastDataUpdate = 0;
-  unsigned long dataInterval = appState.config.refresh_interval_min * 60 * 1000;
-  if (nightModeLatched) {
-    dataInterval *= NIGHT_DATA_INTERVAL_MULTIPLIER;
-  }
-
-  if (millis() - lastDataUpdate > dataInterval) {
-    if (appState.config.show_weather) weatherService.fetchWeather(appState.config, appState.weather, timeService.getCurrentTime(appState.config.time_format));
-    if (appState.config.show_aqi) airQualityService.fetchAirQuality(appState.config, appState.aqi);
-    if (appState.config.show_crypto) cryptoService.fetchPrice(appState.config.crypto_id, appState.crypto);
-    if (appState.config.show_currency) currencyService.fetchRate(appState.config.currency_base, appState.config.currency_target, appState.currency);
-    if (appState.config.show_stock) stockService.fetchStock(appState.config.stock_symbol, appState.stock);
-    
-    lastDataUpdate = millis();
-  }
+  // 2. Scheduled Data Refresh (fetches run on the scheduler task, results are picked up here)
+  fetchScheduler.setConfig(appState.config, nightModeLatched ? NIGHT_DATA_INTERVAL_MULTIPLIER : 1);
+  fetchScheduler.publish(appState);
 
   // 3. Auto Screen Switching Logic
   if (appState.config.screen_auto_cycle && !nightModeLatched) {
@@ -368,6 +372,11 @@ void loop() {
   }
 
   // 4. Screen Redraw & Visual Action Logic
+  if (displayService.isAnimating()) {
+    displayService.stepTransition();
+    return configChanged;
+  }
+
   static bool screenClearedForNight = false;
   bool isScreenOffAction = (nightModeLatched && appState.config.night_action == 2);
   bool isTemporarilyAwake = isScreenOffAction && (millis() - lastInteractionTime < NIGHT_WAKE_DURATION_MS);
@@ -376,7 +385,8 @@ void loop() {
   if (!shouldDrawScreen) {
     if (!screenClearedForNight) {
       displayService.display.clearDisplay();
-      displayService.display.display();
+      displayService.invalidateScreen();
+      displayService.flush();
       screenClearedForNight = true;
       Serial.println("💤 Night Mode: Display turned OFF to save power. Waiting for interaction or morning.");
     }
@@ -395,20 +405,34 @@ void loop() {
         
       if (nightModeLatched) {
         if (appState.config.night_action == 1 || isTemporarilyAwake) {
-          displayService.display.ssd1306_command(SSD1306_SETCONTRAST);
-          displayService.display.ssd1306_command(CONTRAST_DIM); 
+          displayService.setContrast(CONTRAST_DIM); 
         } else {
-          displayService.display.ssd1306_command(SSD1306_SETCONTRAST);
-          displayService.display.ssd1306_command(CONTRAST_MAX);
+          displayService.setContrast(CONTRAST_MAX);
         }
       } else {
-        displayService.display.ssd1306_command(SSD1306_SETCONTRAST);
-        displayService.display.ssd1306_command(CONTRAST_MAX);
+        displayService.setContrast(CONTRAST_MAX);
       }
 
-      drawCurrentScreen();
-      displayService.display.display();
+      if (drawCurrentScreen()) {
+        displayService.flush();
+      }
       lastScreenUpdate = millis();
     }
   }
-}
\ No newline at end of file
+  return configChanged;
+}
+
+void loop() {
+  // Button callbacks and the deferred save block on the network, flash and delay(),
+  // so they run outside the lock and take it only around their appState accesses
+  button.tick();
+  webServerService.handleClient();
+
+  // The HTTP server runs on its own task and only touches appState under this lock
+  webServerService.lockState();
+  bool configChanged = updateAndDraw();
+  webServerService.publishState();
+  webServerService.unlockState();
+
+  if (configChanged) updateAllData();
+}
@@ -0,0 +1,116 @@
+#include "TlsClient.h"
+#include <esp_crt_bundle.h>
+#include <fcntl.h>
+
+int TlsClient::connect(const char* host, uint16_t port, int32_t timeout) {
+    stop();
+    timeoutMs = timeout;
+
+    esp_tls_cfg_t cfg = {};
+    cfg.timeout_ms = timeout;
+    cfg.crt_bundle_attach = esp_crt_bundle_attach;
+#if TLS_CLIENT_SESSIONS
+    cfg.client_session = offered;
+#endif
+
+    tls = esp_tls_init();
+    if (!tls) return 0;
+    if (esp_tls_conn_new_sync(host, strlen(host), port, &cfg, tls) != 1 || esp_tls_get_conn_sockfd(tls, &fd) != ESP_OK) {
+        stop();
+        return 0;
+    }
+
+    // Handshake done; from here reads must not block, so available() can poll
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return 1;
+}
+
+void TlsClient::stop() {
+    if (tls) esp_tls_conn_destroy(tls);
+    tls = nullptr;
+    fd = -1;
+    eof = false;
+    rxLength = 0;
+    rxPos = 0;
+}
+
+uint8_t TlsClient::connected() {
+    return tls && (!eof || rxPos < rxLength);
+}
+
+TlsSession* TlsClient::saveSession() {
+#if TLS_CLIENT_SESSIONS
+    if (tls) return esp_tls_get_client_session(tls);
+#endif
+    return nullptr;
+}
+
+void TlsClient::freeSession(TlsSession* session) {
+#if TLS_CLIENT_SESSIONS
+    if (session) esp_tls_free_client_session(session);
+#else
+    (void)session;
+#endif
+}
+
+bool TlsClient::fill(bool noticeClose) {
+    if (rxPos < rxLength) return true;
+    if (!tls || eof) return false;
+
+    ssize_t n = esp_tls_conn_read(tls, rx, sizeof(rx));
+    if (n > 0) {
+        rxLength = n;
+        rxPos = 0;
+        return true;
+    }
+    bool pending = n == ESP_TLS_ERR_SSL_WANT_READ || n == ESP_TLS_ERR_SSL_WANT_WRITE;
+    if ((n == 0 && noticeClose) || (n < 0 && !pending)) eof = true;
+    return false;
+}
+
+int TlsClient::available() {
+    fill(false);
+    return (int)(rxLength - rxPos);
+}
+
+int TlsClient::read() {
+    if (!fill(true)) return -1;
+    return rx[rxPos++];
+}
+
+int TlsClient::read(uint8_t* buffer, size_t size) {
+    if (!fill(true)) return -1;
+    size_t n = std::min(size, rxLength - rxPos);
+    memcpy(buffer, rx + rxPos, n);
+    rxPos += n;
+    return (int)n;
+}
+
+int TlsClient::peek() {
+    if (!fill(true)) return -1;
+    return rx[rxPos];
+}
+
+size_t TlsClient::write(const uint8_t* buffer, size_t size) {
+    if (!tls || eof) return 0;
+    size_t sent = 0;
+    unsigned long start = millis();
+    while (sent < size) {
+        ssize_t n = esp_tls_conn_write(tls, buffer + sent, size - sent);
+        if (n == ESP_TLS_ERR_SSL_WANT_WRITE || n == ESP_TLS_ERR_SSL_WANT_READ) {
+            if (millis() - start > (unsigned long)timeoutMs) break;
+            delay(1);
+            continue;
+        }
+        if (n <= 0) {
+            eof = true;
+            break;
+        }
+        sent += n;
+    }
+    return sent;
+}
+
+void TlsClient::flush() {
+    while (available() > 0) rxPos = rxLength;
+}
@@ -0,0 +1,61 @@
+#ifndef TLS_CLIENT_H
+#define TLS_CLIENT_H
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <esp_tls.h>
+
+// Resumption needs the client session API, which the core's sdkconfig gates
+#ifdef CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS
+#define TLS_CLIENT_SESSIONS 1
+typedef esp_tls_client_session_t TlsSession;
+#else
+#define TLS_CLIENT_SESSIONS 0
+struct TlsSession;
+#endif
+
+// WiFiClient over esp_tls, for HTTPClient. Unlike the core's WiFiClientSecure
+// it can resume a TLS session: given the session of an earlier connection to
+// the same server, the handshake skips the key exchange and the certificate
+// chain (~1 RTT, no public-key operations). Server certificates are checked
+// against the CA bundle. Like the core's client, a peer close only shows up
+// once read() runs into it.
+class TlsClient : public WiFiClient {
+public:
+    TlsClient() {}
+    ~TlsClient() override { stop(); }
+
+    int connect(const char* host, uint16_t port, int32_t timeoutMs) override;
+    uint8_t connected() override;
+    void stop() override;
+
+    int available() override;
+    int read() override;
+    int read(uint8_t* buffer, size_t size) override;
+    int peek() override;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    void flush() override;
+
+    // Offered by the next connect(); the caller keeps ownership and must keep
+    // it alive until connect() returns
+    void setSession(TlsSession* session) { offered = session; }
+    // A copy of the connected session for a later setSession(), or nullptr;
+    // release it with freeSession()
+    TlsSession* saveSession();
+    static void freeSession(TlsSession* session);
+
+private:
+    esp_tls_t* tls = nullptr;
+    int fd = -1;
+    int32_t timeoutMs = 0;
+    bool eof = false;
+    TlsSession* offered = nullptr;
+    uint8_t rx[512];
+    size_t rxLength = 0;
+    size_t rxPos = 0;
+
+    bool fill(bool noticeClose);
+};
+
+#endif
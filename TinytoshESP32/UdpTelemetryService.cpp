@@ -0,0 +1,67 @@
+#include "UdpTelemetryService.h"
+#include <ArduinoJson.h>
+#include "PcMonitorService.h"
+
+static const IPAddress MULTICAST_GROUP(239, 84, 84, 1);
+static const char MAGIC[4] = {'T', 'T', 'L', 'M'};
+static const size_t HEADER_SIZE = 8;
+
+void UdpTelemetryService::begin() {
+    // Binds TELEMETRY_PORT on every interface and joins the group, so unicast
+    // and multicast datagrams arrive on the same socket
+    listening = udp.beginMulticast(MULTICAST_GROUP, TELEMETRY_PORT);
+    if (listening) {
+        Serial.printf("UdpTelemetryService: Listening on port %u (multicast 239.84.84.1)\n", TELEMETRY_PORT);
+    } else {
+        Serial.println("UdpTelemetryService: Failed to open UDP socket.");
+    }
+}
+
+void UdpTelemetryService::handle(AppState &state) {
+    if (!listening) return;
+
+    for (int i = 0; i < MAX_PACKETS_PER_CALL; i++) {
+        int size = udp.parsePacket();
+        if (size <= 0) return;
+
+        if ((size_t)size > MAX_DATAGRAM) {
+            udp.flush();
+            continue;
+        }
+        int length = udp.read((uint8_t*)packet, MAX_DATAGRAM);
+        if (length > 0) handlePacket(state, length);
+    }
+}
+
+void UdpTelemetryService::handlePacket(AppState &state, size_t length) {
+    if (length <= HEADER_SIZE || memcmp(packet, MAGIC, sizeof(MAGIC)) != 0) return;
+
+    const uint8_t* header = (const uint8_t*)packet;
+    uint32_t seq = (uint32_t)header[4] | ((uint32_t)header[5] << 8) | ((uint32_t)header[6] << 16) | ((uint32_t)header[7] << 24);
+
+    StaticJsonDocument<PcMonitorService::TELEMETRY_JSON_CAPACITY> doc;
+    if (deserializeJson(doc, packet + HEADER_SIZE, length - HEADER_SIZE)) return;
+
+    const char* pcId = doc["pc_id"] | "";
+    if (pcId[0] == '\0') return;
+
+    // Sequence numbers are per PC, so each sender gets its own entry (oldest one recycled)
+    uint32_t sender = PcMonitorService::hashId(pcId);
+    unsigned long now = millis();
+    SenderSeq* entry = nullptr;
+    for (SenderSeq& candidate : senders) {
+        if (candidate.hash == sender) {
+            entry = &candidate;
+            break;
+        }
+        if (entry == nullptr || now - candidate.acceptedMs > now - entry->acceptedMs) entry = &candidate;
+    }
+
+    bool known = entry->hash == sender && now - entry->acceptedMs < SEQUENCE_RESET_MS;
+    if (known && (int32_t)(seq - entry->seq) <= 0) return;
+
+    PcMonitorService::applyTelemetry(state, pcId, doc.as<JsonVariantConst>());
+    entry->hash = sender;
+    entry->seq = seq;
+    entry->acceptedMs = now;
+}
@@ -0,0 +1,46 @@
+#ifndef UDP_TELEMETRY_SERVICE_H
+#define UDP_TELEMETRY_SERVICE_H
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include "structs.h"
+
+// Connectionless PC telemetry over Wi-Fi. Each datagram is
+//
+//     "TTLM" | seq (uint32 LE) | telemetry JSON (same document as POST /pc-stats,
+//                                 keyframe or "delta":1)
+//
+// and is sent to TELEMETRY_PORT, either unicast or to the multicast group so
+// one PC can feed several devices with a single packet. Samples go through the
+// same apply path as /pc-stats. A sample whose sequence
+// number is not newer than the last one from the same PC is dropped as a
+// duplicate or reordered datagram.
+class UdpTelemetryService {
+public:
+    static const uint16_t TELEMETRY_PORT = 4211;
+
+    void begin();
+    // Drains queued datagrams; called from loop() with the state lock held
+    void handle(AppState &state);
+
+private:
+    static const size_t MAX_DATAGRAM = 768;
+    static const int MAX_PACKETS_PER_CALL = 4;
+    // A sender silent for this long may restart its sequence from anywhere
+    static const unsigned long SEQUENCE_RESET_MS = 5000;
+
+    WiFiUDP udp;
+    bool listening = false;
+    char packet[MAX_DATAGRAM];
+
+    struct SenderSeq {
+        uint32_t hash;
+        uint32_t seq;
+        unsigned long acceptedMs;
+    };
+    SenderSeq senders[MAX_PC_HOSTS] = {};
+
+    void handlePacket(AppState &state, size_t length);
+};
+
+#endif
@@ -1,7 +1,7 @@
 #include "WeatherService.h"
 #include <ArduinoJson.h>
 
-WeatherService::WeatherService() {}
+WeatherService::WeatherService(HttpConnectionPool& pool) : pool(pool) {}
 
 String WeatherService::getWeatherDescription(int wmo_code) {
     if (wmo_code == 0) return "Clear Sky";
@@ -29,24 +29,28 @@ bool WeatherService::isWeatherValid(const WeatherData& data) {
     return !isnan(data.temp) && data.weather_code != -1;
 }
 
-bool WeatherService::fetchWeather(const Config& config, WeatherData& data, const String& updateTime) {
+bool WeatherService::fetchWeather(const Config& config, WeatherData& data, const String& updateTime, uint16_t timeoutMs) {
   Serial.println("WeatherService: Fetching weather data from Open-Meteo..."); 
-  HTTPClient http;
-  
   String url = String(WEATHER_API_BASE) + "?latitude=" + String(config.latitude, 4) + 
                "&longitude=" + String(config.longitude, 4) + 
                "&current=temperature_2m,relative_humidity_2m,weather_code,wind_speed_10m,apparent_temperature,is_day";
   
   Serial.println("WeatherService: Requesting weather data from: " + url); 
-  http.setReuse(false); 
-  http.begin(url);
-  http.setTimeout(10000); 
-  int httpCode = http.GET();
+  int httpCode;
+  HTTPClient& http = pool.get(url, timeoutMs, httpCode);
 
   if (httpCode == HTTP_CODE_OK) {
-    String payload = http.getString();
-    DynamicJsonDocument doc(4096); 
-    DeserializationError error = deserializeJson(doc, payload);
+    StaticJsonDocument<128> filter;
+    JsonObject current = filter.createNestedObject("current");
+    current["temperature_2m"] = true;
+    current["apparent_temperature"] = true;
+    current["wind_speed_10m"] = true;
+    current["relative_humidity_2m"] = true;
+    current["weather_code"] = true;
+    current["is_day"] = true;
+
+    StaticJsonDocument<384> doc; 
+    DeserializationError error = deserializeJson(doc, pool.body(http), DeserializationOption::Filter(filter));
 
     if (!error) {
       float temp_c = doc["current"]["temperature_2m"].as<float>();
@@ -65,23 +69,24 @@ bool WeatherService::fetchWeather(const Config& config, WeatherData& data, const
       data.weather_code = doc["current"]["weather_code"].as<int>();
       data.is_day = doc["current"]["is_day"].as<bool>();
       data.update_time = updateTime;
+      data.version++;
       
       Serial.printf("WeatherService: Success! Temp: %.1f%s, Feels Like: %.1f%s, Humidity: %d%%, Wind: %.1f km/h, Code: %d\n", 
                     data.temp, config.temp_unit.c_str(), 
                     data.apparent_temperature, config.temp_unit.c_str(), 
                     data.humidity, data.wind_speed, data.weather_code);
                     
-      http.end();
+      pool.release(http);
       return true;
       
     } else {
       Serial.printf("WeatherService: JSON parsing failed: %s\n", error.c_str()); 
-      http.end();
+      pool.release(http);
       return false;
     }
   } else {
     Serial.printf("WeatherService: Open-Meteo HTTP GET failed, code: %d\n", httpCode); 
-    http.end();
+    pool.release(http);
     return false;
   }
 }
\ No newline at end of file
@@ -3,18 +3,19 @@
 
 #include "structs.h"
 #include <Arduino.h>
-#include <HTTPClient.h>
+#include "HttpConnectionPool.h"
 
 class WeatherService {
 public:
-    WeatherService();
+    WeatherService(HttpConnectionPool& pool);
     
-    bool fetchWeather(const Config& config, WeatherData& data, const String& updateTime);
+    bool fetchWeather(const Config& config, WeatherData& data, const String& updateTime, uint16_t timeoutMs = 10000);
     String getWeatherIcon(int wmo_code);
     String getWeatherDescription(int wmo_code);
     bool isWeatherValid(const WeatherData& data);
 
 private:
+    HttpConnectionPool& pool;
     const char* WEATHER_API_BASE = "https://api.open-meteo.com/v1/forecast";
 };
 
@@ -1,57 +1,92 @@
 #include "WebServerService.h"
+#include <WiFi.h>
 #include <ArduinoJson.h>
 #include <ESPmDNS.h>
-#include "zones.h"
-
-String WebServerService::getCurrentTimeShort(String format) {
-    time_t now = time(nullptr);
-    struct tm timeinfo;
-    localtime_r(&now, &timeinfo);
-    
-    char time_str[12];
-    if (format == "12") {
-        strftime(time_str, sizeof(time_str), "%I:%M", &timeinfo);
-    } else {
-        strftime(time_str, sizeof(time_str), "%H:%M", &timeinfo);
-    }
-    return String(time_str);
+#include <StreamString.h>
+#include "web_assets.h"
+#include "ConfigSchema.h"
+
+// Routes an IDF handler callback to the member function it was registered for
+template <esp_err_t (WebServerService::*Handler)(httpd_req_t*)>
+static esp_err_t dispatch(httpd_req_t* req) {
+  return (static_cast<WebServerService*>(req->user_ctx)->*Handler)(req);
 }
 
-String WebServerService::getFullDate() {
-    struct tm timeinfo;
-    if (!getLocalTime(&timeinfo)) return "No Date";
-    
-    char buffer[32];
-    strftime(buffer, sizeof(buffer), "%A, %b %d", &timeinfo);
-    return String(buffer);
+static esp_err_t dispatchAsset(httpd_req_t* req) {
+  return WebServerService::handleAsset(req, *static_cast<const WebAsset*>(req->user_ctx));
 }
 
-String WebServerService::getWeatherIcon(int wmo_code) {
-  if (wmo_code == 0) return "☀️"; 
-  if (wmo_code == 1 || wmo_code == 2 || wmo_code == 3) return "🌤️"; 
-  if (wmo_code <= 48) return "🌫️"; 
-  if (wmo_code <= 55) return "🌧️"; 
-  if (wmo_code <= 65) return "☔"; 
-  if (wmo_code <= 75) return "❄️"; 
-  if (wmo_code <= 86) return "🌨️"; 
-  if (wmo_code <= 99) return "🌩️"; 
-  return "❓";
+static int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static String urlDecode(const char* encoded) {
+  String decoded;
+  decoded.reserve(strlen(encoded));
+  for (const char* p = encoded; *p; p++) {
+    if (*p == '+') {
+      decoded += ' ';
+    } else if (*p == '%' && hexValue(p[1]) >= 0 && hexValue(p[2]) >= 0) {
+      decoded += (char)(hexValue(p[1]) * 16 + hexValue(p[2]));
+      p += 2;
+    } else {
+      decoded += *p;
+    }
+  }
+  return decoded;
 }
 
 WebServerService::WebServerService(int port, ConfigSaveCallback callback) : 
-  server(port), saveCallback(callback) {}
+  port(port), saveCallback(callback) {}
 
 void WebServerService::setAppState(AppState* appState) {
   state = appState;
 }
 
+void WebServerService::setDisplayService(DisplayService* displayService) {
+  display = displayService;
+}
+
+void WebServerService::setMetrics(MetricsService* metricsService) {
+  metrics = metricsService;
+}
+
+void WebServerService::setStateSerializer(StateSerializer* stateSerializer) {
+  serializer = stateSerializer;
+}
+
 void WebServerService::begin() {
-  server.on("/", HTTP_GET, [this](){ this->handleRoot(); }); 
-  server.on("/save", HTTP_GET, [this](){ this->handleSave(); });
-  server.on("/update", HTTP_GET, [this](){ this->handleUpdate(); }); 
-  server.on("/pc-stats", HTTP_POST, [this](){ this->handlePcStats(); });
-  
-  server.begin();
+  if (!stateMutex) stateMutex = xSemaphoreCreateMutex();
+
+  httpd_config_t httpConfig = HTTPD_DEFAULT_CONFIG();
+  httpConfig.server_port = port;
+  httpConfig.max_open_sockets = MAX_CONNECTIONS;
+  httpConfig.max_uri_handlers = MAX_HANDLERS;
+  httpConfig.stack_size = TASK_STACK_SIZE;
+  httpConfig.lru_purge_enable = true;   // recycle the oldest idle keep-alive socket when all are taken
+  httpConfig.recv_wait_timeout = SOCKET_TIMEOUT_SEC;
+  httpConfig.send_wait_timeout = SOCKET_TIMEOUT_SEC;
+
+  if (httpd_start(&server, &httpConfig) != ESP_OK) {
+    Serial.println("WebServerService: Failed to start HTTP Server.");
+    server = nullptr;
+    return;
+  }
+
+  registerHandler("/save", HTTP_GET, dispatch<&WebServerService::handleSave>, this);
+  registerHandler("/update", HTTP_GET, dispatch<&WebServerService::handleUpdate>, this);
+  registerHandler("/pc-stats", HTTP_POST, dispatch<&WebServerService::handlePcStats>, this);
+  registerHandler("/frame.pbm", HTTP_GET, dispatch<&WebServerService::handleFrame>, this);
+  registerHandler("/metrics", HTTP_GET, dispatch<&WebServerService::handleMetrics>, this);
+  registerHandler("/history", HTTP_GET, dispatch<&WebServerService::handleHistory>, this);
+  registerHandler("/events", HTTP_GET, dispatch<&WebServerService::handleEvents>, this);
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    registerHandler(WEB_ASSETS[i].path, HTTP_GET, dispatchAsset, (void*)&WEB_ASSETS[i]);
+  }
+
   Serial.println("WebServerService: HTTP Server started."); 
   
   String uniqueName = state->config.device_id;
@@ -63,808 +98,70 @@ void WebServerService::begin() {
 }
 
 void WebServerService::handleClient() {
-    server.handleClient();
+    // The callback blocks on the network and the display, so it runs here rather than on the HTTP task
+    if (savePending) {
+        savePending = false;
+        if (saveCallback) saveCallback();
+    }
 }
 
-String WebServerService::generateRootPageContent() {
-  String content;
-  content.reserve(45000); 
-
-  Config& config = state->config;
-  WeatherData& weather = state->weather;
-  AirQualityData& aqi = state->aqi;
-  CryptoData& crypto = state->crypto;
-  CurrencyData& currency = state->currency;
-  StockData& stock = state->stock;
-  PcStats& pc = state->pc;
-  PcMedia& media = state->media;
-  
-  bool weatherValid = !isnan(weather.temp);
-  bool aqiValid = !isnan(aqi.pm25) && !isnan(aqi.pm10) && !isnan(aqi.no2);
-  bool pcValid = pc.cpu_percent > 0.1; 
-  bool cryptoValid = !isnan(crypto.price_usd) && crypto.price_usd > 0;
-  bool currencyValid = currency.updated;
-  bool stockValid = stock.updated;
-
-  content += "<html><head><title>Tinytosh | Web Panel</title>";
-  content += "<meta name='viewport' content='width=device-width, initial-scale=1'><meta charset='UTF-8'>";
-  content += "<style>";
-  // CSS Variables
-  content += ":root { --bg: #0f172a; --card: #1e293b; --accent: #3b82f6; --text: #f1f5f9; --text-muted: #94a3b8; --border: #334155; }";
-
-  // Global Body & Container Styles
-  content += "* { box-sizing: border-box; }";
-  content += "html, body { margin: 0; padding: 0; }";
-  content += "body { font-family: 'Segoe UI', Tahoma, Geneva, Verdana, sans-serif; background-color: var(--bg); color: var(--text); padding: 20px; line-height: 1.6; }";
-  content += ".container { max-width: 800px; margin: 0 auto; }";
-
-  // Header & Time Display
-  content += ".app-header { padding-bottom: 20px; font-size: 2.5rem; color: var(--accent); font-weight: 700; text-align: center; }";
-  content += "#time-display { text-align: center; color: var(--text); font-size: 4.5rem; font-weight: 800; letter-spacing: -2px; }";
-  content += "#location-info { text-align: center; margin-top: 0px; color: var(--text-muted); font-weight: 400; }";
-
-  // Identity Box
-  content += ".identity-box { text-align: center; margin-top: 15px; padding: 12px; background: rgba(0,0,0,0.15); border-radius: 8px; border: 1px solid var(--border); }";
-  content += ".id-text { color: var(--accent); font-weight: 700; text-transform: uppercase; font-family: monospace; font-size: 1.1rem; margin-bottom: 2px; }";
-  content += ".ip-text { font-size: 0.9rem; color: var(--text-muted); font-family: monospace; margin-bottom: 5px; }";
-  content += ".status-badge { text-align: center; font-size: 0.85rem; font-weight: 600; text-transform: uppercase; letter-spacing: 1px; font-family: monospace; }";
-  content += "#pc-link-status { color: #10b981; }";
-
-  // Panels & Tiles (Card Style)
-  content += ".panel { background: var(--card); padding: 25px; border-radius: 12px; border: 1px solid var(--border); margin-bottom: 24px; }";
-  content += ".header-panel { background: rgba(59, 130, 246, 0.05); border: 1px solid var(--accent); }";
-  content += ".panel-title { margin-top: 0; color: var(--accent); font-size: 1.17em; }";
-  content += ".dashboard-grid { display: grid; grid-template-columns: repeat(2, 1fr); gap: 15px; margin-top: 20px; }";
-  content += ".dashboard-grid > div { min-width: 0; }";
-  content += ".tile { background: rgba(15, 23, 42, 0.4); border: 1px dashed var(--border); padding: 20px; border-radius: 10px; text-align: center; }";
-  content += ".tile-icon { font-size: 2.2rem; margin-bottom: 8px; }";
-  content += ".tile-label { font-size: 0.75rem; color: var(--text-muted); text-transform: uppercase; letter-spacing: 1px; }";
-  content += ".tile-value { font-size: 1.6rem; font-weight: 600; color: var(--text); }";
-  content += ".date-val { font-size: 1.2rem; }";
-  content += ".no-data-tile { grid-column: 1 / -1; background: rgba(59, 130, 246, 0.05); border: 1px solid var(--accent); padding: 30px; color: var(--accent); border-radius: 10px; text-align: center; margin-top: 15px; }";
-
-  // Form Elements
-  content += "label { display: block; margin-top: 15px; font-weight: 600; color: var(--text); }";
-  content += "input[type='text'], input[type='number'], input[type='time'], select { display: block; width: 100% !important; padding: 12px; margin: 8px 0; border: 1px solid var(--border); border-radius: 6px; background-color: #0f172a; color: var(--text); font-size: 15px; appearance: none; -webkit-appearance: none; }";
-  content += "select { background-image: url('data:image/svg+xml;utf8,<svg fill=\"%23f1f5f9\" height=\"24\" viewBox=\"0 0 24 24\" width=\"24\" xmlns=\"http://www.w3.org/2000/svg\"><path d=\"M7 10l5 5 5-5z\"/></svg>'); background-repeat: no-repeat; background-position: right 10px center; }";
-  content += "input[type='time'] { text-align: center; }";
-  content += "input[type='time']::-webkit-calendar-picker-indicator { filter: invert(1); cursor: pointer; }";
-  content += "input:focus, select:focus { border-color: var(--accent); outline: none; box-shadow: 0 0 0 3px rgba(59, 130, 246, 0.2); }";
-  content += "input:disabled { opacity: 0.5; cursor: not-allowed; background-color: #1e293b; }";
-  content += "fieldset { border: 1px solid var(--border); border-radius: 8px; padding: 20px; margin-top: 15px; background: rgba(0,0,0,0.1); min-width: 0; overflow: hidden; }";
-  content += "legend { color: var(--accent); font-weight: 700; padding: 0 10px; font-size: 0.9rem; text-transform: uppercase; }";
-
-  // Checkboxes and Radios
-  content += "input[type='checkbox'], input[type='radio'] { accent-color: var(--accent); cursor: pointer; width: 16px; height: 16px; }";
-  content += ".checkbox-label { display: flex; align-items: center; gap: 8px; margin-top: 10px; cursor: pointer; font-weight: 600; }";
-  content += ".radio-group { display: flex; gap: 15px; margin-top: 8px; }";
-  content += ".radio-label { display: flex; align-items: center; gap: 6px; cursor: pointer; margin-top: 0; font-weight: normal; }";
-
-  // Animation Control Styles
-  content += ".anim-label { margin-top: 20px; margin-bottom: 10px; font-weight: 600; display: block; }";
-  content += ".anim-grid { display: grid; grid-template-columns: 1fr 1fr; gap: 8px; margin-bottom: 15px; padding: 12px; background: rgba(255,255,255,0.05); border-radius: 8px; border: 1px solid rgba(255,255,255,0.1); }";
-  content += ".anim-item { display: flex; align-items: center; gap: 6px; cursor: pointer; font-size: 0.9em; margin-top: 0; }";
-
-  // Draggable Screens List
-  content += ".sortable-list { list-style: none; padding: 0; margin: 15px 0 0; border: 1px solid var(--border); border-radius: 8px; overflow: hidden; background: rgba(0,0,0,0.1); }";
-  content += ".sortable-item { padding: 12px 15px; border-bottom: 1px solid var(--border); display: flex; align-items: center; cursor: grab; color: var(--text); background: var(--card); transition: background 0.2s, opacity 0.2s; }";
-  content += ".sortable-item:last-child { border-bottom: none; }";
-  content += ".sortable-item:active { cursor: grabbing; }";
-  content += ".sortable-item.disabled { opacity: 0.4; background: transparent; cursor: default; }";
-  content += ".drag-handle { margin-right: 15px; color: var(--text-muted); font-size: 1.2rem; }";
-  content += ".sortable-item.dragging { opacity: 0.5; background: rgba(59, 130, 246, 0.2); }";
-
-  // Helpers & Misc
-  content += "button { background-color: var(--accent); color: white; padding: 16px; border: none; border-radius: 8px; cursor: pointer; margin-top: 8px; width: 100%; font-size: 1.1rem; font-weight: 700; transition: opacity 0.2s; }";
-  content += "button:hover { opacity: 0.9; }";
-  content += ".help-text { font-size: 0.8em; color: var(--text-muted); margin-top: 8px; }";
-  content += ".mt-0 { margin-top: 0 !important; }";
-  content += ".update-footer { text-align: center; font-size: 0.8rem; color: var(--text-muted); margin-top: 15px; font-family: monospace; }";
-  content += ".collapsible { transition: all 0.3s ease; }";
-  content += ".hidden { display: none !important; }";
-  content += "hr { border: 0; border-top: 1px solid var(--border); margin: 25px 0; }";
-  content += "@media (max-width: 600px) { .dashboard-grid { grid-template-columns: 1fr; } #time-display { font-size: 3.5rem; } }";
-  content += "</style></head><body><div class='container'>";
-
-  content += "<div class='app-header'>Tinytosh</div>";
-  content += "<div class='panel header-panel'><div id='time-display'>" + getCurrentTimeShort(config.time_format) + "</div>"; 
-  content += "<h2 id='location-info'>📍 " + config.city + " (" + config.timezone + ")</h2>"; 
-  
-  String pairedPc = config.active_pc_id;
-  int lastDash = pairedPc.lastIndexOf(':');
-  if (lastDash > 3) pairedPc = pairedPc.substring(0, lastDash);
-
-  bool isPcPaired = (pairedPc != "" && (millis() - pc.last_update < 5000));
-  String pcStatus = isPcPaired ? ("🔒 Paired to " + pairedPc) : "";
-  String ipAddress = WiFi.localIP().toString();
-
-  content += "<div class='identity-box'>";
-  content += "<div class='id-text'>" + config.device_id + "</div>";
-  content += "<div class='ip-text'>IP: " + ipAddress + "</div>";
-  content += "<div id='pc-link-status' class='status-badge'>" + pcStatus + "</div>";
-  content += "</div></div>";
-
-  content += "<form method='get' action='/save'>";
-
-  // Combined Global Settings & Location Panel
-  content += "<div class='panel'><h3 class='panel-title'>Global Settings</h3>";
-
-  // Hardware/Interval Settings
-  content += "<label>Data Sync Interval (Mins):</label><input type='number' name='refresh_min' value='" + String(config.refresh_interval_min) + "'>";
-  
-  // Auto Cycle Checkbox
-  content += "<label class='checkbox-label mt-0' style='margin-top: 10px !important;'><input type='checkbox' id='autoCycle' name='auto_cycle' value='1' " + String(config.screen_auto_cycle ? "checked" : "") + "> Cycle Screens Automatically</label>";
-  content += "<p class='help-text mt-0'>If disabled, screens will only change when you press the button.</p>";
-  
-  // Screen Cycle Interval
-  content += "<label>Screen Cycle Interval (Secs):</label><input type='number' id='screenIntInput' name='screen_int' value='" + String(config.screen_interval_sec) + "'>";
-
-  // Animation Checkboxes
-  content += "<label class='anim-label'>Active Animations:</label>";
-  content += "<p class='help-text mt-0' style='margin-bottom: 10px;'>If 'None' is unchecked, select which animations to cycle through.</p>";
-  
-  content += "<div class='anim-grid'>";
-  
-  const char* animLabels[] = {
-    "🚫 None",              // 0
-    "↔️ Slide Horizontal",  // 1
-    "↕️ Slide Vertical",    // 2
-    "👾 Dissolve (Noise)",  // 3
-    "🎭 Curtain Open",      // 4
-    "🎹 Venetian Blinds"    // 5
-  };
-
-  content += "<input type='hidden' id='finalMask' name='anim_mask' value='" + String(config.anim_mask) + "'>";
-
-  bool isNone = (config.anim_mask == 0);
-  content += "<label class='anim-item'>"; 
-  content += "<input type='checkbox' id='animNone' " + String(isNone ? "checked" : "") + ">";
-  content += String(animLabels[0]);
-  content += "</label>";
-
-  for (int i = 1; i <= 5; i++) {
-    bool isSet = (config.anim_mask & (1 << i));
-    String checked = isSet ? "checked" : "";
-    
-    content += "<label class='anim-item'>";
-    content += "<input type='checkbox' class='anim-chk' value='" + String(1 << i) + "' " + checked + ">";
-    content += String(animLabels[i]);
-    content += "</label>";
-  }
-  content += "</div>";
-
-  // Time Format Radios
-  content += "<label>Time Format:</label><div class='radio-group'>";
-  content += "<label class='radio-label'><input type='radio' name='time_format' value='24' " + String(config.time_format == "24" ? "checked" : "") + "> 24-Hour</label>";
-  content += "<label class='radio-label'><input type='radio' name='time_format' value='12' " + String(config.time_format == "12" ? "checked" : "") + "> 12-Hour</label></div>";
-  content += "<p class='help-text'>Format affects both the OLED display and the Web Panel.</p>";
-
-  content += "<hr>";
-
-  // Location Sub-section
-  content += "<label class='checkbox-label mt-0'><input type='checkbox' id='autoDetect' name='auto_detect' value='1' " + String(config.auto_detect ? "checked" : "") + "> Detect Location Automatically (IP)</label>";
-  content += "<p class='help-text mt-0'>Uses your IP address to determine city, coordinates, and timezone.</p>";
-
-  content += "<fieldset id='manualFields' class='collapsible'>";
-  content += "<legend>Manual Location Entry</legend>";
-
-  content += "<label>City Name:</label><input type='text' name='city' value='" + config.city + "'>";
+bool WebServerService::lockState(TickType_t wait) {
+    if (!stateMutex) return true;
+    return xSemaphoreTake(stateMutex, wait) == pdTRUE;
+}
 
-  content += "<div class='dashboard-grid mt-0'>";
-  content += "  <div><label class='mt-0'>Latitude:</label><input type='number' step='any' name='latitude' value='" + String(config.latitude, 4) + "'></div>";
-  content += "  <div><label class='mt-0'>Longitude:</label><input type='number' step='any' name='longitude' value='" + String(config.longitude, 4) + "'></div>";
-  content += "</div>";
+void WebServerService::unlockState() {
+    if (stateMutex) xSemaphoreGive(stateMutex);
+}
 
-  content += "<label>Timezone:</label><select name='timezone'>";
-  DynamicJsonDocument tzDoc(6144); 
-  deserializeJson(tzDoc, POSIX_TIMEZONE_MAP); 
-  for (JsonPair p : tzDoc.as<JsonObject>()) {
-      String key = p.key().c_str();
-      content += "<option value='" + key + "'" + (key == config.timezone ? " selected" : "") + ">" + key + "</option>";
-  }
-  content += "</select></fieldset>";
+void WebServerService::registerHandler(const char* uri, http_method method, esp_err_t (*handler)(httpd_req_t*), void* ctx) {
+    httpd_uri_t route = {};
+    route.uri = uri;
+    route.method = method;
+    route.handler = handler;
+    route.user_ctx = ctx;
+    if (httpd_register_uri_handler(server, &route) != ESP_OK) {
+        Serial.printf("WebServerService: Failed to register %s\n", uri);
+    }
+}
 
-  content += "<hr>";
-  
-  // Night Mode Sub-section
-  content += "<label class='checkbox-label mt-0'><input type='checkbox' id='nightMode' name='night_mode' value='1' " + String(config.night_mode ? "checked" : "") + "> Enable Night Mode</label>";
-  content += "<p class='help-text mt-0'>Set a quiet schedule to pause animations, dim the screen, or save API calls.</p>";
+void WebServerService::loadQuery(httpd_req_t* req) {
+    query = "";
+    size_t len = httpd_req_get_url_query_len(req);
+    if (len == 0) return;
 
-  content += "<fieldset id='nightFields' class='collapsible'>";
-  content += "<legend>Night Schedule</legend>";
+    char* buf = (char*)malloc(len + 1);
+    if (!buf) return;
+    if (httpd_req_get_url_query_str(req, buf, len + 1) == ESP_OK) query = buf;
+    free(buf);
+}
 
-  content += "<div class='dashboard-grid mt-0'>";
-  content += "  <div><label class='mt-0'>Start Time:</label><input type='time' name='night_start' value='" + String(config.night_start) + "'></div>";
-  content += "  <div><label class='mt-0'>End Time:</label><input type='time' name='night_end' value='" + String(config.night_end) + "'></div>";
-  content += "</div>";
-  
-  content += "<label>Screen Action:</label><select name='night_action'>";
-  content += "<option value='0' " + String(config.night_action == 0 ? "selected" : "") + ">No Visual Change</option>";
-  content += "<option value='1' " + String(config.night_action == 1 ? "selected" : "") + ">Dim Display</option>";
-  content += "<option value='2' " + String(config.night_action == 2 ? "selected" : "") + ">Turn Display Off</option>";
-  content += "</select></fieldset></div>";
-
-  // Screen Display Order Panel
-  content += "<div class='panel'><h3 class='panel-title'>Screen Display Order</h3>";
-  content += "<p class='help-text mt-0' style='margin-bottom: 15px;'>Drag and drop to rearrange. Disabled screens are locked at the bottom.</p>";
-  
-  content += "<ul id='sortable-list' class='sortable-list'>";
-  
-  for (int screenId = 0; screenId < NUM_SCREENS; screenId++) {
-    
-    String targetId = "";
-    switch(screenId) {
-      case SCREEN_TIME: targetId = "showTime"; break;
-      case SCREEN_WEATHER: targetId = "showWeather"; break;
-      case SCREEN_AIR_QUALITY: targetId = "showAQI"; break;
-      case SCREEN_CRYPTO: targetId = "showCrypto"; break;
-      case SCREEN_CURRENCY: targetId = "showCurrency"; break;
-      case SCREEN_STOCK: targetId = "showStock"; break;
-      case SCREEN_PC_MONITOR: targetId = "showPc"; break;
-      case SCREEN_PC_MEDIA: targetId = "showMedia"; break;
-    }
-    
-    content += "<li class='sortable-item' data-id='" + String(screenId) + "' data-target='" + targetId + "' draggable='true'>";
-    content += "<span class='drag-handle'>☰</span>";
-    content += String(SCREEN_NAMES[screenId]);
-    content += "</li>";
-  }
-  content += "</ul>";
-  content += "<input type='hidden' name='screen_order' id='screenOrderInput' value=''>";
-  content += "</div>";
-
-  // Dynamic Screen Panels
-  content += "<div id='dynamic-panels-container'>";
-  for (int i = 0; i < NUM_SCREENS; i++) {
-      int screenId = config.screen_order[i];
-
-      switch (screenId) {
-          case SCREEN_TIME: {
-              content += "<div class='panel' id='panel-" + String(screenId) + "'>";
-              content += "<label class='checkbox-label mt-0'><input type='checkbox' id='showTime' name='show_time' value='1' " + String(config.show_time ? "checked" : "") + "> Time Screen</label>";
-
-              content += "<div id='timeContent' class='collapsible'>";
-              content += "<div class='dashboard-grid'>";
-
-              content += "<div class='tile'>";
-              content += "<div class='tile-icon'>🕒</div>";
-              content += "<div class='tile-value' id='preview-time'>" + getCurrentTimeShort(config.time_format) + "</div>";
-              content += "<div class='tile-label'>Current Time</div>";
-              content += "</div>";
-
-              content += "<div class='tile'>";
-              content += "<div class='tile-icon'>📅</div>";
-              content += "<div class='tile-value date-val' id='preview-date'>" + getFullDate() + "</div>";
-              content += "<div class='tile-label'>Current Date</div>";
-              content += "</div></div>";
-
-              content += "<label class='checkbox-label'><input type='checkbox' name='date_display' value='1' " + String(config.date_display ? "checked" : "") + "> Display Date</label>";
-              content += "</div></div>";
-              break;
-          }
-          
-          case SCREEN_WEATHER: {
-              content += "<div class='panel' id='panel-" + String(screenId) + "'>";
-              content += "<label class='checkbox-label mt-0'><input type='checkbox' id='showWeather' name='show_weather' value='1' " + String(config.show_weather ? "checked" : "") + "> Weather Screen</label>";
-              content += "<div id='weatherContent' class='collapsible'>";
-              
-              if (!weatherValid) {
-                  content += "<div id='weather-no-data' class='no-data-tile'>☁️ Weather data will be available after sync</div>";
-                  content += "<div id='weather-grid' class='hidden'>";
-              } else {
-                  content += "<div id='weather-no-data' class='no-data-tile hidden'>☁️ Weather data will be available after sync</div>";
-                  content += "<div id='weather-grid'>";
-              }
-              
-              content += "<div class='dashboard-grid'>";
-              content += "<div class='tile'><div class='tile-icon' id='icon-temp'>" + getWeatherIcon(weather.weather_code) + "</div><div class='tile-value' id='value-temp'>" + String(weather.temp, 1) + " °" + config.temp_unit + "</div><div class='tile-label'>Temperature</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>🤒</div><div class='tile-value' id='value-feels'>" + String(weather.apparent_temperature, 1) + " °" + config.temp_unit + "</div><div class='tile-label'>Feels Like</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>💧</div><div class='tile-value' id='value-hum'>" + String(weather.humidity) + "%</div><div class='tile-label'>Humidity</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>💨</div><div class='tile-value' id='value-wind'>" + String(weather.wind_speed, 1) + " km/h</div><div class='tile-label'>Wind Speed</div></div>";
-              content += "</div>";
-              content += "<div class='update-footer' id='weather-upd'>Last Update: " + weather.update_time + "</div></div>";
-              
-              content += "<label>Temperature Unit:</label><div class='radio-group'>";
-              content += "<label class='radio-label'><input type='radio' name='temp_unit' value='C' " + String(config.temp_unit == "C" ? "checked" : "") + "> °C</label>";
-              content += "<label class='radio-label'><input type='radio' name='temp_unit' value='F' " + String(config.temp_unit == "F" ? "checked" : "") + "> °F</label></div>";
-              
-              content += "<label class='checkbox-label'><input type='checkbox' name='round_temps' value='1' " + String(config.round_temps ? "checked" : "") + "> Round Temperature Values</label>";
-              content += "</div></div>";
-              break;
-          }
-
-          case SCREEN_AIR_QUALITY: {
-              content += "<div class='panel' id='panel-" + String(screenId) + "'>";
-              content += "<label class='checkbox-label mt-0'><input type='checkbox' id='showAQI' name='show_aqi' value='1' " + String(config.show_aqi ? "checked" : "") + "> Air Quality Screen</label>";
-              content += "<div id='aqiContent' class='collapsible'>";
-
-              if (!aqiValid) {
-                  content += "<div id='aqi-no-data' class='no-data-tile'>🍃 Air quality data will be available after sync</div>";
-                  content += "<div id='aqi-grid' class='hidden'>";
-              } else {
-                  content += "<div id='aqi-no-data' class='no-data-tile hidden'>🍃 Air quality data will be available after sync</div>";
-                  content += "<div id='aqi-grid'>";
-              }
-              
-              content += "<div class='dashboard-grid'>";
-              content += "<div class='tile'><div class='tile-icon'>🍃</div><div class='tile-value' id='value-aqi'>" + String(aqi.aqi) + "</div><div class='tile-label'>" + aqi.status + " Index</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>🌫️</div><div class='tile-value' id='value-pm25'>" + String(aqi.pm25, 1) + " <small>µg</small></div><div class='tile-label'>PM 2.5</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>🏭</div><div class='tile-value' id='value-pm10'>" + String(aqi.pm10, 1) + " <small>µg</small></div><div class='tile-label'>PM 10</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>🧪</div><div class='tile-value' id='value-no2'>" + String(aqi.no2, 1) + " <small>µg</small></div><div class='tile-label'>Nitrogen Dioxide</div></div>";
-              content += "</div>";
-              content += "<div class='update-footer' id='aqi-upd'>Last Update: " + weather.update_time + "</div></div>";
-
-              content += "<label>AQI Standard:</label><div class='radio-group'>";
-              content += "<label class='radio-label'><input type='radio' name='aqi_type' value='US' " + String(config.aqi_type == "US" ? "checked" : "") + "> US Standard</label>";
-              content += "<label class='radio-label'><input type='radio' name='aqi_type' value='EU' " + String(config.aqi_type == "EU" ? "checked" : "") + "> European Standard</label></div>";
-              content += "<p class='help-text mt-0'>EU: 0-100+ scale | US: 0-500 scale</p>";
-
-              content += "</div></div>";
-              break;
-          }
-
-          case SCREEN_STOCK: {
-              content += "<div class='panel' id='panel-" + String(screenId) + "'>";
-              content += "<label class='checkbox-label mt-0'><input type='checkbox' id='showStock' name='show_stock' value='1' " + String(config.show_stock ? "checked" : "") + "> Stock Tracking Screen</label>";
-              content += "<div id='stockContent' class='collapsible'>";
-              
-              if (!stockValid) {
-                  content += "<div id='stock-no-data' class='no-data-tile'>📈 Stock data will be available after sync</div>";
-                  content += "<div id='stock-grid' class='hidden'>";
-              } else {
-                  content += "<div id='stock-no-data' class='no-data-tile hidden'>📈 Stock data will be available after sync</div>";
-                  content += "<div id='stock-grid'>";
-              }
-              
-              content += "<div class='dashboard-grid'>";
-              content += "<div class='tile'><div class='tile-icon'>📊</div><div class='tile-value' id='stock-price'>$" + String(stock.price, 2) + "</div><div class='tile-label' id='stock-sym'>" + stock.symbol + " Price</div></div>";
-              content += "<div class='tile'><div class='tile-icon' id='stock-trend-icon'>" + String(stock.percent_change >= 0 ? "📈" : "📉") + "</div><div class='tile-value' id='stock-change'>" + String(stock.percent_change, 2) + "%</div><div class='tile-label'>Daily Change</div></div>";
-              content += "</div>";
-              content += "<div class='update-footer' id='stock-upd'>Last Update: " + weather.update_time + "</div></div>";
-
-              content += "<label>Track Stock/ETF:</label><select name='stock_symbol'>";
-              for(auto s : topStocks) {
-                  content += "<option value='" + String(s.ticker) + "' " + 
-                             (String(config.stock_symbol) == String(s.ticker) ? "selected" : "") + 
-                             ">" + String(s.name) + " - " + String(s.ticker) + "</option>";
-              }
-              content += "</select>";
-              content += "<label class='checkbox-label'><input type='checkbox' name='stock_fn' value='1' " + String(config.stock_fn ? "checked" : "") + "> Display Full Company Name</label>";
-              content += "</div></div>";
-              break;
-          }
-
-          case SCREEN_CRYPTO: {
-              content += "<div class='panel' id='panel-" + String(screenId) + "'>";
-              content += "<label class='checkbox-label mt-0'><input type='checkbox' id='showCrypto' name='show_crypto' value='1' " + String(config.show_crypto ? "checked" : "") + "> Crypto Tracking Screen</label>";
-              content += "<div id='cryptoContent' class='collapsible'>";
-              
-              if (!cryptoValid) {
-                  content += "<div id='crypto-no-data' class='no-data-tile'>💰 Crypto data will be available after sync</div>";
-                  content += "<div id='crypto-grid' class='hidden'>";
-              } else {
-                  content += "<div id='crypto-no-data' class='no-data-tile hidden'>💰 Crypto data will be available after sync</div>";
-                  content += "<div id='crypto-grid'>";
-              }
-              
-              content += "<div class='dashboard-grid'>";
-              content += "<div class='tile'><div class='tile-icon'>₿</div><div class='tile-value' id='crypto-price'>" + String((int)round(crypto.price_usd)) + "$</div><div class='tile-label' id='crypto-sym'>" + crypto.symbol + " Price</div></div>";
-              content += "<div class='tile'><div class='tile-icon' id='crypto-trend-icon'>" + String(crypto.percent_change_24h >= 0 ? "📈" : "📉") + "</div><div class='tile-value' id='crypto-change'>" + String(crypto.percent_change_24h, 1) + "%</div><div class='tile-label'>24h Change</div></div>";
-              content += "</div>";
-              content += "<div class='update-footer' id='crypto-upd'>Last Update: " + weather.update_time + "</div></div>";
-              
-              content += "<label>Track Cryptocurrency:</label><select name='crypto_id'>";
-              for(auto coin : topCoins) {
-                  content += "<option value='" + String(coin.id) + "' " + (config.crypto_id == coin.id ? "selected" : "") + ">" + String(coin.sym) + "</option>";
-              }
-              content += "</select>";
-              content += "<label class='checkbox-label'><input type='checkbox' name='crypto_fn' value='1' " + String(config.crypto_fn ? "checked" : "") + "> Display Full Coin Name</label>";
-              content += "</div></div>";
-              break;
-          }
-
-          case SCREEN_CURRENCY: {
-              content += "<div class='panel' id='panel-" + String(screenId) + "'>";
-              content += "<label class='checkbox-label mt-0'><input type='checkbox' id='showCurrency' name='show_currency' value='1' " + String(config.show_currency ? "checked" : "") + "> Currency Exchange Screen</label>";
-              content += "<div id='currencyContent' class='collapsible'>";
-              
-              if (!currencyValid) {
-                  content += "<div id='currency-no-data' class='no-data-tile'>💱 Currency data will be available after sync</div>";
-                  content += "<div id='currency-grid' class='hidden'>";
-              } else {
-                  content += "<div id='currency-no-data' class='no-data-tile hidden'>💱 Currency data will be available after sync</div>";
-                  content += "<div id='currency-grid'>";
-              }
-              
-              content += "<div class='dashboard-grid'>";
-              float displayRate = currency.rate * config.currency_multiplier;
-              int decimals = 0;
-              if (displayRate < 10.0) decimals = 3;
-              else if (displayRate < 100.0) decimals = 2;
-              else if (displayRate < 1000.0) decimals = 1;
-
-              content += "<div class='tile'><div class='tile-icon'>💵</div><div class='tile-value' id='currency-base-val'>" + String(config.currency_multiplier) + " " + currency.base + "</div><div class='tile-label'>Base Amount</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>💱</div><div class='tile-value' id='currency-target-val'>" + String(displayRate, decimals) + " " + currency.target + "</div><div class='tile-label'>Exchange Rate</div></div>";
-              content += "</div>";
-              content += "<div class='update-footer' id='currency-upd'>Last Update: " + weather.update_time + "</div></div>";
-
-              content += "<div class='dashboard-grid mt-0'>";
-              
-              content += "<div><label class='mt-0'>Base Currency:</label><select name='currency_base'>";
-              for(auto c : allCurrencies) {
-                  String codeDisplay = String(c.code).substring(0, 3);
-                  codeDisplay.toUpperCase(); 
-                  content += "<option value='" + String(c.code) + "' " + (String(config.currency_base) == String(c.code) ? "selected" : "") + ">" + codeDisplay + "</option>";
-              }
-              content += "</select></div>";
-
-              content += "<div><label class='mt-0'>Target Currency:</label><select name='currency_target'>";
-              for(auto c : allCurrencies) {
-                  String codeDisplay = String(c.code).substring(0, 3);
-                  codeDisplay.toUpperCase(); 
-                  content += "<option value='" + String(c.code) + "' " + (String(config.currency_target) == String(c.code) ? "selected" : "") + ">" + codeDisplay + "</option>";
-              }
-              content += "</select></div>";
-              
-              content += "</div>";
-
-              content += "<label>Multiplier Amount:</label><select name='currency_multiplier'>";
-              int multipliers[] = {1, 10, 100, 1000, 10000, 100000};
-              for (int m : multipliers) {
-                  content += "<option value='" + String(m) + "' " + (config.currency_multiplier == m ? "selected" : "") + ">" + String(m) + "</option>";
-              }
-              content += "</select>";
-              content += "<label class='checkbox-label'><input type='checkbox' name='currency_fn' value='1' " + String(config.currency_fn ? "checked" : "") + "> Display Full Currency Name</label>";
-              content += "</div></div>";
-              break;
-          }
-
-          case SCREEN_PC_MONITOR: {
-              content += "<div class='panel' id='panel-" + String(screenId) + "'>";
-              content += "<label class='checkbox-label mt-0'><input type='checkbox' id='showPc' name='show_pc' value='1' " + String(config.show_pc ? "checked" : "") + "> PC Monitoring Screen</label>";
-              content += "<div id='pcContent' class='collapsible'>";
-              
-              if (!pcValid) {
-                  content += "<div id='pc-no-data' class='no-data-tile'>🖥️ PC data will be available after sync</div>";
-                  content += "<div id='pc-grid' class='hidden'>";
-              } else {
-                  content += "<div id='pc-no-data' class='no-data-tile hidden'>🖥️ PC data will be available after sync</div>";
-                  content += "<div id='pc-grid'>";
-              }
-              
-              content += "<div class='dashboard-grid'>";
-              content += "<div class='tile'><div class='tile-icon'>📊</div><div class='tile-value' id='pc-cpu'>" + String((int)round(pc.cpu_percent)) + "%</div><div class='tile-label'>CPU Usage</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>🧠</div><div class='tile-value' id='pc-ram'>" + String((int)round(pc.mem_percent)) + "%</div><div class='tile-label'>RAM Usage</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>💽</div><div class='tile-value' id='pc-disk'>" + String((int)round(pc.disk_percent)) + "%</div><div class='tile-label'>Disk Usage</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>⬇️</div><div class='tile-value' id='pc-net'>" + String((int)round(pc.net_down_kb)) + " KB/s</div><div class='tile-label'>Download</div></div>";      
-              content += "</div></div>";
-              content += "<label class='checkbox-label'><input type='checkbox' name='hide_empty_pc' value='1' " + String(config.hide_empty_pc ? "checked" : "") + "> Hide empty screen</label>";
-              content += "<p class='help-text mt-0'>Screen is excluded from rotation when there is no data.</p>";
-              content += "</div></div>";
-              break;
-          }
-
-          case SCREEN_PC_MEDIA: {
-              content += "<div class='panel' id='panel-" + String(screenId) + "'>";
-              content += "<label class='checkbox-label mt-0'><input type='checkbox' id='showMedia' name='show_media' value='1' " + String(config.show_media ? "checked" : "") + "> PC Media Screen</label>";
-              content += "<div id='mediaContent' class='collapsible'>";
-              content += "<div class='dashboard-grid'>";
-              content += "<div class='tile'><div class='tile-icon'>🎵</div><div class='tile-value' id='web-media-status' style='font-size:1.2rem'>" + media.status + "</div><div class='tile-label'>Status</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>🎧</div><div class='tile-value' id='web-media-name' style='font-size:1.2rem'>" + media.name + "</div><div class='tile-label'>Track</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>👤</div><div class='tile-value' id='web-media-author' style='font-size:1.2rem'>" + media.author + "</div><div class='tile-label'>Author</div></div>";
-              content += "<div class='tile'><div class='tile-icon'>💿</div><div class='tile-value' id='web-media-album' style='font-size:1.2rem'>" + media.album + "</div><div class='tile-label'>Album</div></div>";
-              content += "</div>";
-              content += "<label class='checkbox-label'><input type='checkbox' name='hide_empty_media' value='1' " + String(config.hide_empty_media ? "checked" : "") + "> Hide empty screen</label>";
-              content += "<p class='help-text mt-0'>Screen is excluded from rotation when there is no data.</p>";
-              content += "</div></div>";
-              break;
-          }
-      }
-  }
+bool WebServerService::hasArg(const char* name) {
+    char value[1];
+    esp_err_t err = httpd_query_key_value(query.c_str(), name, value, sizeof(value));
+    return err == ESP_OK || err == ESP_ERR_HTTPD_RESULT_TRUNC;
+}
 
-  content += "</div>";
-  content += "<button type='submit'>💾 Save & Apply All Settings</button></form>";
-  
-  content += "<script>";
-  content += "let formDirty = false;";
-  content += "function updateVisibility(){";
-  
-  content += "  var pairs = [['autoDetect','manualFields',true], ['nightMode','nightFields',false], ['showTime', 'timeContent',false], ['showWeather','weatherContent',false], ['showPc','pcContent',false], ['showCrypto','cryptoContent',false], ['showCurrency','currencyContent',false], ['showStock','stockContent',false], ['showAQI','aqiContent',false], ['showMedia','mediaContent',false]];";  
-  content += "  pairs.forEach(p => {";
-  content += "    var ch = document.getElementById(p[0]); if(!ch) return;";
-  content += "    var target = document.getElementById(p[1]);";
-  content += "    var shouldHide = p[2] ? ch.checked : !ch.checked;";
-  content += "    target.className = shouldHide ? 'collapsible hidden' : 'collapsible';";
-  content += "    target.querySelectorAll('input, select').forEach(el => el.disabled = shouldHide);";
-  content += "  });";
-
-  content += "  var ac = document.getElementById('autoCycle');";
-  content += "  var si = document.getElementById('screenIntInput');";
-  content += "  if(ac && si) si.disabled = !ac.checked;";
-  content += "}";
-  
-  content += "['autoDetect', 'nightMode', 'showTime', 'showWeather', 'showPc', 'showCrypto', 'showCurrency', 'showStock', 'showAQI', 'showMedia', 'autoCycle'].forEach(id => { var el=document.getElementById(id); if(el) el.addEventListener('change', updateVisibility); });";
-  content += "updateVisibility();";
-
-  // Handle "None" Checkbox Logic
-  content += "function toggleNone() {";
-  content += "  const noneBox = document.getElementById('animNone');";
-  content += "  const others = document.querySelectorAll('.anim-chk');";
-  content += "  others.forEach(cb => {";
-  content += "    cb.disabled = noneBox.checked;";
-  content += "    if(noneBox.checked) cb.checked = false;";
-  content += "    cb.parentElement.style.opacity = noneBox.checked ? '0.5' : '1';";
-  content += "  });";
-  content += "}";
-
-  content += "function checkSafetyNet() {";
-  content += "  if(!document.getElementById('animNone').checked) {";
-  content += "    let count = 0;";
-  content += "    document.querySelectorAll('.anim-chk').forEach(cb => { if(cb.checked) count++; });";
-  content += "    if(count === 0) {";
-  content += "      document.getElementById('animNone').checked = true;";
-  content += "      toggleNone();";
-  content += "    }";
-  content += "  }";
-  content += "}";
-
-  content += "const nb = document.getElementById('animNone');";
-  content += "if(nb) nb.addEventListener('change', toggleNone);";
-
-  content += "document.querySelectorAll('.anim-chk').forEach(cb => {";
-  content += "  cb.addEventListener('change', checkSafetyNet);";
-  content += "});";
-  
-  content += "toggleNone();";
-
-  content += "const list = document.getElementById('sortable-list');";
-  content += "const orderInput = document.getElementById('screenOrderInput');";
-
-  // Function to sync DOM list with checkbox states using the data-target attribute
-  content += "function syncScreenOrder() {";
-  content += "  const items = [...list.querySelectorAll('.sortable-item')];";
-  content += "  let enabled = [], disabled = [];";
-  content += "  items.forEach(item => {";
-  content += "    const targetId = item.getAttribute('data-target');";
-  content += "    const cb = document.getElementById(targetId);";
-  content += "    if (cb && cb.checked) {";
-  content += "      item.classList.remove('disabled'); item.setAttribute('draggable', 'true'); enabled.push(item);";
-  content += "    } else {";
-  content += "      item.classList.add('disabled'); item.removeAttribute('draggable'); disabled.push(item);";
-  content += "    }";
-  content += "  });";
-  content += "  list.innerHTML = '';";
-  content += "  enabled.forEach(el => list.appendChild(el));"; 
-  content += "  disabled.forEach(el => list.appendChild(el));"; 
-  content += "  updateOrderValue();";
-  content += "}";
-
-  content += "function reorderPhysicalPanels(orderCsv) {";
-  content += "  const container = document.getElementById('dynamic-panels-container');";
-  content += "  if (!container || !orderCsv) return;";
-  content += "  const orderArr = orderCsv.split(',');";
-  content += "  orderArr.forEach(id => {";
-  content += "    const panel = document.getElementById('panel-' + id);";
-  content += "    if (panel) container.appendChild(panel);";
-  content += "  });";
-  content += "}";
-
-  content += "function updateOrderValue() {";
-  content += "  const items = [...list.querySelectorAll('.sortable-item')];";
-  content += "  orderInput.value = items.map(item => item.getAttribute('data-id')).join(',');";
-  content += "  reorderPhysicalPanels(orderInput.value);";
-  content += "}";
-
-  // Hook Checkboxes to the sync function
-  content += "const panelCheckboxes = ['showTime', 'showWeather', 'showAQI', 'showCrypto', 'showCurrency', 'showStock', 'showPc', 'showMedia'];";
-  content += "panelCheckboxes.forEach(id => {";
-  content += "  const el = document.getElementById(id);";
-  content += "  if (el) el.addEventListener('change', syncScreenOrder);";
-  content += "});";
-
-  // Universal Drag & Touch Logic
-  content += "function getDragAfterEl(y) {";
-  content += "  return [...list.querySelectorAll('.sortable-item:not(.dragging):not(.disabled)')].reduce((closest, child) => {";
-  content += "    const box = child.getBoundingClientRect();";
-  content += "    const offset = y - box.top - box.height / 2;";
-  content += "    if (offset < 0 && offset > closest.offset) return { offset: offset, element: child };";
-  content += "    else return closest;";
-  content += "  }, { offset: Number.NEGATIVE_INFINITY }).element;";
-  content += "}";
-
-  content += "function moveItem(y) {";
-  content += "  const draggable = document.querySelector('.dragging');";
-  content += "  if (!draggable) return;";
-  content += "  const afterEl = getDragAfterEl(y);";
-  content += "  if (afterEl == null) {";
-  content += "    const firstDis = list.querySelector('.disabled');";
-  content += "    if (firstDis) list.insertBefore(draggable, firstDis);";
-  content += "    else list.appendChild(draggable);";
-  content += "  } else { list.insertBefore(draggable, afterEl); }";
-  content += "}";
-
-  // Standard Mouse Events (PC)
-  content += "list.addEventListener('dragstart', e => { if (e.target.classList.contains('disabled')) { e.preventDefault(); return; } e.target.classList.add('dragging'); });";
-  content += "list.addEventListener('dragend', e => { e.target.classList.remove('dragging'); updateOrderValue(); formDirty = true; });";
-  content += "list.addEventListener('dragover', e => { e.preventDefault(); moveItem(e.clientY); });";
-
-  // Touch Events (Mobile)
-  content += "list.addEventListener('touchstart', e => {";
-  content += "  const item = e.target.closest('.sortable-item');";
-  content += "  if (!item || item.classList.contains('disabled')) return;";
-  content += "  item.classList.add('dragging');";
-  content += "}, {passive: false});";
-
-  content += "list.addEventListener('touchmove', e => {";
-  content += "  if (!document.querySelector('.dragging')) return;";
-  content += "  e.preventDefault();"; 
-  content += "  moveItem(e.touches[0].clientY);";
-  content += "}, {passive: false});";
-
-  content += "list.addEventListener('touchend', e => {";
-  content += "  const dragging = document.querySelector('.dragging');";
-  content += "  if (dragging) { dragging.classList.remove('dragging'); updateOrderValue(); formDirty = true; }";
-  content += "});";
-
-  content += "syncScreenOrder();";
-  
-  // Mask Calculator
-  content += "document.querySelector('form').addEventListener('submit', function(e) {";
-  content += "  let mask = 0;";
-  content += "  document.querySelectorAll('.anim-chk').forEach(cb => {";
-  content += "    if(cb.checked) mask += parseInt(cb.value);";
-  content += "  });";
-  content += "  document.getElementById('finalMask').value = mask;";
-  content += "});";
-  
-  content += "formDirty = false;";
-  content += "document.querySelector('form').addEventListener('input', () => formDirty = true);";
-  content += "document.querySelector('form').addEventListener('change', () => formDirty = true);";
-
-  content += "function updateData() { fetch('/update').then(r => r.json()).then(d => {";
-  content += "  const set = (id, val, html=false) => { const el = document.getElementById(id); if(el) { if(html) el.innerHTML = val; else el.innerText = val; return true; } return false; };";
-  content += "  const hide = (id, state) => { const el = document.getElementById(id); if(el) el.classList.toggle('hidden', state); };";
-
-  content += "  const setVal = (name, val) => { const el = document.querySelector('[name=\"'+name+'\"]'); if(el && document.activeElement !== el) el.value = val; };";
-  content += "  const setCb = (id, val, byName=false) => { const el = byName ? document.querySelector('[name=\"'+id+'\"]') : document.getElementById(id); if(el) el.checked = (val === 1 || val === true || val === '1'); };";
-  content += "  const setRadio = (name, val) => { const el = document.querySelector('[name=\"'+name+'\"][value=\"'+val+'\"]'); if(el) el.checked = true; };";
-
-  content += "  if (d.refresh_min !== undefined && !formDirty) {";
-  content += "    setVal('refresh_min', d.refresh_min);";
-  content += "    setCb('autoCycle', d.auto_cycle);";
-  content += "    setVal('screen_int', d.screen_int);";
-  content += "    setRadio('time_format', d.time_format);";
-  
-  content += "    setCb('autoDetect', d.auto_detect);";
-  content += "    setVal('city', d.city);";
-  content += "    setVal('latitude', d.latitude);";
-  content += "    setVal('longitude', d.longitude);";
-  content += "    setVal('timezone', d.timezone);";
-  
-  content += "    setCb('nightMode', d.night_mode);";
-  content += "    setVal('night_start', d.night_start);";
-  content += "    setVal('night_end', d.night_end);";
-  content += "    setVal('night_action', d.night_action);";
-  
-  content += "    setCb('showTime', d.show_time);";
-  content += "    setCb('date_display', d.date_display, true);";
-  content += "    setCb('showWeather', d.show_weather);";
-  content += "    setRadio('temp_unit', d.temp_unit);";
-  content += "    setCb('round_temps', d.round_temps, true);";
-  content += "    setCb('showAQI', d.show_aqi);";
-  content += "    setRadio('aqi_type', d.aqi_type);";
-  content += "    setCb('showPc', d.show_pc);";
-  content += "    setCb('showStock', d.show_stock);";
-  content += "    setVal('stock_symbol', d.stock_symbol);";
-  content += "    setCb('stock_fn', d.stock_fn, true);";
-  content += "    setCb('showCrypto', d.show_crypto);";
-  content += "    setVal('crypto_id', d.crypto_id);";
-  content += "    setCb('crypto_fn', d.crypto_fn, true);";
-  content += "    setCb('showCurrency', d.show_currency);";
-  content += "    setVal('currency_base', d.currency_base);";
-  content += "    setVal('currency_target', d.currency_target);";
-  content += "    setVal('currency_multiplier', d.currency_multiplier);";
-  content += "    setCb('currency_fn', d.currency_fn, true);";
-  content += "    setCb('showMedia', d.show_media);";
-  content += "    setCb('hide_empty_pc', d.hide_empty_pc, true);";
-  content += "    setCb('hide_empty_media', d.hide_empty_media, true);";
-
-  content += "    const mask = d.anim_mask;";
-  content += "    document.querySelectorAll('.anim-chk').forEach(cb => { cb.checked = (mask & parseInt(cb.value)) !== 0; });";
-  content += "    const noneBox = document.getElementById('animNone');";
-  content += "    if (noneBox) { noneBox.checked = (mask === 0); toggleNone(); }";
-
-  content += "    if (d.screen_order && !document.querySelector('.dragging')) {";
-  content += "      const orderArr = d.screen_order.split(',');";
-  content += "      const list = document.getElementById('sortable-list');";
-  content += "      if (list) {";
-  content += "        const items = [...list.querySelectorAll('.sortable-item')];";
-  content += "        orderArr.forEach(id => { const item = items.find(el => el.getAttribute('data-id') === id); if(item) list.appendChild(item); });";
-  content += "        updateOrderValue();";
-  content += "      }";
-  content += "    }";
-
-  content += "    updateVisibility();";
-  content += "    syncScreenOrder();";
-  content += "    formDirty = false;";
-  content += "  }";
-
-  // Live Data Render Block
-  content += "  set('time-display', d.time);"; 
-  content += "  set('preview-time', d.time);";
-  content += "  set('preview-date', d.date);";
-
-  content += "  if (d.temp !== undefined && d.temp !== 'nan') {";
-  content += "    if (!set('value-temp', d.temp + ' °' + d.temp_unit)) { location.reload(); return; }";
-  content += "    hide('weather-no-data', true); hide('weather-grid', false);";
-  content += "    set('value-feels', d.apparent_temperature + ' °' + d.temp_unit);";
-  content += "    set('value-hum', d.humidity + '%');";
-  content += "    set('value-wind', d.wind_speed + ' km/h');";
-  content += "    set('weather-upd', 'Last Update: ' + d.update_time);";
-  content += "  }";
-
-  content += "  if (d.aqi !== undefined && d.aqi !== 'nan') {";
-  content += "    if (!set('value-aqi', d.aqi)) { location.reload(); return; }";
-  content += "    hide('aqi-no-data', true); hide('aqi-grid', false);";
-  content += "    const aqiLabel = document.querySelector('#value-aqi + .tile-label'); if(aqiLabel) aqiLabel.innerText = d.aqi_status + ' Index';"; 
-  content += "    set('value-pm25', d.pm25 + ' <small>µg</small>', true);";
-  content += "    set('value-pm10', d.pm10 + ' <small>µg</small>', true);";
-  content += "    set('value-no2', d.no2 + ' <small>µg</small>', true);";
-  content += "    set('aqi-upd', 'Last Update: ' + d.update_time);";
-  content += "  }";
-
-  content += "  if (d.pc_cpu !== undefined && d.pc_cpu !== '0.00' && d.pc_cpu !== '0') {";
-  content += "    if (!set('pc-cpu', Math.round(parseFloat(d.pc_cpu)) + '%')) { location.reload(); return; }";
-  content += "    hide('pc-no-data', true); hide('pc-grid', false);";
-  content += "    set('pc-net', Math.round(parseFloat(d.pc_net)) + ' KB/s');";
-  content += "    set('pc-ram', Math.round(parseFloat(d.pc_ram)) + '%');";
-  content += "    set('pc-disk', Math.round(parseFloat(d.pc_disk)) + '%');";
-  content += "  }";
-
-  content += "  if (d.crypto_price !== undefined && d.crypto_price !== 'nan') {";
-  content += "    if (!set('crypto-price', d.crypto_price + '$')) { location.reload(); return; }";
-  content += "    hide('crypto-no-data', true); hide('crypto-grid', false);";
-  content += "    set('crypto-change', d.crypto_change + '%');";
-  content += "    set('crypto-trend-icon', parseFloat(d.crypto_change) >= 0 ? '📈' : '📉');";
-  content += "    set('crypto-upd', 'Last Update: ' + d.update_time);";
-  content += "  }";
-
-  content += "  if (d.currency_base_text !== undefined) {";
-  content += "    if (!set('currency-base-val', d.currency_base_text)) { location.reload(); return; }";
-  content += "    hide('currency-no-data', true); hide('currency-grid', false);";
-  content += "    set('currency-target-val', d.currency_target_text);";
-  content += "    set('currency-upd', 'Last Update: ' + d.update_time);";
-  content += "  }";
-  
-  content += "  if (d.stock_price !== undefined && d.stock_price !== 'nan') {";
-  content += "    if (!set('stock-price', '$' + d.stock_price)) { location.reload(); return; }";
-  content += "    hide('stock-no-data', true); hide('stock-grid', false);";
-  content += "    set('stock-change', d.stock_change + '%');";
-  content += "    set('stock-trend-icon', parseFloat(d.stock_change) >= 0 ? '📈' : '📉');";
-  content += "    set('stock-sym', d.stock_symbol + ' Price');"; 
-  content += "    set('stock-upd', 'Last Update: ' + d.update_time);";
-  content += "  }";
-
-  content += "  if (d.media_status !== undefined) {";
-  content += "    let s = d.media_status || 'stopped';";
-  content += "    set('web-media-status', s.charAt(0).toUpperCase() + s.slice(1));";
-  content += "    set('web-media-name', d.media_name || 'No Media');";
-  content += "    set('web-media-author', d.media_author || 'Unknown');";
-  content += "    set('web-media-album', d.media_album || 'Unknown');";
-  content += "  }";
-  
-  content += "  if (d.pc_status !== undefined) set('pc-link-status', d.pc_status);";
-  content += "}).catch(e => console.log('Sync error:', e)); } setInterval(updateData, 15000); updateData();";
-  content += "</script></div></body></html>";
+String WebServerService::arg(const char* name) {
+    char value[192];
+    if (httpd_query_key_value(query.c_str(), name, value, sizeof(value)) != ESP_OK) return "";
+    return urlDecode(value);
+}
 
-  return content;
+esp_err_t WebServerService::sendResponse(httpd_req_t* req, const char* status, const char* contentType, const char* body, size_t length) {
+    httpd_resp_set_status(req, status);
+    if (contentType) httpd_resp_set_type(req, contentType);
+    return httpd_resp_send(req, body, length);
 }
 
-void WebServerService::handleRoot() {
-  server.send(200, "text/html", generateRootPageContent());
+esp_err_t WebServerService::sendResponse(httpd_req_t* req, const char* status, const char* contentType, const char* body) {
+    return sendResponse(req, status, contentType, body, strlen(body));
 }
 
-void WebServerService::handleSave() {
+esp_err_t WebServerService::handleSave(httpd_req_t* req) {
+  loadQuery(req);
+  if (!lockState(STATE_WAIT)) return sendResponse(req, "503 Service Unavailable", "text/plain", "Busy");
+
   Config& config = state->config;
   WeatherData& weather = state->weather;
   AirQualityData& aqi = state->aqi;
@@ -874,85 +171,33 @@ void WebServerService::handleSave() {
   PcStats& pc = state->pc;
   PcMedia& media = state->media;
 
-  // 1. Update Screen Visibility & Master Toggles
-  config.auto_detect = server.hasArg("auto_detect");
-  config.screen_auto_cycle = server.hasArg("auto_cycle");
-  config.night_mode = server.hasArg("night_mode");
-
-  config.show_time = server.hasArg("show_time");
-  config.show_weather = server.hasArg("show_weather");
-  config.show_aqi = server.hasArg("show_aqi");
-  config.show_crypto = server.hasArg("show_crypto");
-  config.show_pc = server.hasArg("show_pc");
-  config.show_currency = server.hasArg("show_currency");
-  config.show_stock = server.hasArg("show_stock");
-  config.show_media = server.hasArg("show_media");
-
-  config.hide_empty_pc = server.hasArg("hide_empty_pc");
-  config.hide_empty_media = server.hasArg("hide_empty_media");
-
-  if (server.hasArg("screen_order")) {
-    String orderStr = server.arg("screen_order");
-    int idx = 0;
-    int startPos = 0;
-    
-    while (startPos < orderStr.length() && idx < NUM_SCREENS) {
-      int commaPos = orderStr.indexOf(',', startPos);
-      if (commaPos == -1) {
-        config.screen_order[idx++] = orderStr.substring(startPos).toInt();
-        break;
-      } else {
-        config.screen_order[idx++] = orderStr.substring(startPos, commaPos).toInt();
-        startPos = commaPos + 1;
-      }
+  // 1. One pass over the query: each key is looked up in the config schema,
+  // then unticked checkboxes and inputs of disabled panels are settled
+  Config updated = config;
+  bool submitted[ConfigSchema::NUM_FIELDS] = {false};
+  const char* p = query.c_str();
+  while (*p) {
+    const char* end = strchr(p, '&');
+    if (end == nullptr) end = p + strlen(p);
+    const char* eq = (const char*)memchr(p, '=', end - p);
+    const char* keyEnd = eq ? eq : end;
+
+    int field = ConfigSchema::find(p, keyEnd - p);
+    if (field >= 0) {
+      char value[192];
+      size_t n = eq ? end - eq - 1 : 0;
+      if (n >= sizeof(value)) n = sizeof(value) - 1;
+      if (n) memcpy(value, eq + 1, n);
+      value[n] = '\0';
+      ConfigSchema::applyFormValue(updated, field, urlDecode(value).c_str());
+      submitted[field] = true;
     }
+    p = *end ? end + 1 : end;
   }
+  ConfigSchema::finishForm(config, updated, submitted);
+  config = updated;
 
-  if (config.show_time) config.date_display = server.hasArg("date_display");
-  if (config.show_weather) config.round_temps = server.hasArg("round_temps");
-
-  if (config.show_crypto) config.crypto_fn = server.hasArg("crypto_fn");
-  if (config.show_currency) config.currency_fn = server.hasArg("currency_fn");
-  if (config.show_stock) config.stock_fn = server.hasArg("stock_fn");
-
-  // 2. Persistent Settings: Only update if the arg is present 
-  if (server.hasArg("time_format")) config.time_format = server.arg("time_format");
-  if (server.hasArg("temp_unit")) config.temp_unit = server.arg("temp_unit");
-  if (server.hasArg("aqi_type")) config.aqi_type = server.arg("aqi_type");
-  if (server.hasArg("refresh_min")) config.refresh_interval_min = server.arg("refresh_min").toInt();
-  if (server.hasArg("screen_int")) config.screen_interval_sec = server.arg("screen_int").toInt();
-  if (server.hasArg("anim_mask")) config.anim_mask = server.arg("anim_mask").toInt();
-  if (server.hasArg("crypto_id")) config.crypto_id = server.arg("crypto_id").toInt();
-
-  // Night Mode Settings
-  if (server.hasArg("night_action")) config.night_action = server.arg("night_action").toInt();
-  if (server.hasArg("night_start")) config.night_start = server.arg("night_start");
-  if (server.hasArg("night_end")) config.night_end = server.arg("night_end");
-
-  // Currency Settings
-  if (server.hasArg("currency_base")) {
-      config.currency_base = server.arg("currency_base"); 
-  }
-  if (server.hasArg("currency_target")) {
-      config.currency_target = server.arg("currency_target");
-  }
-  if (server.hasArg("currency_multiplier")) {
-      config.currency_multiplier = server.arg("currency_multiplier").toInt();
-  }
-
-  // Stock Settings
-  if (server.hasArg("stock_symbol")) {
-      config.stock_symbol = server.arg("stock_symbol");
-  }
-
-  if (!config.auto_detect && server.hasArg("city")) {
-    config.city = server.arg("city"); 
-    config.latitude = server.arg("latitude").toFloat();
-    config.longitude = server.arg("longitude").toFloat();
-    config.timezone = server.arg("timezone");
-  }
-
-  // 3. Forcible Reset of Data (State clearing)
+  // 2. Forcible Reset of Data (State clearing)
   if (!config.show_weather) {
     weather.temp = NAN;
     weather.humidity = NAN;
@@ -997,203 +242,269 @@ void WebServerService::handleSave() {
 
   if (config.refresh_interval_min <= 0) config.refresh_interval_min = 1; 
 
-  if (saveCallback) {
-    saveCallback();
+  config.version++;
+  unlockState();
+
+  // Location lookup, NTP and the flash write run from loop()
+  savePending = true;
+
+  httpd_resp_set_hdr(req, "Location", "/");
+  return sendResponse(req, "302 Found", "text/plain", "Settings saved. Redirecting...");
+}
+
+esp_err_t WebServerService::handleUpdate(httpd_req_t* req) {
+  // ?since=<rev>&boot=<id> asks only for the keys changed after that revision of that boot
+  loadQuery(req);
+  bool delta = hasArg("since");
+  uint32_t since = strtoul(arg("since").c_str(), nullptr, 10);
+  uint32_t boot = strtoul(arg("boot").c_str(), nullptr, 10);
+
+  if (serializer == nullptr || !lockState(STATE_WAIT)) return sendResponse(req, "503 Service Unavailable", "text/plain", "Busy");
+  bool notModified = false;
+  std::shared_ptr<const SerializedState> json = delta ? serializer->getDelta(*state, since, boot, notModified) : serializer->get(*state);
+  unlockState();
+
+  if (notModified) return sendResponse(req, "304 Not Modified", nullptr, "", 0);
+  if (!json) return sendResponse(req, "503 Service Unavailable", "text/plain", "Busy");
+
+  return sendResponse(req, "200 OK", "application/json", json->data.get(), json->length);
+}
+
+std::shared_ptr<const SerializedState> WebServerService::currentStateJson(uint32_t* revision) {
+  if (serializer == nullptr || !lockState(STATE_WAIT)) return nullptr;
+  std::shared_ptr<const SerializedState> json = serializer->get(*state);
+  if (revision) *revision = serializer->currentRevision();
+  unlockState();
+  return json;
+}
+
+
+esp_err_t WebServerService::handleEvents(httpd_req_t* req) {
+  int fd = httpd_req_to_sockfd(req);
+  if (req->sess_ctx == nullptr && eventClientCount >= MAX_EVENT_CLIENTS) {
+    return sendResponse(req, "503 Service Unavailable", "text/plain", "Too many event listeners");
   }
-  
-  server.sendHeader("Location", "/", true);
-  server.send(302, "text/plain", "Settings saved. Redirecting...");
+  uint32_t revision;
+  std::shared_ptr<const SerializedState> json = currentStateJson(&revision);
+  if (!json) return sendResponse(req, "503 Service Unavailable", "text/plain", "Busy");
+
+  // The response never completes, so the headers go out raw and the socket is kept as a subscriber
+  static const char HEADERS[] = "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+                                "Connection: keep-alive\r\n\r\nretry: 3000\n\n";
+  if (httpd_socket_send(server, fd, HEADERS, sizeof(HEADERS) - 1, 0) < 0 || !sendStateEvent(fd, "state", *json, 0)) {
+    return ESP_FAIL;
+  }
+
+  // Deltas queued before this full state must not be applied on top of it
+  if (req->sess_ctx == nullptr) {
+    // httpd calls removeEventClient() with this context once the socket closes
+    req->sess_ctx = new EventClient{this, fd};
+    req->free_ctx = removeEventClient;
+    eventClients[eventClientCount++] = {fd, revision};
+    Serial.printf("WebServerService: Event listener connected (%d active).\n", (int)eventClientCount);
+  } else {
+    for (int i = 0; i < eventClientCount; i++) {
+      if (eventClients[i].fd == fd) eventClients[i].revision = revision;
+    }
+  }
+  return ESP_OK;
 }
 
-void WebServerService::handleUpdate() {
-  Config& config = state->config;
-  WeatherData& weather = state->weather;
-  AirQualityData& aqi = state->aqi;
-  CryptoData& crypto = state->crypto;
-  CurrencyData& currency = state->currency;
-  StockData& stock = state->stock;
-  PcStats& pc = state->pc;
-  PcMedia& media = state->media;
+void WebServerService::removeEventClient(void* ctx) {
+  EventClient* client = static_cast<EventClient*>(ctx);
+  WebServerService* service = client->service;
+  for (int i = 0; i < service->eventClientCount; i++) {
+    if (service->eventClients[i].fd == client->fd) {
+      service->eventClients[i] = service->eventClients[--service->eventClientCount];
+      break;
+    }
+  }
+  Serial.printf("WebServerService: Event listener closed (%d active).\n", (int)service->eventClientCount);
+  delete client;
+}
 
-  DynamicJsonDocument doc(3072); 
-  
-  // Global Settings
-  doc["device_id"] = config.device_id;
-  doc["ip_address"] = config.ip_address;
-  doc["refresh_min"] = config.refresh_interval_min;
-  doc["auto_cycle"] = config.screen_auto_cycle ? 1 : 0;
-  doc["screen_int"] = config.screen_interval_sec;
-  doc["anim_mask"] = config.anim_mask;
-  doc["time_format"] = config.time_format;
-  
-  // Location Settings
-  doc["auto_detect"] = config.auto_detect ? 1 : 0;
-  doc["city"] = config.city;
-  doc["latitude"] = config.latitude;
-  doc["longitude"] = config.longitude;
-  doc["timezone"] = config.timezone;
-
-  // Night Mode Settings
-  doc["night_mode"] = config.night_mode ? 1 : 0;
-  doc["night_start"] = config.night_start;
-  doc["night_end"] = config.night_end;
-  doc["night_action"] = config.night_action;
-
-  // Screen Toggles
-  doc["show_time"] = config.show_time ? 1 : 0;
-  doc["date_display"] = config.date_display ? 1 : 0;
-  
-  doc["show_weather"] = config.show_weather ? 1 : 0;
-  doc["temp_unit"] = config.temp_unit;
-  doc["round_temps"] = config.round_temps ? 1 : 0;
-  
-  doc["show_aqi"] = config.show_aqi ? 1 : 0;
-  doc["aqi_type"] = config.aqi_type;
-  
-  doc["show_pc"] = config.show_pc ? 1 : 0;
+void WebServerService::publishState() {
+  if (!server || eventClientCount == 0 || serializer == nullptr) return;
+
+  unsigned long now = millis();
+  serializer->get(*state);
+  uint32_t revision = serializer->currentRevision();
+  bool changed = (revision != publishedRevision);
+  if (!changed && now - lastEventMs < EVENT_KEEPALIVE_MS) return;
+
+  // Listeners joined with a full state at or after publishedRevision, so one delta serves them all;
+  // it is serialized once here, whatever their number. A job without json is a keepalive.
+  EventBroadcast* job = new EventBroadcast{this, nullptr, revision};
+  if (changed) {
+    bool notModified;
+    job->json = serializer->getDelta(*state, publishedRevision, serializer->bootId(), notModified);
+  }
 
-  doc["show_media"] = config.show_media ? 1 : 0;
-  doc["media_status"] = state->media.status;
-  doc["media_name"] = state->media.name;
-  
-  doc["show_stock"] = config.show_stock ? 1 : 0;
-  doc["stock_symbol"] = config.stock_symbol;
-  doc["stock_fn"] = config.stock_fn ? 1 : 0;
-  
-  doc["show_crypto"] = config.show_crypto ? 1 : 0;
-  doc["crypto_id"] = config.crypto_id;
-  doc["crypto_fn"] = config.crypto_fn ? 1 : 0;
-  
-  doc["show_currency"] = config.show_currency ? 1 : 0;
-  doc["currency_base"] = config.currency_base;
-  doc["currency_target"] = config.currency_target;
-  doc["currency_multiplier"] = config.currency_multiplier;
-  doc["currency_fn"] = config.currency_fn ? 1 : 0;
-
-  doc["hide_empty_pc"] = config.hide_empty_pc ? 1 : 0;
-  doc["hide_empty_media"] = config.hide_empty_media ? 1 : 0;
-
-  String orderStr = "";
-  for(int i = 0; i < NUM_SCREENS; i++) {
-      orderStr += String(config.screen_order[i]);
-      if(i < NUM_SCREENS - 1) orderStr += ",";
+  // Sockets belong to the HTTP task, so the send runs there
+  if (httpd_queue_work(server, broadcastEvent, job) != ESP_OK) {
+    delete job;
+    return;
   }
-  doc["screen_order"] = orderStr;
-  
-  doc["time"] = getCurrentTimeShort(config.time_format);
-  doc["date"] = getFullDate();
-  doc["update_time"] = weather.update_time;
-  doc["temp_unit"] = config.temp_unit;
-  doc["time_format"] = config.time_format;
-
-  if (!isnan(weather.temp)) {
-    doc["temp"] = String(weather.temp, 1);
-    doc["apparent_temperature"] = String(weather.apparent_temperature, 1);
-    doc["humidity"] = String(weather.humidity);
-    doc["wind_speed"] = String(weather.wind_speed, 1);
-    doc["weather_code"] = weather.weather_code;
+  publishedRevision = revision;
+  lastEventMs = now;
+}
+
+bool WebServerService::sendStateEvent(int fd, const char* event, const SerializedState& json, int flags) {
+  char prefix[32];
+  int prefixLength = snprintf(prefix, sizeof(prefix), "event: %s\ndata: ", event);
+  return httpd_socket_send(server, fd, prefix, prefixLength, flags) == prefixLength &&
+         httpd_socket_send(server, fd, json.data.get(), json.length, flags) == (int)json.length &&
+         httpd_socket_send(server, fd, "\n\n", 2, flags) == 2;
+}
+
+void WebServerService::broadcastEvent(void* arg) {
+  EventBroadcast* job = static_cast<EventBroadcast*>(arg);
+  WebServerService* service = job->service;
+  static const char KEEPALIVE[] = ": keepalive\n\n";
+
+  for (int i = 0; i < service->eventClientCount; i++) {
+    // A listener that joined after this delta was queued already has its changes in its full state
+    const EventSubscriber& client = service->eventClients[i];
+    if (job->json && job->revision <= client.revision) continue;
+
+    // Never wait on a slow listener; a short write would corrupt its stream, so it gets dropped and reconnects
+    int fd = client.fd;
+    bool sent = job->json ? service->sendStateEvent(fd, "delta", *job->json, MSG_DONTWAIT)
+                          : httpd_socket_send(service->server, fd, KEEPALIVE, sizeof(KEEPALIVE) - 1, MSG_DONTWAIT) == (int)(sizeof(KEEPALIVE) - 1);
+    if (!sent) httpd_sess_trigger_close(service->server, fd);
   }
+  delete job;
+}
 
-  if (!isnan(aqi.pm25) && !isnan(aqi.pm10) && !isnan(aqi.no2)) {
-    doc["aqi"] = String(aqi.aqi);
-    doc["aqi_status"] = aqi.status;
-    doc["pm25"] = String(aqi.pm25, 1);
-    doc["pm10"] = String(aqi.pm10, 1);
-    doc["no2"] = String(aqi.no2, 1);
+esp_err_t WebServerService::handlePcStats(httpd_req_t* req) {
+  if (req->content_len == 0) {
+    return sendResponse(req, "400 Bad Request", "application/json", "{\"status\":\"error\", \"message\":\"Body not received\"}");
+  }
+  if (req->content_len > MAX_BODY_SIZE) {
+    return sendResponse(req, "413 Payload Too Large", "application/json", "{\"status\":\"error\", \"message\":\"Body too large\"}");
   }
 
-  if (!isnan(crypto.price_usd) && crypto.price_usd > 0) {
-    doc["crypto_symbol"] = String(crypto.symbol);
-    doc["crypto_price"] = String(crypto.price_usd);
-    doc["crypto_change"] = String(crypto.percent_change_24h);
+  char body[MAX_BODY_SIZE];
+  size_t received = 0;
+  int timeouts = 0;
+  while (received < req->content_len) {
+    int n = httpd_req_recv(req, body + received, req->content_len - received);
+    if (n == HTTPD_SOCK_ERR_TIMEOUT) {
+      // A stalled body would hold up every other connection, telemetry included
+      if (++timeouts < MAX_BODY_TIMEOUTS) continue;
+      sendResponse(req, "408 Request Timeout", "application/json", "{\"status\":\"error\", \"message\":\"Body timed out\"}");
+      return ESP_FAIL;
+    }
+    if (n <= 0) return ESP_FAIL;
+    received += n;
   }
   
-  if (currency.updated) {
-    float displayRate = currency.rate * config.currency_multiplier;
-    
-    int decimals = 0;
-    if (displayRate < 10.0) decimals = 3;
-    else if (displayRate < 100.0) decimals = 2;
-    else if (displayRate < 1000.0) decimals = 1;
-    
-    doc["currency_base_text"] = String(config.currency_multiplier) + " " + currency.base;
-    doc["currency_target_text"] = String(displayRate, decimals) + " " + currency.target;
-    doc["currency_date"] = currency.date;
-  }
+  // Parsed in place from the stack buffer, like the serial path
+  StaticJsonDocument<PcMonitorService::TELEMETRY_JSON_CAPACITY> doc;
+  DeserializationError error = deserializeJson(doc, body, received);
   
-  if (stock.updated) {
-    doc["stock_symbol"] = stock.symbol;
-    doc["stock_price"] = String(stock.price, 2);
-    doc["stock_change"] = String(stock.percent_change, 2);
+  if (error) {
+    return sendResponse(req, "400 Bad Request", "application/json", "{\"status\":\"error\", \"message\":\"Invalid JSON\"}");
   }
 
-  if (pc.cpu_percent > 0.1) {
-    doc["pc_cpu"] = String(pc.cpu_percent);
-    doc["pc_net"] = String(pc.net_down_kb);
-    doc["pc_ram"] = String(pc.mem_percent);
-    doc["pc_disk"] = String(pc.disk_percent);
+  const char* incoming_pc_id = doc["pc_id"] | "";
+  if (incoming_pc_id[0] == '\0') {
+    return sendResponse(req, "400 Bad Request", "application/json", "{\"status\":\"error\", \"message\":\"Missing PC ID\"}");
   }
 
-  if (media.status.length() > 0) {
-    doc["media_status"] = media.status;
-    doc["media_name"] = media.name;
-    doc["media_author"] = media.author;
-    doc["media_album"] = media.album;
+  if (!lockState(STATE_WAIT)) {
+    return sendResponse(req, "503 Service Unavailable", "application/json", "{\"status\":\"error\", \"message\":\"Busy\"}");
   }
 
-  String activeId = config.active_pc_id;
-  int lastDashSync = activeId.lastIndexOf(':');
-  if (lastDashSync > 3) activeId = activeId.substring(0, lastDashSync);
+  // Every PC gets its own session, so a second host is no longer turned away
+  PcMonitorService::applyTelemetry(*state, incoming_pc_id, doc.as<JsonVariantConst>());
+  unlockState();
 
-  bool isPcPaired = (activeId != "" && (millis() - pc.last_update < 5000));
-  doc["pc_status"] = isPcPaired ? ("🔒 Paired to " + activeId) : "";
-  
-  String jsonResponse;
-  serializeJson(doc, jsonResponse);
-  
-  server.send(200, "application/json", jsonResponse);
+  // "delta" tells the bridge it may send delta samples from now on
+  return sendResponse(req, "200 OK", "application/json", "{\"status\":\"ok\",\"delta\":1}");
 }
 
-void WebServerService::handlePcStats() {
-  if (!server.hasArg("plain")) {
-    server.send(400, "application/json", "{\"status\":\"error\", \"message\":\"Body not received\"}");
-    return;
+// True if If-None-Match lists `etag`, as a strong or W/ weak tag, or is "*".
+// A header too long to read counts as no match, so the full body goes out.
+static bool matchesIfNoneMatch(httpd_req_t* req, const char* etag) {
+  size_t len = httpd_req_get_hdr_value_len(req, "If-None-Match");
+  if (len == 0 || len > 511) return false;
+  char value[512];
+  if (httpd_req_get_hdr_value_str(req, "If-None-Match", value, sizeof(value)) != ESP_OK) return false;
+
+  size_t etagLen = strlen(etag);
+  for (char* token = strtok(value, ","); token; token = strtok(nullptr, ",")) {
+    while (*token == ' ' || *token == '\t') token++;
+    size_t tokenLen = strlen(token);
+    while (tokenLen > 0 && (token[tokenLen - 1] == ' ' || token[tokenLen - 1] == '\t')) tokenLen--;
+
+    if (tokenLen == 1 && token[0] == '*') return true;
+    // If-None-Match uses the weak comparison, so W/"x" matches "x"
+    if (tokenLen > 2 && strncmp(token, "W/", 2) == 0) {
+      token += 2;
+      tokenLen -= 2;
+    }
+    if (tokenLen == etagLen && strncmp(token, etag, etagLen) == 0) return true;
   }
-  
-  String body = server.arg("plain");
-  
-  DynamicJsonDocument doc(1024); 
-  DeserializationError error = deserializeJson(doc, body);
-  
-  if (error) {
-    server.send(400, "application/json", "{\"status\":\"error\", \"message\":\"Invalid JSON\"}");
-    return;
+  return false;
+}
+
+esp_err_t WebServerService::handleAsset(httpd_req_t* req, const WebAsset& asset) {
+  // Only the gzipped body is stored. It goes out even without "Accept-Encoding: gzip"
+  // (every browser sends it; curl needs --compressed), and caches key on the header.
+  httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+  httpd_resp_set_hdr(req, "ETag", asset.etag);
+  httpd_resp_set_hdr(req, "Cache-Control", asset.cacheControl);
+
+  if (matchesIfNoneMatch(req, asset.etag)) {
+    httpd_resp_set_status(req, "304 Not Modified");
+    return httpd_resp_send(req, nullptr, 0);
   }
 
-  String incoming_pc_id = doc["pc_id"] | "";
-  if (incoming_pc_id == "") {
-    server.send(400, "application/json", "{\"status\":\"error\", \"message\":\"Missing PC ID\"}");
-    return;
+  httpd_resp_set_type(req, asset.contentType);
+  httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+  return httpd_resp_send(req, (const char*)asset.data, asset.length);
+}
+
+esp_err_t WebServerService::handleFrame(httpd_req_t* req) {
+  if (display == nullptr) {
+    return sendResponse(req, "503 Service Unavailable", "text/plain", "Display not attached");
   }
 
-  if (millis() - state->pc.last_update > 5000 || state->config.active_pc_id == incoming_pc_id || state->config.active_pc_id == "") {
-    
-    state->config.active_pc_id = incoming_pc_id;
-    
-    state->pc.cpu_percent = doc["cpu_percent"] | 0.0;
-    state->pc.mem_percent = doc["mem_percent"] | 0.0;
-    state->pc.disk_percent = doc["disk_percent"] | 0.0;
-    state->pc.net_down_kb = doc["net_down_kb"] | 0.0;
-    state->pc.last_update = millis();
-
-    state->media.status = doc["media_status"] | "stopped";
-    state->media.name = doc["media_name"] | "";
-    state->media.author = doc["media_author"] | "";
-    state->media.album = doc["media_album"] | "";
-    state->media.last_update = millis();
-
-    server.send(200, "application/json", "{\"status\":\"ok\"}");
-  } else {
-    server.send(403, "application/json", "{\"status\":\"error\", \"message\":\"Device is already paired to another PC\"}");
+  // The loop draws into the same buffer, so the copy is taken under the state lock
+  uint8_t frame[DisplayService::FRAME_PBM_SIZE];
+  if (!lockState(STATE_WAIT)) return sendResponse(req, "503 Service Unavailable", "text/plain", "Busy");
+  size_t len = display->encodeFramePBM(frame, sizeof(frame));
+  unlockState();
+
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  return sendResponse(req, "200 OK", "image/x-portable-bitmap", (const char*)frame, len);
+}
+
+esp_err_t WebServerService::handleMetrics(httpd_req_t* req) {
+  if (metrics == nullptr) {
+    return sendResponse(req, "503 Service Unavailable", "text/plain", "Metrics not attached");
   }
+
+  StreamString json;
+  if (!lockState(STATE_WAIT)) return sendResponse(req, "503 Service Unavailable", "text/plain", "Busy");
+  metrics->writeJson(json);
+  unlockState();
+
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  return sendResponse(req, "200 OK", "application/json", json.c_str(), json.length());
+}
+
+esp_err_t WebServerService::handleHistory(httpd_req_t* req) {
+  // The rings are copied under the lock (~1.6 KB) and formatted afterwards, so a slow client never holds it
+  PcHistory history;
+  if (!lockState(STATE_WAIT)) return sendResponse(req, "503 Service Unavailable", "text/plain", "Busy");
+  history = state->pc_history;
+  unlockState();
+
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  ChunkedResponseWriter json(req, "application/json");
+  history.writeJson(json);
+  json.finish();
+  return ESP_OK;
 }
\ No newline at end of file
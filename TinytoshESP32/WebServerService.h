@@ -1,38 +1,112 @@
 #ifndef WEB_SERVER_SERVICE_H
 #define WEB_SERVER_SERVICE_H
 
-#include <WebServer.h>
-#include <WiFiManager.h>
+#include <Arduino.h>
+#include <esp_http_server.h>
 #include "structs.h"
+#include "DisplayService.h"
+#include "MetricsService.h"
+#include "StateSerializer.h"
+#include "PcMonitorService.h"
+#include "ChunkedResponseWriter.h"
+
+struct WebAsset;
 
 typedef void (*ConfigSaveCallback)();
 
+// Serves the web panel from the ESP-IDF HTTP server, which runs on its own
+// task, multiplexes several keep-alive connections and never blocks loop().
+// Handlers only touch AppState while holding the state lock, which loop()
+// holds while it updates and renders.
 class WebServerService {
 public:
     WebServerService(int port, ConfigSaveCallback callback);
     void begin();
+    // Runs work the HTTP task deferred to loop(), such as the config save callback;
+    // called without the state lock, which the callback takes as it needs it
     void handleClient();
     void setAppState(AppState* appState);
-    
-    void handleRoot();
-    void handleSave();
-    void handleUpdate();
-    void handlePcStats();
-
-    String generateRootPageContent();
-    
+    void setDisplayService(DisplayService* displayService);
+    void setMetrics(MetricsService* metricsService);
+    void setStateSerializer(StateSerializer* stateSerializer);
+
+    bool lockState(TickType_t wait = portMAX_DELAY);
+    void unlockState();
+    // Called from loop() with the state lock held; pushes the state to /events listeners when it changed
+    void publishState();
+
+    esp_err_t handleSave(httpd_req_t* req);
+    esp_err_t handleUpdate(httpd_req_t* req);
+    esp_err_t handlePcStats(httpd_req_t* req);
+    esp_err_t handleFrame(httpd_req_t* req);
+    esp_err_t handleMetrics(httpd_req_t* req);
+    esp_err_t handleHistory(httpd_req_t* req);
+    esp_err_t handleEvents(httpd_req_t* req);
+    static esp_err_t handleAsset(httpd_req_t* req, const WebAsset& asset);
+
 private:
-    WebServer server;
-    WiFiManager wm;
+    static const uint16_t MAX_CONNECTIONS = 6;
+    static const uint16_t MAX_HANDLERS = 16;
+    static const uint32_t TASK_STACK_SIZE = 8192;
+    static const uint16_t SOCKET_TIMEOUT_SEC = 3;
+    // Receive timeouts a request body may run into before it is dropped; the HTTP task waits on it meanwhile
+    static const int MAX_BODY_TIMEOUTS = 2;
+    static const TickType_t STATE_WAIT = pdMS_TO_TICKS(250);
+    static const size_t MAX_BODY_SIZE = 1024;
+    static const int MAX_EVENT_CLIENTS = 3;
+    static const unsigned long EVENT_KEEPALIVE_MS = 15000;
+
+    struct EventClient {
+        WebServerService* service;
+        int fd;
+    };
+
+    // An open /events socket and the revision of the full state it was sent
+    struct EventSubscriber {
+        int fd;
+        uint32_t revision;
+    };
+
+    // Handed to the HTTP task; without json it is a keepalive. A delta brings
+    // listeners up to `revision` and is skipped for those already past it.
+    struct EventBroadcast {
+        WebServerService* service;
+        std::shared_ptr<const SerializedState> json;
+        uint32_t revision;
+    };
+
+    httpd_handle_t server = nullptr;
+    uint16_t port;
     ConfigSaveCallback saveCallback;
-    
+    SemaphoreHandle_t stateMutex = nullptr;
+    volatile bool savePending = false;
+
+    // Open /events sockets; only modified on the HTTP task
+    EventSubscriber eventClients[MAX_EVENT_CLIENTS];
+    volatile int eventClientCount = 0;
+    uint32_t publishedRevision = 0;
+    unsigned long lastEventMs = 0;
+
     AppState* state;
+    DisplayService* display = nullptr;
+    MetricsService* metrics = nullptr;
+    StateSerializer* serializer = nullptr;
+
+    // Only used on the HTTP task, which runs one handler at a time
+    String query;
 
     const char* LOCAL_DOMAIN_NAME = "tinytosh";
 
-    String getWeatherIcon(int wmo_code);
-    String getCurrentTimeShort(String format);
-    String getFullDate();
+    void registerHandler(const char* uri, http_method method, esp_err_t (*handler)(httpd_req_t*), void* ctx);
+    std::shared_ptr<const SerializedState> currentStateJson(uint32_t* revision = nullptr);
+    bool sendStateEvent(int fd, const char* event, const SerializedState& json, int flags);
+    static void removeEventClient(void* ctx);
+    static void broadcastEvent(void* arg);
+    void loadQuery(httpd_req_t* req);
+    bool hasArg(const char* name);
+    String arg(const char* name);
+    esp_err_t sendResponse(httpd_req_t* req, const char* status, const char* contentType, const char* body, size_t length);
+    esp_err_t sendResponse(httpd_req_t* req, const char* status, const char* contentType, const char* body);
 };
 
-#endif
\ No newline at end of file
+#endif
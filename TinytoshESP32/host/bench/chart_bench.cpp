@@ -0,0 +1,143 @@
+// PageChart against the Adafruit_GFX path for a full-width, full-height plot
+// of 128 samples: per-pixel drawPixel() loops, and the GFX call a screen
+// would use instead (drawFastVLine columns, fillRect bars, drawLine segments).
+// "same" says whether the other paths matched PageChart pixel for pixel;
+// drawLine joins sparkline points its own way, so it only compares on cost.
+// Host timings only rank the paths; the ESP32-C3 is much slower.
+//
+//   chart_bench [iterations]
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include <Adafruit_SSD1306.h>
+#include "PageChart.h"
+
+static const int SAMPLES = PageChart::WIDTH;
+static const int TOP = 0;
+static const int HEIGHT = PageChart::HEIGHT;
+static const int SCALE = 255;
+
+static double nowUs() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Same mapping as PageChart: value 0 on the bottom row of the box
+static int valueY(uint8_t value) {
+    return TOP + HEIGHT - 1 - value * (HEIGHT - 1) / SCALE;
+}
+
+static Adafruit_SSD1306 display(PageChart::WIDTH, PageChart::HEIGHT);
+static uint8_t* buf = nullptr;
+
+// Mean microseconds per draw, each one on a cleared buffer
+static double timeDraw(int iterations, const std::function<void()>& draw) {
+    double total = 0;
+    for (int n = 0; n < iterations; n++) {
+        memset(buf, 0, PageChart::WIDTH * PageChart::HEIGHT / 8);
+        double start = nowUs();
+        draw();
+        total += nowUs() - start;
+    }
+    return total / iterations;
+}
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : 20000;
+    display.begin();
+    buf = display.getBuffer();
+
+    // A random walk covering most of the range
+    uint8_t values[SAMPLES];
+    int v = 128;
+    for (int i = 0; i < SAMPLES; i++) {
+        v = constrain(v + (int)random(-24, 25), 0, SCALE);
+        values[i] = (uint8_t)v;
+    }
+
+    struct Case {
+        const char* name;
+        std::function<void()> chart, pixels, gfx;
+        bool gfxSamePixels;
+    };
+    std::vector<Case> cases = {
+        {"area",
+         [&] { PageChart::area(buf, 0, TOP, HEIGHT, values, SAMPLES, SCALE); },
+         [&] {
+             for (int x = 0; x < SAMPLES; x++)
+                 for (int y = valueY(values[x]); y < TOP + HEIGHT; y++) display.drawPixel(x, y, SSD1306_WHITE);
+         },
+         [&] {
+             for (int x = 0; x < SAMPLES; x++) display.drawFastVLine(x, valueY(values[x]), TOP + HEIGHT - valueY(values[x]), SSD1306_WHITE);
+         },
+         true},
+        {"bars",
+         [&] { PageChart::bars(buf, 0, TOP, HEIGHT, values, SAMPLES, SCALE); },
+         [&] {
+             for (int x = 0; x < SAMPLES; x++) {
+                 if (values[x] == 0) continue;
+                 for (int y = valueY(values[x]); y < TOP + HEIGHT; y++) display.drawPixel(x, y, SSD1306_WHITE);
+             }
+         },
+         [&] {
+             for (int x = 0; x < SAMPLES; x++) {
+                 if (values[x] == 0) continue;
+                 display.fillRect(x, valueY(values[x]), 1, TOP + HEIGHT - valueY(values[x]), SSD1306_WHITE);
+             }
+         },
+         true},
+        {"sparkline",
+         [&] { PageChart::sparkline(buf, 0, TOP, HEIGHT, values, SAMPLES, SCALE); },
+         [&] {
+             // Each column from its point halfway to each neighbour, one drawPixel at a time
+             for (int x = 0; x < SAMPLES; x++) {
+                 int cur = valueY(values[x]);
+                 int prev = x > 0 ? valueY(values[x - 1]) : cur;
+                 int next = x + 1 < SAMPLES ? valueY(values[x + 1]) : cur;
+                 int toPrev = cur + (prev - cur) / 2, toNext = cur + (next - cur) / 2;
+                 int top = std::min(cur, std::min(toPrev, toNext)), bottom = std::max(cur, std::max(toPrev, toNext));
+                 for (int y = top; y <= bottom; y++) display.drawPixel(x, y, SSD1306_WHITE);
+             }
+         },
+         [&] {
+             for (int x = 0; x + 1 < SAMPLES; x++) display.drawLine(x, valueY(values[x]), x + 1, valueY(values[x + 1]), SSD1306_WHITE);
+         },
+         false},
+        {"grid",
+         [&] {
+             for (int y = TOP; y < TOP + HEIGHT; y += 8) PageChart::dottedHLine(buf, 0, PageChart::WIDTH - 1, y, 3);
+         },
+         [&] {
+             for (int y = TOP; y < TOP + HEIGHT; y += 8)
+                 for (int x = 0; x < PageChart::WIDTH; x += 3) display.drawPixel(x, y, SSD1306_WHITE);
+         },
+         nullptr,
+         true},
+    };
+
+    printf("%-10s %10s %10s %10s %9s %9s %5s\n", "chart", "page_us", "pixel_us", "gfx_us", "x_pixel", "x_gfx", "same");
+    for (const Case& c : cases) {
+        uint8_t expected[PageChart::WIDTH * PageChart::HEIGHT / 8];
+        memset(buf, 0, sizeof(expected));
+        c.chart();
+        memcpy(expected, buf, sizeof(expected));
+        bool same = true;
+        for (const std::function<void()>* path : {&c.pixels, &c.gfx}) {
+            if (!*path || (path == &c.gfx && !c.gfxSamePixels)) continue;
+            memset(buf, 0, sizeof(expected));
+            (*path)();
+            same &= memcmp(expected, buf, sizeof(expected)) == 0;
+        }
+
+        double chart = timeDraw(iterations, c.chart);
+        double pixels = timeDraw(iterations, c.pixels);
+        double gfx = c.gfx ? timeDraw(iterations, c.gfx) : 0;
+        if (c.gfx) {
+            printf("%-10s %10.3f %10.3f %10.3f %9.1f %9.1f %5s\n", c.name, chart, pixels, gfx, pixels / chart, gfx / chart, same ? "yes" : "NO");
+        } else {
+            printf("%-10s %10.3f %10.3f %10s %9.1f %9s %5s\n", c.name, chart, pixels, "-", pixels / chart, "-", same ? "yes" : "NO");
+        }
+    }
+    return 0;
+}
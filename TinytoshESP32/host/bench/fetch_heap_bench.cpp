@@ -0,0 +1,148 @@
+// Peak heap per fetch for each API service, parsing recorded responses from
+// host/fixtures served over a local socket. Counts every operator new on the
+// calling thread from the start of the fetch, so the URL and log Strings and
+// HTTPClient's header lines are included; the parse documents live on the
+// stack and the body is never buffered. Exits non-zero if any fetch exceeds
+// FETCH_HEAP_BOUND.
+//
+//   fetch_heap_bench
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "StubHttpServer.h"
+#include "WeatherService.h"
+#include "AirQualityService.h"
+#include "CryptoService.h"
+#include "CurrencyService.h"
+#include "StockService.h"
+
+static const size_t FETCH_HEAP_BOUND = 2048;
+
+// --- Allocation counting -----------------------------------------------------
+
+static thread_local bool counting = false;
+static size_t liveBytes = 0;
+static size_t peakBytes = 0;
+static size_t allocations = 0;
+
+struct alignas(std::max_align_t) AllocHeader {
+    size_t size;
+    bool counted;
+};
+
+void* operator new(size_t size) {
+    AllocHeader* header = (AllocHeader*)malloc(sizeof(AllocHeader) + size);
+    if (!header) throw std::bad_alloc();
+    header->size = size;
+    header->counted = counting;
+    if (counting) {
+        liveBytes += size;
+        allocations++;
+        if (liveBytes > peakBytes) peakBytes = liveBytes;
+    }
+    return header + 1;
+}
+
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    AllocHeader* header = (AllocHeader*)p - 1;
+    if (header->counted) liveBytes -= header->size;
+    free(header);
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, size_t) noexcept { operator delete(p); }
+
+struct Result {
+    bool ok;
+    size_t peak;
+    size_t allocations;
+};
+
+template <typename Fetch>
+static Result measure(Fetch fetch) {
+    // The first run opens the pooled connection; measure a steady-state fetch
+    fetch();
+    liveBytes = peakBytes = allocations = 0;
+    counting = true;
+    bool ok = fetch();
+    counting = false;
+    return {ok, peakBytes, allocations};
+}
+
+static size_t fileSize(const std::string& path) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return 0;
+    fseek(f, 0, SEEK_END);
+    size_t size = ftell(f);
+    fclose(f);
+    return size;
+}
+
+int main() {
+    Serial.hostEcho(false);
+    StubHttpServer server;
+    WiFiClient::hostRouteAll(server.port());
+
+    struct Fixture {
+        const char* path;
+        const char* file;
+    };
+    static const Fixture FIXTURES[] = {
+        {"/v1/forecast", "open-meteo-forecast.json"},
+        {"/v1/air-quality", "open-meteo-air-quality.json"},
+        {"/api/ticker/", "coinlore-ticker.json"},
+        {"/npm/@fawazahmed0/currency-api@latest/v1/currencies/usd.min.json", "currency-usd.min.json"},
+        {"/q/l/", "stooq-quote.json"},
+    };
+    for (const Fixture& f : FIXTURES) {
+        if (!server.routeFile(f.path, std::string(FIXTURE_DIR) + "/" + f.file)) {
+            fprintf(stderr, "Missing fixture %s\n", f.file);
+            return 1;
+        }
+    }
+
+    HttpConnectionPool pool;
+    WeatherService weatherService(pool);
+    AirQualityService airQualityService(pool);
+    CryptoService cryptoService(pool);
+    CurrencyService currencyService(pool);
+    StockService stockService(pool);
+
+    Config config;
+    config.latitude = 52.52;
+    config.longitude = 13.41;
+    WeatherData weather;
+    AirQualityData aqi;
+    CryptoData crypto;
+    CurrencyData currency;
+    StockData stock;
+
+    struct Row {
+        const char* name;
+        const char* file;
+        Result result;
+    };
+    Row rows[] = {
+        {"weather", "open-meteo-forecast.json", measure([&] { return weatherService.fetchWeather(config, weather, "21:41"); })},
+        {"air_quality", "open-meteo-air-quality.json", measure([&] { return airQualityService.fetchAirQuality(config, aqi); })},
+        {"crypto", "coinlore-ticker.json", measure([&] { return cryptoService.fetchPrice(90, crypto); })},
+        {"currency", "currency-usd.min.json", measure([&] { return currencyService.fetchRate("USD", "EUR", currency); })},
+        {"stock", "stooq-quote.json", measure([&] { return stockService.fetchStock("AAPL", stock); })},
+    };
+
+    int failures = 0;
+    printf("%-12s %10s %10s %8s %s\n", "fetch", "body_bytes", "peak_heap", "allocs", "");
+    for (const Row& row : rows) {
+        bool over = row.result.peak > FETCH_HEAP_BOUND;
+        printf("%-12s %10zu %10zu %8zu %s\n", row.name, fileSize(std::string(FIXTURE_DIR) + "/" + row.file),
+               row.result.peak, row.result.allocations, !row.result.ok ? "FETCH FAILED" : over ? "OVER BOUND" : "");
+        if (!row.result.ok || over) failures++;
+    }
+    printf("bound %zu bytes\n", FETCH_HEAP_BOUND);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,294 @@
+// Load generator for the device's web server: N keep-alive connections send
+// requests back to back for a fixed time, then throughput, latency
+// percentiles and the status mix (503 "Busy" means a handler gave up on the
+// state lock) are printed. Run it against a device on the LAN:
+//
+//   http_load <host> [-p port] [-c connections] [-d seconds] [-u path]... [-b json] [-s stalled]
+//
+// Each -u adds a path to the round-robin (default /update); with -b the
+// requests are POSTs carrying that body, e.g. -u /pc-stats -b '{"cpu":12}'.
+// -s adds slow clients that POST /pc-stats headers and part of the body, then
+// stall; the server should drop them (408) instead of stalling everyone else.
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string host;
+    uint16_t port = 80;
+    int connections = 4;
+    int seconds = 10;
+    std::vector<std::string> paths;
+    std::string body;
+    int stalled = 0;
+};
+
+struct WorkerStats {
+    std::vector<double> latencyMs;
+    std::map<int, int> statuses;
+    int errors = 0;
+    int reconnects = 0;
+};
+
+static int connectTo(const sockaddr_in& addr) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    timeval timeout = {5, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    if (connect(fd, (const sockaddr*)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool sendAll(int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        sent += n;
+    }
+    return true;
+}
+
+// Reads one response (Content-Length or chunked); returns the status, or -1 on error.
+// keepAlive is cleared when the server closes the connection after it.
+static int readResponse(int fd, std::string& pending, bool& keepAlive) {
+    char chunk[2048];
+    auto fill = [&]() {
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) return false;
+        pending.append(chunk, n);
+        return true;
+    };
+
+    size_t headerEnd;
+    while ((headerEnd = pending.find("\r\n\r\n")) == std::string::npos) {
+        if (!fill()) return -1;
+    }
+    std::string head = pending.substr(0, headerEnd);
+    pending.erase(0, headerEnd + 4);
+    for (auto& c : head) c = tolower(c);
+
+    int status = atoi(head.c_str() + 9);
+    keepAlive = head.find("connection: close") == std::string::npos;
+
+    size_t lengthPos = head.find("content-length:");
+    if (lengthPos != std::string::npos) {
+        size_t length = strtoul(head.c_str() + lengthPos + 15, nullptr, 10);
+        while (pending.size() < length) {
+            if (!fill()) return -1;
+        }
+        pending.erase(0, length);
+        return status;
+    }
+
+    if (head.find("transfer-encoding: chunked") != std::string::npos) {
+        for (;;) {
+            size_t lineEnd;
+            while ((lineEnd = pending.find("\r\n")) == std::string::npos) {
+                if (!fill()) return -1;
+            }
+            size_t size = strtoul(pending.c_str(), nullptr, 16);
+            pending.erase(0, lineEnd + 2);
+            while (pending.size() < size + 2) {
+                if (!fill()) return -1;
+            }
+            pending.erase(0, size + 2);
+            if (size == 0) return status;
+        }
+    }
+
+    // No framing: the body runs to the end of the connection
+    while (fill()) pending.clear();
+    pending.clear();
+    keepAlive = false;
+    return status;
+}
+
+static void worker(const Options& options, const sockaddr_in& addr, int id, Clock::time_point end, WorkerStats& stats) {
+    int fd = -1;
+    std::string pending;
+    size_t next = id;
+
+    while (Clock::now() < end) {
+        if (fd < 0) {
+            fd = connectTo(addr);
+            if (fd < 0) {
+                stats.errors++;
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                continue;
+            }
+            pending.clear();
+            stats.reconnects++;
+        }
+
+        const std::string& path = options.paths[next++ % options.paths.size()];
+        std::string request = (options.body.empty() ? "GET " : "POST ") + path + " HTTP/1.1\r\nHost: " + options.host +
+                              "\r\nConnection: keep-alive\r\nAccept-Encoding: gzip\r\n";
+        if (!options.body.empty()) {
+            request += "Content-Type: application/json\r\nContent-Length: " + std::to_string(options.body.size()) + "\r\n";
+        }
+        request += "\r\n" + options.body;
+
+        auto start = Clock::now();
+        bool keepAlive = true;
+        int status = sendAll(fd, request) ? readResponse(fd, pending, keepAlive) : -1;
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        if (status < 0) {
+            stats.errors++;
+            close(fd);
+            fd = -1;
+            continue;
+        }
+        stats.latencyMs.push_back(ms);
+        stats.statuses[status]++;
+        if (!keepAlive) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    if (fd >= 0) close(fd);
+}
+
+struct StalledStats {
+    int sent = 0;
+    int timedOut = 0;       // answered 408
+    int dropped = 0;        // closed, or answered something else
+};
+
+// Sends headers and half the body, then waits for the server to give up on it
+static void stalledWorker(const sockaddr_in& addr, Clock::time_point end, StalledStats& stats) {
+    static const char BODY[] = "{\"pc_id\":\"stalled\",\"cpu_percent\":1,\"mem_percent\":2,\"disk_percent\":3}";
+    std::string request = "POST /pc-stats HTTP/1.1\r\nHost: device\r\nContent-Type: application/json\r\nContent-Length: " +
+                          std::to_string(sizeof(BODY) - 1) + "\r\n\r\n" + std::string(BODY, sizeof(BODY) / 2);
+
+    while (Clock::now() < end) {
+        int fd = connectTo(addr);
+        if (fd < 0 || !sendAll(fd, request)) {
+            if (fd >= 0) close(fd);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            continue;
+        }
+        stats.sent++;
+
+        // The 5 s socket timeout would end the wait too early, so keep polling until the end
+        char buffer[512];
+        ssize_t n = -1;
+        while (Clock::now() < end) {
+            n = recv(fd, buffer, sizeof(buffer) - 1, 0);
+            if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) break;
+        }
+        if (n > 0) {
+            buffer[n] = '\0';
+            if (strncmp(buffer + 9, "408", 3) == 0) stats.timedOut++;
+            else stats.dropped++;
+        } else if (n == 0) {
+            stats.dropped++;
+        }
+        close(fd);
+    }
+}
+
+static void usage() {
+    fprintf(stderr, "usage: http_load <host> [-p port] [-c connections] [-d seconds] [-u path]... [-b json] [-s stalled]\n");
+    exit(2);
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-p" && hasValue) options.port = atoi(argv[++i]);
+        else if (arg == "-c" && hasValue) options.connections = std::max(1, atoi(argv[++i]));
+        else if (arg == "-d" && hasValue) options.seconds = std::max(1, atoi(argv[++i]));
+        else if (arg == "-u" && hasValue) options.paths.push_back(argv[++i]);
+        else if (arg == "-b" && hasValue) options.body = argv[++i];
+        else if (arg == "-s" && hasValue) options.stalled = std::max(0, atoi(argv[++i]));
+        else if (arg[0] != '-' && options.host.empty()) options.host = arg;
+        else usage();
+    }
+    if (options.host.empty()) usage();
+    if (options.paths.empty()) options.paths.push_back("/update");
+
+    addrinfo hints = {}, *result = nullptr;
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(options.host.c_str(), nullptr, &hints, &result) != 0 || !result) {
+        fprintf(stderr, "Can't resolve %s\n", options.host.c_str());
+        return 1;
+    }
+    sockaddr_in addr = *(sockaddr_in*)result->ai_addr;
+    addr.sin_port = htons(options.port);
+    freeaddrinfo(result);
+
+    std::vector<WorkerStats> stats(options.connections);
+    std::vector<std::thread> threads;
+    auto start = Clock::now();
+    auto end = start + std::chrono::seconds(options.seconds);
+    std::vector<StalledStats> stalled(options.stalled);
+    for (int i = 0; i < options.stalled; i++) {
+        threads.emplace_back(stalledWorker, std::cref(addr), end, std::ref(stalled[i]));
+    }
+    for (int i = 0; i < options.connections; i++) {
+        threads.emplace_back(worker, std::cref(options), std::cref(addr), i, end, std::ref(stats[i]));
+    }
+    for (auto& t : threads) t.join();
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<double> latency;
+    std::map<int, int> statuses;
+    int errors = 0, connects = 0;
+    for (auto& s : stats) {
+        latency.insert(latency.end(), s.latencyMs.begin(), s.latencyMs.end());
+        for (auto& [status, count] : s.statuses) statuses[status] += count;
+        errors += s.errors;
+        connects += s.reconnects;
+    }
+    std::sort(latency.begin(), latency.end());
+    auto percentile = [&](double p) { return latency.empty() ? 0.0 : latency[std::min(latency.size() - 1, (size_t)(latency.size() * p))]; };
+
+    printf("%d connections, %.1f s, %zu responses, %d errors, %d connects\n", options.connections, elapsed,
+           latency.size(), errors, connects);
+    printf("requests/s  %.1f\n", latency.size() / elapsed);
+    printf("latency ms  p50 %.1f  p90 %.1f  p99 %.1f  max %.1f\n", percentile(0.50), percentile(0.90), percentile(0.99),
+           latency.empty() ? 0.0 : latency.back());
+    printf("status     ");
+    for (auto& [status, count] : statuses) printf(" %d:%d", status, count);
+    printf("\n");
+    if (options.stalled > 0) {
+        StalledStats total;
+        for (auto& s : stalled) {
+            total.sent += s.sent;
+            total.timedOut += s.timedOut;
+            total.dropped += s.dropped;
+        }
+        printf("stalled     %d clients, %d bodies stalled, %d answered 408, %d dropped\n", options.stalled, total.sent,
+               total.timedOut, total.dropped);
+    }
+    return errors > 0 && latency.empty() ? 1 : 0;
+}
@@ -0,0 +1,86 @@
+// Per-screen render cost on the host: drawScreen() for every scene, the
+// delta flush when cycling from one scene to the next, and each transition's
+// per-frame compose time. Host timings only rank screens and catch
+// regressions; the ESP32-C3 is one to two orders of magnitude slower.
+//
+//   render_bench [iterations]
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "Scenes.h"
+#include "DisplayService.h"
+
+struct Stats {
+    double mean, p50, p99, max;
+};
+
+static Stats summarize(std::vector<double>& us) {
+    std::sort(us.begin(), us.end());
+    double total = 0;
+    for (double v : us) total += v;
+    size_t n = us.size();
+    return {total / n, us[n / 2], us[std::min(n - 1, n * 99 / 100)], us[n - 1]};
+}
+
+static double nowUs() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+    Serial.hostEcho(false);
+
+    DisplayService ds(128, 64, -1);
+    TimeService timeService;
+    ds.begin();
+
+    printf("%-18s %9s %9s %9s %9s %12s\n", "scene", "mean_us", "p50_us", "p99_us", "max_us", "flush_bytes");
+    for (int i = 0; i < NUM_SCENES; i++) {
+        const Scene& scene = SCENES[i];
+        AppState state;
+        scene.setup(state);
+
+        std::vector<double> samples;
+        samples.reserve(iterations);
+        for (int n = 0; n < iterations; n++) {
+            double start = nowUs();
+            ds.drawScreen(scene.screen, state, timeService);
+            samples.push_back(nowUs() - start);
+        }
+
+        // Bytes the delta flush sends going from the previous scene to this one
+        uint64_t before = Wire.hostBytesSent();
+        ds.flush();
+        uint64_t bytes = Wire.hostBytesSent() - before;
+
+        Stats s = summarize(samples);
+        printf("%-18s %9.2f %9.2f %9.2f %9.2f %12llu\n", scene.name, s.mean, s.p50, s.p99, s.max, (unsigned long long)bytes);
+    }
+
+    static const char* EFFECTS[] = {"none", "slide_h", "slide_v", "dissolve", "curtain", "blinds"};
+    AppState state;
+    sceneWeather(state);
+    printf("\n%-18s %9s %9s %12s\n", "transition", "frames", "mean_us", "bytes/frame");
+    for (int effect = ANIM_SLIDE_HORIZONTAL; effect < ANIM_RANDOM; effect++) {
+        state.config.anim_mask = 1 << effect;
+        double total = 0;
+        int frames = 0;
+        uint64_t bytes = 0;
+        for (int n = 0; n < std::max(1, iterations / 20); n++) {
+            ds.startTransition(SCREEN_TIME, SCREEN_WEATHER, state, timeService);
+            while (ds.isAnimating()) {
+                uint64_t before = Wire.hostBytesSent();
+                double start = nowUs();
+                ds.stepTransition();
+                total += nowUs() - start;
+                bytes += Wire.hostBytesSent() - before;
+                frames++;
+                hostAdvanceClock(DisplayService::TRANSITION_FRAME_MS);
+            }
+        }
+        int runs = std::max(1, iterations / 20);
+        printf("%-18s %9d %9.2f %12llu\n", EFFECTS[effect], frames / runs, total / frames, (unsigned long long)(bytes / frames));
+    }
+    return 0;
+}
@@ -0,0 +1,139 @@
+// USB telemetry ingestion: PcMonitorService::handleSerial() fed through
+// Serial.hostFeed(), once per loop() pass as on the device. Reports lines/s
+// and per-call latency for whole lines, lines torn across calls (a partial
+// line must not make the call wait for the rest), framed telemetry and a
+// backlog drained under READ_BUDGET. Exits 1 if a call waited on the port or
+// a sample went missing. Host timings only compare paths; the ESP32-C3 is
+// much slower.
+//
+//   serial_ingest_bench [lines]
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "PcMonitorService.h"
+#include "SerialFrame.h"
+
+// The core's Stream timeout is 1000 ms; a call anywhere near that waited on the port
+static const double WAIT_BOUND_US = 50000;
+
+struct Stats {
+    double mean, p50, p99, max;
+};
+
+static Stats summarize(std::vector<double>& us) {
+    std::sort(us.begin(), us.end());
+    double total = 0;
+    for (double v : us) total += v;
+    size_t n = us.size();
+    return {total / n, us[n / 2], us[std::min(n - 1, n * 99 / 100)], us[n - 1]};
+}
+
+static double nowUs() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static std::string telemetryJson(int n) {
+    char json[256];
+    snprintf(json, sizeof(json),
+             "{\"pc_id\":\"pc-ab12\",\"cpu_percent\":%.1f,\"mem_percent\":%.1f,\"disk_percent\":48.0,"
+             "\"net_down_kb\":%.1f,\"media_status\":\"playing\",\"media_name\":\"Track %d\","
+             "\"media_author\":\"Artist\",\"media_album\":\"Album\"}",
+             (n * 7) % 100 + 0.5, 40 + (n % 30) + 0.25, (n * 13) % 900 + 0.5, n % 12);
+    return json;
+}
+
+// Captures what SerialFrame::send() writes, to feed it back in
+class Capture : public Print {
+public:
+    std::string bytes;
+    size_t write(uint8_t c) override {
+        bytes.push_back((char)c);
+        return 1;
+    }
+    using Print::write;
+};
+
+static std::string telemetryFrame(int n) {
+    std::string json = telemetryJson(n);
+    Capture out;
+    SerialFrame::send(out, SerialFrame::TELEMETRY, (uint8_t)(n % 255 + 1), (const uint8_t*)json.data(), json.size());
+    return out.bytes;
+}
+
+static uint32_t samplesApplied(const AppState& state) {
+    uint32_t total = 0;
+    for (const PcHost& host : state.pc_hosts.slots) {
+        if (host.id_hash != 0) total += host.stats.version;
+    }
+    return total;
+}
+
+static bool failed = false;
+
+// Feeds each message in `pieces` parts with one handleSerial() call after every
+// part, or all messages up front when `backlog` is set, then calls until drained
+static void run(const char* name, const std::vector<std::string>& messages, int pieces, bool backlog) {
+    PcMonitorService service;
+    AppState state;
+    std::vector<double> calls;
+    calls.reserve(messages.size() * pieces + 64);
+
+    auto call = [&]() {
+        double start = nowUs();
+        service.handleSerial(state);
+        calls.push_back(nowUs() - start);
+    };
+
+    double begin = nowUs();
+    if (backlog) {
+        for (const std::string& message : messages) Serial.hostFeed(message.data(), message.size());
+        while (Serial.available() > 0) call();
+    } else {
+        for (const std::string& message : messages) {
+            size_t step = (message.size() + pieces - 1) / pieces;
+            for (size_t offset = 0; offset < message.size(); offset += step) {
+                Serial.hostFeed(message.data() + offset, std::min(step, message.size() - offset));
+                call();
+            }
+        }
+    }
+    double elapsed = nowUs() - begin;
+
+    uint32_t applied = samplesApplied(state);
+    Stats s = summarize(calls);
+    printf("%-16s %8zu %11.0f %9.2f %9.2f %9.2f %9.2f %8u\n", name, calls.size(), messages.size() / (elapsed / 1e6),
+           s.mean, s.p50, s.p99, s.max, (unsigned)applied);
+
+    if (s.max > WAIT_BOUND_US) {
+        printf("  a call took %.0f us: handleSerial() waited on the port\n", s.max);
+        failed = true;
+    }
+    if (applied != messages.size()) {
+        printf("  %u of %zu samples applied\n", (unsigned)applied, messages.size());
+        failed = true;
+    }
+}
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? atoi(argv[1]) : 20000;
+    Serial.hostEcho(false);
+
+    std::vector<std::string> lines, frames;
+    for (int n = 0; n < count; n++) {
+        lines.push_back(telemetryJson(n) + "\n");
+        frames.push_back(telemetryFrame(n));
+    }
+    std::vector<std::string> burst(lines.begin(), lines.begin() + std::min(count, 64));
+
+    printf("%-16s %8s %11s %9s %9s %9s %9s %8s\n", "input", "calls", "lines/s", "mean_us", "p50_us", "p99_us", "max_us", "applied");
+    run("lines", lines, 1, false);
+    run("lines torn x3", lines, 3, false);
+    run("lines torn x16", lines, 16, false);
+    run("frames", frames, 1, false);
+    run("frames torn x3", frames, 3, false);
+    run("backlog 64", burst, 1, true);
+
+    return failed ? 1 : 0;
+}
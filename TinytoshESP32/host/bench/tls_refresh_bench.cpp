@@ -0,0 +1,166 @@
+// Cost of the TLS handshakes in a refresh cycle, with and without session
+// resumption. Each cycle fetches what a refresh does over https (weather, air
+// quality, crypto, currency, stock quote and history) through one
+// HttpConnectionPool, then ages the pool past its idle close, so every cycle
+// starts without sockets as on the device. Reports per-cycle wall time and the
+// heap churn on the calling thread (operator new plus OpenSSL's allocations).
+// The stub server handshakes on the same machine, so the numbers only rank the
+// two modes; an ESP32-C3 spends far longer per full handshake. Exits non-zero
+// if the resuming cycles don't all resume.
+//
+//   tls_refresh_bench [cycles]
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include <openssl/crypto.h>
+
+#include "StubHttpServer.h"
+#include "HttpConnectionPool.h"
+
+static const uint16_t TIMEOUT_MS = 2000;
+
+// --- Allocation counting -----------------------------------------------------
+
+static thread_local bool counting = false;
+static size_t allocations = 0;
+static size_t allocatedBytes = 0;
+
+static void count(size_t size) {
+    if (!counting) return;
+    allocations++;
+    allocatedBytes += size;
+}
+
+void* operator new(size_t size) {
+    count(size);
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, size_t) noexcept { operator delete(p); }
+
+static void* cryptoMalloc(size_t size, const char*, int) {
+    count(size);
+    return malloc(size);
+}
+
+static void* cryptoRealloc(void* p, size_t size, const char*, int) {
+    count(size);
+    return realloc(p, size);
+}
+
+static void cryptoFree(void* p, const char*, int) { free(p); }
+
+// --- Refresh cycles ----------------------------------------------------------
+
+static const char* const URLS[] = {
+    "https://api.open-meteo.com/v1/forecast?latitude=52.52&longitude=13.41",
+    "https://air-quality-api.open-meteo.com/v1/air-quality?latitude=52.52&longitude=13.41",
+    "https://api.coinlore.net/api/ticker/?id=90",
+    "https://cdn.jsdelivr.net/npm/@fawazahmed0/currency-api@latest/v1/currencies/usd.min.json",
+    "https://stooq.com/q/l/?s=aapl.us",
+    "https://stooq.com/q/d/l/?s=aapl.us&i=5",
+};
+
+static bool refresh(HttpConnectionPool& pool) {
+    bool ok = true;
+    for (const char* url : URLS) {
+        int code = 0;
+        HTTPClient& http = pool.get(url, TIMEOUT_MS, code);
+        if (code == HTTP_CODE_OK) {
+            HttpBodyStream& body = pool.body(http);
+            while (!body.finished()) body.read();
+        } else {
+            ok = false;
+        }
+        pool.release(http);
+    }
+    return ok;
+}
+
+struct Result {
+    bool ok;
+    double medianMs;
+    double maxMs;
+    int full;
+    int resumed;
+    size_t allocations;
+    size_t bytes;
+};
+
+static Result run(StubHttpServer& server, bool resumption, int cycles) {
+    server.setTlsResumption(resumption);
+    HttpConnectionPool pool;
+
+    // The first cycle meets every origin for the first time in both modes
+    bool ok = refresh(pool);
+    hostAdvanceClock(15 * 60 * 1000UL);
+    pool.closeIdle();
+
+    int handshakes = server.tlsHandshakes();
+    int resumed = server.tlsResumed();
+    allocations = allocatedBytes = 0;
+    std::vector<double> wallMs;
+    for (int i = 0; i < cycles; i++) {
+        auto start = std::chrono::steady_clock::now();
+        counting = true;
+        ok = refresh(pool) && ok;
+        hostAdvanceClock(15 * 60 * 1000UL);
+        pool.closeIdle();
+        counting = false;
+        wallMs.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(wallMs.begin(), wallMs.end());
+
+    Result result;
+    result.ok = ok;
+    result.medianMs = wallMs[wallMs.size() / 2];
+    result.maxMs = wallMs.back();
+    result.resumed = server.tlsResumed() - resumed;
+    result.full = server.tlsHandshakes() - handshakes - result.resumed;
+    result.allocations = allocations / cycles;
+    result.bytes = allocatedBytes / cycles;
+    return result;
+}
+
+int main(int argc, char** argv) {
+    // Before OpenSSL allocates anything
+    CRYPTO_set_mem_functions(cryptoMalloc, cryptoRealloc, cryptoFree);
+
+    int cycles = argc > 1 ? atoi(argv[1]) : 20;
+    if (cycles < 1) cycles = 1;
+
+    Serial.hostEcho(false);
+    StubHttpServer server;
+    WiFiClient::hostRouteAll(server.port());
+    hostTlsTrust(StubHttpServer::caPem().c_str());
+    // Bodies are small: the cycle cost is connection setup
+    for (const char* path : {"/v1/forecast", "/v1/air-quality", "/api/ticker/",
+                             "/npm/@fawazahmed0/currency-api@latest/v1/currencies/usd.min.json", "/q/l/", "/q/d/l/"}) {
+        server.route(path, {200, std::string(512, 'x')});
+    }
+
+    Result full = run(server, false, cycles);
+    Result resumed = run(server, true, cycles);
+
+    printf("%d cycles of %zu https fetches, sockets closed between cycles\n", cycles, sizeof(URLS) / sizeof(URLS[0]));
+    printf("%-10s %10s %10s %6s %8s %10s %12s\n", "sessions", "median_ms", "max_ms", "full", "resumed", "allocs/cyc",
+           "bytes/cyc");
+    for (const auto& row : {std::make_pair("none", full), std::make_pair("resumed", resumed)}) {
+        const Result& r = row.second;
+        printf("%-10s %10.2f %10.2f %6d %8d %10zu %12zu %s\n", row.first, r.medianMs, r.maxMs, r.full, r.resumed,
+               r.allocations, r.bytes, r.ok ? "" : "FETCH FAILED");
+    }
+
+    bool allResumed = resumed.full == 0 && resumed.resumed == cycles * 5;
+    if (!allResumed) printf("expected every handshake after the first cycle to resume\n");
+    return full.ok && resumed.ok && allResumed ? 0 : 1;
+}
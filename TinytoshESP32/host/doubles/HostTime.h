@@ -0,0 +1,12 @@
+#ifndef HOST_TIME_H
+#define HOST_TIME_H
+
+#include <time.h>
+
+// Wall clock seen by the TimeService double, in UTC. Fixed by default
+// (Sat 14 Mar 2026, 21:41:00) so rendered frames don't depend on when or
+// where the harness runs.
+void hostSetTime(time_t utc);
+time_t hostTime();
+
+#endif
@@ -0,0 +1,47 @@
+// Host double for TimeService: same formatting as the firmware's, but driven
+// by hostTime() instead of NTP, and no network lookups.
+#include "TimeService.h"
+#include "HostTime.h"
+#include "zones.h"
+
+static time_t fixedNow = 1773524460;
+
+void hostSetTime(time_t utc) { fixedNow = utc; }
+time_t hostTime() { return fixedNow; }
+
+static String formatNow(const char* format) {
+    time_t now = fixedNow;
+    struct tm timeinfo;
+    gmtime_r(&now, &timeinfo);
+    char buffer[32];
+    strftime(buffer, sizeof(buffer), format, &timeinfo);
+    return String(buffer);
+}
+
+TimeService::TimeService() {}
+
+void TimeService::syncNTP(const String& ianaTimezone) {
+    (void)ianaTimezone;
+}
+
+bool TimeService::fetchLocationData(Config& config) {
+    (void)config;
+    return false;
+}
+
+String TimeService::lookupPosixTimezone(const String& ianaTimezone) {
+    const char* posix = findPosixTimezone(ianaTimezone.c_str());
+    return posix ? String(posix) : String("GMT0");
+}
+
+String TimeService::getCurrentTimeShort(String format) {
+    return formatNow(format == "12" ? "%I:%M" : "%H:%M");
+}
+
+String TimeService::getCurrentTime(String format) {
+    return formatNow(format == "12" ? "%I:%M %d %b" : "%H:%M %d %b");
+}
+
+String TimeService::getFullDate() {
+    return formatNow("%A, %b %d");
+}
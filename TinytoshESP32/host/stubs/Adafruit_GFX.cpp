@@ -0,0 +1,221 @@
+#include "Adafruit_GFX.h"
+#include "glcdfont.h"
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    drawLine(x, y, x, y + h - 1, color);
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    drawLine(x, y, x + w - 1, y, color);
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t i = x; i < x + w; i++) drawFastVLine(i, y, h, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = y0 < y1 ? 1 : -1;
+
+    for (; x0 <= x1; x0++) {
+        if (steep) drawPixel(y0, x0, color);
+        else drawPixel(x0, y0, color);
+        err -= dy;
+        if (err < 0) {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color);
+    drawFastVLine(x + w - 1, y, h, color);
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color) {
+    // Rows of (w + 7) / 8 bytes, MSB is the leftmost pixel; 0 bits stay untouched
+    int16_t byteWidth = (w + 7) / 8;
+    uint8_t b = 0;
+    for (int16_t j = 0; j < h; j++, y++) {
+        for (int16_t i = 0; i < w; i++) {
+            if (i & 7) b <<= 1;
+            else b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+            if (b & 0x80) drawPixel(x + i, y, color);
+        }
+    }
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    int16_t byteWidth = (w + 7) / 8;
+    uint8_t b = 0;
+    for (int16_t j = 0; j < h; j++, y++) {
+        for (int16_t i = 0; i < w; i++) {
+            if (i & 7) b <<= 1;
+            else b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+            drawPixel(x + i, y, (b & 0x80) ? color : bg);
+        }
+    }
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t sizeX, uint8_t sizeY) {
+    if (!gfxFont) {
+        // Classic font: 5 columns of 8 rows, plus a blank 6th column
+        if (x >= _width || y >= _height || x + 6 * sizeX - 1 < 0 || y + 8 * sizeY - 1 < 0) return;
+        for (int8_t i = 0; i < 5; i++) {
+            uint8_t line = pgm_read_byte(&font[c * 5 + i]);
+            for (int8_t j = 0; j < 8; j++, line >>= 1) {
+                if (line & 1) {
+                    if (sizeX == 1 && sizeY == 1) drawPixel(x + i, y + j, color);
+                    else fillRect(x + i * sizeX, y + j * sizeY, sizeX, sizeY, color);
+                } else if (bg != color) {
+                    if (sizeX == 1 && sizeY == 1) drawPixel(x + i, y + j, bg);
+                    else fillRect(x + i * sizeX, y + j * sizeY, sizeX, sizeY, bg);
+                }
+            }
+        }
+        if (bg != color) {
+            if (sizeX == 1 && sizeY == 1) drawFastVLine(x + 5, y, 8, bg);
+            else fillRect(x + 5 * sizeX, y, sizeX, 8 * sizeY, bg);
+        }
+        return;
+    }
+
+    // GFX font: the glyph's bits are packed row by row, MSB first; no background
+    c -= gfxFont->first;
+    const GFXglyph* glyph = &gfxFont->glyph[c];
+    const uint8_t* bitmap = gfxFont->bitmap;
+    uint16_t bo = glyph->bitmapOffset;
+    uint8_t w = glyph->width, h = glyph->height;
+    int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+    uint8_t bits = 0, bit = 0;
+
+    for (uint8_t yy = 0; yy < h; yy++) {
+        for (uint8_t xx = 0; xx < w; xx++) {
+            if (!(bit++ & 7)) bits = pgm_read_byte(&bitmap[bo++]);
+            if (bits & 0x80) {
+                if (sizeX == 1 && sizeY == 1) drawPixel(x + xo + xx, y + yo + yy, color);
+                else fillRect(x + (xo + xx) * sizeX, y + (yo + yy) * sizeY, sizeX, sizeY, color);
+            }
+            bits <<= 1;
+        }
+    }
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+    if (!gfxFont) {
+        if (c == '\n') {
+            cursor_x = 0;
+            cursor_y += textsize_y * 8;
+        } else if (c != '\r') {
+            if (wrap && (cursor_x + textsize_x * 6) > _width) {
+                cursor_x = 0;
+                cursor_y += textsize_y * 8;
+            }
+            drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+            cursor_x += textsize_x * 6;
+        }
+        return 1;
+    }
+
+    if (c == '\n') {
+        cursor_x = 0;
+        cursor_y += (int16_t)textsize_y * gfxFont->yAdvance;
+    } else if (c != '\r' && c >= gfxFont->first && c <= gfxFont->last) {
+        const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+        if (glyph->width > 0 && glyph->height > 0) {
+            if (wrap && (cursor_x + textsize_x * (glyph->xOffset + glyph->width)) > _width) {
+                cursor_x = 0;
+                cursor_y += (int16_t)textsize_y * gfxFont->yAdvance;
+            }
+            drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+        }
+        cursor_x += glyph->xAdvance * (int16_t)textsize_x;
+    }
+    return 1;
+}
+
+void Adafruit_GFX::setFont(const GFXfont* f) {
+    // Like the library: the cursor moves so the baseline/top stays put when switching font kinds
+    if (f && !gfxFont) cursor_y += 6;
+    else if (!f && gfxFont) cursor_y -= 6;
+    gfxFont = f;
+}
+
+void Adafruit_GFX::charBounds(unsigned char c, int16_t* x, int16_t* y, int16_t* minx, int16_t* miny, int16_t* maxx, int16_t* maxy) {
+    if (gfxFont) {
+        if (c == '\n') {
+            *x = 0;
+            *y += textsize_y * gfxFont->yAdvance;
+        } else if (c != '\r' && c >= gfxFont->first && c <= gfxFont->last) {
+            const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+            uint8_t gw = glyph->width, gh = glyph->height, xa = glyph->xAdvance;
+            int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+            if (wrap && ((*x + ((int16_t)xo + gw) * textsize_x) > _width)) {
+                *x = 0;
+                *y += textsize_y * gfxFont->yAdvance;
+            }
+            int16_t x1 = *x + xo * textsize_x, y1 = *y + yo * textsize_y;
+            int16_t x2 = x1 + gw * textsize_x - 1, y2 = y1 + gh * textsize_y - 1;
+            if (x1 < *minx) *minx = x1;
+            if (y1 < *miny) *miny = y1;
+            if (x2 > *maxx) *maxx = x2;
+            if (y2 > *maxy) *maxy = y2;
+            *x += xa * textsize_x;
+        }
+        return;
+    }
+
+    if (c == '\n') {
+        *x = 0;
+        *y += textsize_y * 8;
+    } else if (c != '\r') {
+        if (wrap && ((*x + textsize_x * 6) > _width)) {
+            *x = 0;
+            *y += textsize_y * 8;
+        }
+        int16_t x2 = *x + textsize_x * 6 - 1, y2 = *y + textsize_y * 8 - 1;
+        if (x2 > *maxx) *maxx = x2;
+        if (y2 > *maxy) *maxy = y2;
+        if (*x < *minx) *minx = *x;
+        if (*y < *miny) *miny = *y;
+        *x += textsize_x * 6;
+    }
+}
+
+void Adafruit_GFX::getTextBounds(const char* str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+    *x1 = x;
+    *y1 = y;
+    *w = *h = 0;
+
+    uint8_t c;
+    while ((c = *str++)) charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+
+    if (maxx >= minx) {
+        *x1 = minx;
+        *w = maxx - minx + 1;
+    }
+    if (maxy >= miny) {
+        *y1 = miny;
+        *h = maxy - miny + 1;
+    }
+}
+
+void Adafruit_GFX::getTextBounds(const String& str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    getTextBounds(str.c_str(), x, y, x1, y1, w, h);
+}
@@ -0,0 +1,73 @@
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+struct GFXglyph {
+    uint16_t bitmapOffset;
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+};
+
+struct GFXfont {
+    uint8_t* bitmap;
+    GFXglyph* glyph;
+    uint16_t first;
+    uint16_t last;
+    uint8_t yAdvance;
+};
+
+// The parts of Adafruit_GFX the firmware draws with, following the library's
+// algorithms (text cursor and bounds rules, bitmap bit order, classic vs GFX
+// fonts), so layouts come out the same as on the device.
+class Adafruit_GFX : public Print {
+public:
+    Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color);
+    void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg);
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t sizeX, uint8_t sizeY);
+
+    void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+    int16_t getCursorX() const { return cursor_x; }
+    int16_t getCursorY() const { return cursor_y; }
+    void setTextSize(uint8_t s) { setTextSize(s, s); }
+    void setTextSize(uint8_t sx, uint8_t sy) { textsize_x = sx > 0 ? sx : 1; textsize_y = sy > 0 ? sy : 1; }
+    void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+    void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+    void setTextWrap(bool w) { wrap = w; }
+    void setFont(const GFXfont* f = nullptr);
+
+    void getTextBounds(const char* str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+    void getTextBounds(const String& str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h);
+
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+protected:
+    const int16_t WIDTH, HEIGHT;
+    int16_t _width, _height;
+    int16_t cursor_x = 0, cursor_y = 0;
+    uint16_t textcolor = 0xFFFF, textbgcolor = 0xFFFF;
+    uint8_t textsize_x = 1, textsize_y = 1;
+    bool wrap = true;
+    const GFXfont* gfxFont = nullptr;
+
+    void charBounds(unsigned char c, int16_t* x, int16_t* y, int16_t* minx, int16_t* miny, int16_t* maxx, int16_t* maxy);
+};
+
+#endif
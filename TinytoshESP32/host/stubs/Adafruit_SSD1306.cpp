@@ -0,0 +1,177 @@
+#include "Adafruit_SSD1306.h"
+
+// Same chunking as the library: one control byte plus up to WIRE_MAX - 1 payload bytes
+static const size_t WIRE_MAX = I2C_BUFFER_LENGTH < 256 ? I2C_BUFFER_LENGTH : 256;
+
+Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi, int8_t rst_pin)
+    : Adafruit_GFX(w, h), wire(twi) {
+    (void)rst_pin;
+}
+
+Adafruit_SSD1306::~Adafruit_SSD1306() {
+    free(buffer);
+}
+
+bool Adafruit_SSD1306::begin(uint8_t switchvcc, uint8_t i2caddr, bool reset, bool periphBegin) {
+    (void)switchvcc;
+    (void)reset;
+    (void)periphBegin;
+    if (!buffer && !(buffer = (uint8_t*)malloc(WIDTH * ((HEIGHT + 7) / 8)))) return false;
+    clearDisplay();
+    address = i2caddr;
+    wire->hostAttach(address, this);
+    return true;
+}
+
+void Adafruit_SSD1306::clearDisplay() {
+    memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+}
+
+void Adafruit_SSD1306::ssd1306_command(uint8_t c) {
+    wire->beginTransmission(address);
+    wire->write((uint8_t)0x00);
+    wire->write(c);
+    wire->endTransmission();
+}
+
+void Adafruit_SSD1306::display() {
+    static const uint8_t window[] = {SSD1306_PAGEADDR, 0, 0xFF, SSD1306_COLUMNADDR, 0};
+    wire->beginTransmission(address);
+    wire->write((uint8_t)0x00);
+    wire->write(window, sizeof(window));
+    wire->endTransmission();
+    ssd1306_command(WIDTH - 1);
+
+    size_t count = WIDTH * ((HEIGHT + 7) / 8);
+    const uint8_t* ptr = buffer;
+    wire->beginTransmission(address);
+    wire->write((uint8_t)0x40);
+    size_t bytesOut = 1;
+    while (count--) {
+        if (bytesOut >= WIRE_MAX) {
+            wire->endTransmission();
+            wire->beginTransmission(address);
+            wire->write((uint8_t)0x40);
+            bytesOut = 1;
+        }
+        wire->write(*ptr++);
+        bytesOut++;
+    }
+    wire->endTransmission();
+}
+
+void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || x >= width() || y < 0 || y >= height()) return;
+    uint8_t& b = buffer[x + (y / 8) * WIDTH];
+    uint8_t bit = 1 << (y & 7);
+    switch (color) {
+        case SSD1306_WHITE:   b |= bit; break;
+        case SSD1306_BLACK:   b &= ~bit; break;
+        case SSD1306_INVERSE: b ^= bit; break;
+    }
+}
+
+void Adafruit_SSD1306::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (y < 0 || y >= HEIGHT) return;
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (x + w > WIDTH) w = WIDTH - x;
+    if (w <= 0) return;
+
+    uint8_t* p = &buffer[(y / 8) * WIDTH + x];
+    uint8_t mask = 1 << (y & 7);
+    switch (color) {
+        case SSD1306_WHITE:   while (w--) *p++ |= mask; break;
+        case SSD1306_BLACK:   mask = ~mask; while (w--) *p++ &= mask; break;
+        case SSD1306_INVERSE: while (w--) *p++ ^= mask; break;
+    }
+}
+
+void Adafruit_SSD1306::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    if (x < 0 || x >= WIDTH) return;
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (y + h > HEIGHT) h = HEIGHT - y;
+    if (h <= 0) return;
+
+    // Partial byte at the top, whole bytes, partial byte at the bottom
+    for (int16_t row = y; row < y + h;) {
+        uint8_t* p = &buffer[(row / 8) * WIDTH + x];
+        int16_t bit = row & 7;
+        int16_t span = std::min<int16_t>(8 - bit, y + h - row);
+        uint8_t mask = (uint8_t)(((1 << span) - 1) << bit);
+        switch (color) {
+            case SSD1306_WHITE:   *p |= mask; break;
+            case SSD1306_BLACK:   *p &= ~mask; break;
+            case SSD1306_INVERSE: *p ^= mask; break;
+        }
+        row += span;
+    }
+}
+
+bool Adafruit_SSD1306::getPixel(int16_t x, int16_t y) {
+    if (x < 0 || x >= width() || y < 0 || y >= height()) return false;
+    return buffer[x + (y / 8) * WIDTH] & (1 << (y & 7));
+}
+
+void Adafruit_SSD1306::command(uint8_t byte) {
+    if (pendingArgs) {
+        args[argCount++] = byte;
+        if (argCount < pendingArgs) return;
+        pendingArgs = 0;
+        switch (pendingCommand) {
+            case SSD1306_COLUMNADDR:
+                colStart = std::min<uint8_t>(args[0], 127);
+                colEnd = std::min<uint8_t>(args[1], 127);
+                col = colStart;
+                break;
+            case SSD1306_PAGEADDR:
+                pageStart = std::min<uint8_t>(args[0], 7);
+                pageEnd = std::min<uint8_t>(args[1], 7);
+                page = pageStart;
+                break;
+            case SSD1306_SETCONTRAST:
+                contrast = args[0];
+                break;
+        }
+        return;
+    }
+
+    pendingCommand = byte;
+    argCount = 0;
+    switch (byte) {
+        case SSD1306_COLUMNADDR:
+        case SSD1306_PAGEADDR:
+            pendingArgs = 2;
+            break;
+        case SSD1306_SETCONTRAST:
+        case SSD1306_MEMORYMODE:
+        case 0xA8: case 0xD3: case 0x8D: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            pendingArgs = 1;
+            break;
+    }
+}
+
+void Adafruit_SSD1306::receive(const uint8_t* data, size_t length) {
+    if (length == 0) return;
+    if (data[0] == 0x00) {
+        for (size_t i = 1; i < length; i++) command(data[i]);
+        return;
+    }
+    if (data[0] != 0x40) return;
+
+    // Horizontal addressing: the column wraps inside the window, then the page
+    for (size_t i = 1; i < length; i++) {
+        panel[page * 128 + col] = data[i];
+        if (col < colEnd) {
+            col++;
+            continue;
+        }
+        col = colStart;
+        page = page < pageEnd ? page + 1 : pageStart;
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef HOST_ADAFRUIT_SSD1306_H
+#define HOST_ADAFRUIT_SSD1306_H
+
+#include <Adafruit_GFX.h>
+#include <Wire.h>
+
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_INVERSE 2
+#define BLACK SSD1306_BLACK
+#define WHITE SSD1306_WHITE
+#define INVERSE SSD1306_INVERSE
+
+#define SSD1306_MEMORYMODE 0x20
+#define SSD1306_COLUMNADDR 0x21
+#define SSD1306_PAGEADDR 0x22
+#define SSD1306_SETCONTRAST 0x81
+#define SSD1306_DISPLAYOFF 0xAE
+#define SSD1306_DISPLAYON 0xAF
+#define SSD1306_EXTERNALVCC 0x01
+#define SSD1306_SWITCHCAPVCC 0x02
+
+// Fake Adafruit_SSD1306: draws into the same page-major buffer (byte = 8
+// vertical pixels, LSB on top) and sends display() and commands over the
+// harness Wire like the library does. The panel side decodes that I2C
+// traffic into a model of the controller's GDDRAM, so tests can check what
+// would actually be on the glass.
+class Adafruit_SSD1306 : public Adafruit_GFX, public WireDevice {
+public:
+    Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi = &Wire, int8_t rst_pin = -1);
+    ~Adafruit_SSD1306();
+
+    bool begin(uint8_t switchvcc = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0, bool reset = true, bool periphBegin = true);
+    void display();
+    void clearDisplay();
+    void ssd1306_command(uint8_t c);
+    uint8_t* getBuffer() { return buffer; }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    bool getPixel(int16_t x, int16_t y);
+
+    // Harness hooks: the modelled controller state
+    const uint8_t* hostPanel() const { return panel; }
+    uint8_t hostContrast() const { return contrast; }
+
+    void receive(const uint8_t* data, size_t length) override;
+
+private:
+    TwoWire* wire;
+    uint8_t address = 0;
+    uint8_t* buffer = nullptr;
+
+    // Controller model
+    uint8_t panel[128 * 8] = {0};
+    uint8_t contrast = 0x7F;
+    uint8_t pageStart = 0, pageEnd = 7, colStart = 0, colEnd = 127;
+    uint8_t page = 0, col = 0;
+    uint8_t pendingCommand = 0;
+    uint8_t pendingArgs = 0;
+    uint8_t args[2] = {0};
+    uint8_t argCount = 0;
+
+    void command(uint8_t byte);
+};
+
+#endif
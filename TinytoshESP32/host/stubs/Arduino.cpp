@@ -0,0 +1,310 @@
+#include "Arduino.h"
+
+#include <cctype>
+#include <chrono>
+#include <cstdarg>
+#include <random>
+#include <thread>
+
+HardwareSerial Serial;
+
+// --- Clock -------------------------------------------------------------------
+
+static const auto clockStart = std::chrono::steady_clock::now();
+static unsigned long long clockOffsetUs = 0;
+
+static unsigned long long elapsedUs() {
+    auto now = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now - clockStart).count() + clockOffsetUs;
+}
+
+unsigned long millis() { return (unsigned long)(elapsedUs() / 1000); }
+unsigned long micros() { return (unsigned long)elapsedUs(); }
+void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+void delayMicroseconds(unsigned int us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+void yield() { std::this_thread::yield(); }
+void hostAdvanceClock(unsigned long ms) { clockOffsetUs += (unsigned long long)ms * 1000; }
+
+static std::mt19937 rng(1);
+
+long random(long howBig) { return howBig <= 0 ? 0 : (long)(rng() % (unsigned long)howBig); }
+long random(long howSmall, long howBig) { return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall); }
+void randomSeed(unsigned long seed) { rng.seed(seed); }
+uint32_t esp_random() { return (uint32_t)rng(); }
+
+bool getLocalTime(struct tm* info, uint32_t) {
+    time_t now = time(nullptr);
+    localtime_r(&now, info);
+    return info->tm_year > 2016 - 1900;
+}
+
+// --- String ------------------------------------------------------------------
+
+static std::string formatInteger(unsigned long long value, bool negative, unsigned char base) {
+    if (base < 2 || base > 36) base = 10;
+    char digits[72];
+    int n = 0;
+    do {
+        int d = value % base;
+        digits[n++] = d < 10 ? '0' + d : 'a' + d - 10;
+        value /= base;
+    } while (value);
+    std::string out = negative ? "-" : "";
+    while (n) out += digits[--n];
+    return out;
+}
+
+static std::string formatSigned(long long value, unsigned char base) {
+    // Like itoa(): only base 10 gets a sign, other bases print the two's complement
+    if (base == 10 && value < 0) return formatInteger(0ULL - (unsigned long long)value, true, base);
+    return formatInteger((unsigned long long)value, false, base);
+}
+
+static std::string formatFloat(double value, unsigned int decimals) {
+    if (std::isnan(value)) return "nan";
+    if (std::isinf(value)) return "inf";
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+    return buf;
+}
+
+String::String(int value, unsigned char base) : s(formatSigned(value, base)) {}
+String::String(long value, unsigned char base) : s(formatSigned(value, base)) {}
+String::String(long long value, unsigned char base) : s(formatSigned(value, base)) {}
+String::String(unsigned int value, unsigned char base) : s(formatInteger(value, false, base)) {}
+String::String(unsigned long value, unsigned char base) : s(formatInteger(value, false, base)) {}
+String::String(unsigned long long value, unsigned char base) : s(formatInteger(value, false, base)) {}
+String::String(float value, unsigned int decimals) : s(formatFloat(value, decimals)) {}
+String::String(double value, unsigned int decimals) : s(formatFloat(value, decimals)) {}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    if (s.size() != other.s.size()) return false;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (tolower((unsigned char)s[i]) != tolower((unsigned char)other.s[i])) return false;
+    }
+    return true;
+}
+
+bool String::endsWith(const String& suffix) const {
+    return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t pos = s.find(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String& text, unsigned int from) const {
+    size_t pos = s.find(text.s, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char c) const {
+    size_t pos = s.rfind(c);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(const String& text) const {
+    size_t pos = s.rfind(text.s);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int from) const {
+    return from >= s.size() ? String() : String(s.substr(from));
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s.size()) return String();
+    if (to > s.size()) to = s.size();
+    return String(s.substr(from, to - from));
+}
+
+void String::replace(const String& find, const String& with) {
+    if (find.s.empty()) return;
+    size_t pos = 0;
+    while ((pos = s.find(find.s, pos)) != std::string::npos) {
+        s.replace(pos, find.s.size(), with.s);
+        pos += with.s.size();
+    }
+}
+
+void String::remove(unsigned int index) {
+    if (index < s.size()) s.erase(index);
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+    if (index < s.size()) s.erase(index, count);
+}
+
+void String::toUpperCase() {
+    for (char& c : s) c = toupper((unsigned char)c);
+}
+
+void String::toLowerCase() {
+    for (char& c : s) c = tolower((unsigned char)c);
+}
+
+void String::trim() {
+    size_t begin = 0;
+    size_t end = s.size();
+    while (begin < end && isspace((unsigned char)s[begin])) begin++;
+    while (end > begin && isspace((unsigned char)s[end - 1])) end--;
+    s = s.substr(begin, end - begin);
+}
+
+long String::toInt() const { return atol(s.c_str()); }
+float String::toFloat() const { return (float)atof(s.c_str()); }
+double String::toDouble() const { return atof(s.c_str()); }
+
+String operator+(const String& a, const String& b) { String r = a; r += b; return r; }
+String operator+(const String& a, const char* b) { String r = a; r += b; return r; }
+String operator+(const char* a, const String& b) { String r = a; r += b; return r; }
+String operator+(const String& a, char b) { String r = a; r += b; return r; }
+String operator+(const String& a, int b) { return a + String(b); }
+String operator+(const String& a, unsigned int b) { return a + String(b); }
+String operator+(const String& a, long b) { return a + String(b); }
+String operator+(const String& a, unsigned long b) { return a + String(b); }
+String operator+(const String& a, float b) { return a + String(b); }
+String operator+(const String& a, double b) { return a + String(b); }
+
+// --- Print -------------------------------------------------------------------
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        if (write(*buffer++)) n++;
+        else break;
+    }
+    return n;
+}
+
+size_t Print::write(const char* str) {
+    return str ? write((const uint8_t*)str, strlen(str)) : 0;
+}
+
+size_t Print::printf(const char* format, ...) {
+    char small[128];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(small, sizeof(small), format, args);
+    va_end(args);
+    if (length < 0) return 0;
+    if ((size_t)length < sizeof(small)) return write((const uint8_t*)small, length);
+
+    std::string big(length + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&big[0], big.size(), format, args);
+    va_end(args);
+    return write((const uint8_t*)big.data(), length);
+}
+
+size_t Print::print(long value, int base) { return print(String(value, (unsigned char)base)); }
+size_t Print::print(unsigned long value, int base) { return print(String(value, (unsigned char)base)); }
+size_t Print::print(long long value, int base) { return print(String(value, (unsigned char)base)); }
+size_t Print::print(unsigned long long value, int base) { return print(String(value, (unsigned char)base)); }
+size_t Print::print(double value, int digits) { return print(String(value, (unsigned int)digits)); }
+
+// --- Stream ------------------------------------------------------------------
+
+int Stream::timedRead() {
+    unsigned long start = millis();
+    do {
+        int c = read();
+        if (c >= 0) return c;
+        yield();
+    } while (millis() - start < timeout);
+    return -1;
+}
+
+int Stream::timedPeek() {
+    unsigned long start = millis();
+    do {
+        int c = peek();
+        if (c >= 0) return c;
+        yield();
+    } while (millis() - start < timeout);
+    return -1;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        int c = timedRead();
+        if (c < 0) break;
+        buffer[count++] = (char)c;
+    }
+    return count;
+}
+
+size_t Stream::readBytesUntil(char terminator, char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        int c = timedRead();
+        if (c < 0 || c == terminator) break;
+        buffer[count++] = (char)c;
+    }
+    return count;
+}
+
+String Stream::readString() {
+    String out;
+    int c;
+    while ((c = timedRead()) >= 0) out += (char)c;
+    return out;
+}
+
+String Stream::readStringUntil(char terminator) {
+    String out;
+    int c;
+    while ((c = timedRead()) >= 0 && c != terminator) out += (char)c;
+    return out;
+}
+
+// --- Serial ------------------------------------------------------------------
+
+int HardwareSerial::read() {
+    if (rxPos >= rx.size()) return -1;
+    int c = (uint8_t)rx[rxPos++];
+    if (rxPos == rx.size()) {
+        rx.clear();
+        rxPos = 0;
+    }
+    return c;
+}
+
+size_t HardwareSerial::readBytes(char* buffer, size_t length) {
+    // Never waits: whatever was fed is all there will be
+    size_t n = std::min(length, rx.size() - rxPos);
+    memcpy(buffer, rx.data() + rxPos, n);
+    rxPos += n;
+    if (rxPos == rx.size()) {
+        rx.clear();
+        rxPos = 0;
+    }
+    return n;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    if (capture) captured.append((const char*)buffer, size);
+    if (echo) fwrite(buffer, 1, size, stdout);
+    return size;
+}
+
+void HardwareSerial::hostFeed(const void* data, size_t length) {
+    rx.append((const char*)data, length);
+}
+
+void HardwareSerial::hostFeed(const char* text) {
+    hostFeed(text, strlen(text));
+}
+
+std::string HardwareSerial::hostTakeOutput() {
+    std::string out;
+    out.swap(captured);
+    return out;
+}
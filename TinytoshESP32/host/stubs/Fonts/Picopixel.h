@@ -0,0 +1,129 @@
+// Stand-in for Adafruit GFX's Fonts/Picopixel.h: the same GFXfont layout,
+// range and line height, with 3x5 glyphs sampled from the harness's 5x7
+// font. Layout and wrapping behave like the device; glyph shapes don't
+// match it pixel for pixel.
+#ifndef HOST_PICOPIXEL_H
+#define HOST_PICOPIXEL_H
+
+#include <Adafruit_GFX.h>
+
+const uint8_t PicopixelBitmaps[] PROGMEM = {
+    0xE8, 0xB4, 0x00, 0x00, 0x00, 0x4D, 0x64, 0x95, 0x52, 0x18, 0x46, 0x6E,
+    0x00, 0x2A, 0x22, 0x88, 0xA8, 0x5F, 0xF4, 0x0B, 0xA0, 0x03, 0x80, 0x03,
+    0x80, 0x03, 0xC0, 0x05, 0x40, 0x57, 0xD4, 0x59, 0x2E, 0x55, 0x4E, 0xE5,
+    0x54, 0x0A, 0x00, 0xF0, 0xD4, 0x63, 0x54, 0xE4, 0x08, 0x55, 0x54, 0x55,
+    0x8C, 0x00, 0x01, 0x80, 0x22, 0x02, 0x00, 0x00, 0x88, 0xA8, 0x55, 0x04,
+    0x57, 0xC6, 0x42, 0xDA, 0xD7, 0x5C, 0x56, 0x54, 0xD6, 0xDC, 0xF3, 0x4E,
+    0xF3, 0x48, 0x76, 0x56, 0xB7, 0xDA, 0xE9, 0x2E, 0x60, 0x44, 0xB2, 0x4A,
+    0x92, 0x4E, 0xB7, 0xDA, 0xB7, 0xDA, 0x56, 0xD4, 0xD7, 0x48, 0x56, 0xC6,
+    0xD7, 0x4A, 0x55, 0x54, 0xFD, 0x24, 0xB6, 0xD4, 0xB6, 0x84, 0xB7, 0xF0,
+    0xB5, 0x5A, 0xB5, 0x24, 0xE5, 0x4E, 0xF2, 0x4E, 0x11, 0x10, 0xE4, 0x9E,
+    0x40, 0x00, 0x00, 0x0E, 0xD8, 0x80, 0x00, 0x46, 0x92, 0xDC, 0x02, 0xD4,
+    0x26, 0xD6, 0x02, 0xC4, 0x0F, 0x24, 0x02, 0xB2, 0x92, 0xDA, 0x41, 0x2E,
+    0x20, 0xD4, 0x92, 0x4A, 0xC9, 0x2E, 0x03, 0xFE, 0x02, 0xDA, 0x02, 0xD4,
+    0x02, 0xE8, 0x02, 0xB2, 0x02, 0xC8, 0x02, 0x1C, 0x49, 0x30, 0x02, 0xD6,
+    0x02, 0x84, 0x02, 0xF0, 0x00, 0x0A, 0x02, 0x9A, 0x00, 0x0E, 0x2A, 0x22,
+    0xD8, 0x88, 0xA8, 0x1C, 0x00,
+};
+
+const GFXglyph PicopixelGlyphs[] PROGMEM = {
+    {   0, 0, 0, 2, 0,  1},  // 0x20 ' '
+    {   0, 1, 5, 2, 0, -4},  // 0x21 '!'
+    {   1, 3, 5, 4, 0, -4},  // 0x22 '"'
+    {   3, 3, 5, 4, 0, -4},  // 0x23 '#'
+    {   5, 3, 5, 4, 0, -4},  // 0x24 '$'
+    {   7, 3, 5, 4, 0, -4},  // 0x25 '%'
+    {   9, 3, 5, 4, 0, -4},  // 0x26 '&'
+    {  11, 3, 5, 4, 0, -4},  // 0x27 '''
+    {  13, 3, 5, 4, 0, -4},  // 0x28 '('
+    {  15, 3, 5, 4, 0, -4},  // 0x29 ')'
+    {  17, 3, 5, 4, 0, -4},  // 0x2A '*'
+    {  19, 3, 5, 4, 0, -4},  // 0x2B '+'
+    {  21, 2, 5, 3, 0, -4},  // 0x2C ','
+    {  23, 3, 5, 4, 0, -4},  // 0x2D '-'
+    {  25, 2, 5, 3, 0, -4},  // 0x2E '.'
+    {  27, 3, 5, 4, 0, -4},  // 0x2F '/'
+    {  29, 3, 5, 4, 0, -4},  // 0x30 '0'
+    {  31, 3, 5, 4, 0, -4},  // 0x31 '1'
+    {  33, 3, 5, 4, 0, -4},  // 0x32 '2'
+    {  35, 3, 5, 4, 0, -4},  // 0x33 '3'
+    {  37, 3, 5, 4, 0, -4},  // 0x34 '4'
+    {  39, 3, 5, 4, 0, -4},  // 0x35 '5'
+    {  41, 3, 5, 4, 0, -4},  // 0x36 '6'
+    {  43, 3, 5, 4, 0, -4},  // 0x37 '7'
+    {  45, 3, 5, 4, 0, -4},  // 0x38 '8'
+    {  47, 3, 5, 4, 0, -4},  // 0x39 '9'
+    {  49, 1, 5, 2, 0, -4},  // 0x3A ':'
+    {  50, 2, 5, 3, 0, -4},  // 0x3B ';'
+    {  52, 3, 5, 4, 0, -4},  // 0x3C '<'
+    {  54, 3, 5, 4, 0, -4},  // 0x3D '='
+    {  56, 3, 5, 4, 0, -4},  // 0x3E '>'
+    {  58, 3, 5, 4, 0, -4},  // 0x3F '?'
+    {  60, 3, 5, 4, 0, -4},  // 0x40 '@'
+    {  62, 3, 5, 4, 0, -4},  // 0x41 'A'
+    {  64, 3, 5, 4, 0, -4},  // 0x42 'B'
+    {  66, 3, 5, 4, 0, -4},  // 0x43 'C'
+    {  68, 3, 5, 4, 0, -4},  // 0x44 'D'
+    {  70, 3, 5, 4, 0, -4},  // 0x45 'E'
+    {  72, 3, 5, 4, 0, -4},  // 0x46 'F'
+    {  74, 3, 5, 4, 0, -4},  // 0x47 'G'
+    {  76, 3, 5, 4, 0, -4},  // 0x48 'H'
+    {  78, 3, 5, 4, 0, -4},  // 0x49 'I'
+    {  80, 3, 5, 4, 0, -4},  // 0x4A 'J'
+    {  82, 3, 5, 4, 0, -4},  // 0x4B 'K'
+    {  84, 3, 5, 4, 0, -4},  // 0x4C 'L'
+    {  86, 3, 5, 4, 0, -4},  // 0x4D 'M'
+    {  88, 3, 5, 4, 0, -4},  // 0x4E 'N'
+    {  90, 3, 5, 4, 0, -4},  // 0x4F 'O'
+    {  92, 3, 5, 4, 0, -4},  // 0x50 'P'
+    {  94, 3, 5, 4, 0, -4},  // 0x51 'Q'
+    {  96, 3, 5, 4, 0, -4},  // 0x52 'R'
+    {  98, 3, 5, 4, 0, -4},  // 0x53 'S'
+    { 100, 3, 5, 4, 0, -4},  // 0x54 'T'
+    { 102, 3, 5, 4, 0, -4},  // 0x55 'U'
+    { 104, 3, 5, 4, 0, -4},  // 0x56 'V'
+    { 106, 3, 5, 4, 0, -4},  // 0x57 'W'
+    { 108, 3, 5, 4, 0, -4},  // 0x58 'X'
+    { 110, 3, 5, 4, 0, -4},  // 0x59 'Y'
+    { 112, 3, 5, 4, 0, -4},  // 0x5A 'Z'
+    { 114, 3, 5, 4, 0, -4},  // 0x5B '['
+    { 116, 3, 5, 4, 0, -4},  // 0x5C 'backslash'
+    { 118, 3, 5, 4, 0, -4},  // 0x5D ']'
+    { 120, 3, 5, 4, 0, -4},  // 0x5E '^'
+    { 122, 3, 5, 4, 0, -4},  // 0x5F '_'
+    { 124, 3, 5, 4, 0, -4},  // 0x60 '`'
+    { 126, 3, 5, 4, 0, -4},  // 0x61 'a'
+    { 128, 3, 5, 4, 0, -4},  // 0x62 'b'
+    { 130, 3, 5, 4, 0, -4},  // 0x63 'c'
+    { 132, 3, 5, 4, 0, -4},  // 0x64 'd'
+    { 134, 3, 5, 4, 0, -4},  // 0x65 'e'
+    { 136, 3, 5, 4, 0, -4},  // 0x66 'f'
+    { 138, 3, 5, 4, 0, -4},  // 0x67 'g'
+    { 140, 3, 5, 4, 0, -4},  // 0x68 'h'
+    { 142, 3, 5, 4, 0, -4},  // 0x69 'i'
+    { 144, 3, 5, 4, 0, -4},  // 0x6A 'j'
+    { 146, 3, 5, 4, 0, -4},  // 0x6B 'k'
+    { 148, 3, 5, 4, 0, -4},  // 0x6C 'l'
+    { 150, 3, 5, 4, 0, -4},  // 0x6D 'm'
+    { 152, 3, 5, 4, 0, -4},  // 0x6E 'n'
+    { 154, 3, 5, 4, 0, -4},  // 0x6F 'o'
+    { 156, 3, 5, 4, 0, -4},  // 0x70 'p'
+    { 158, 3, 5, 4, 0, -4},  // 0x71 'q'
+    { 160, 3, 5, 4, 0, -4},  // 0x72 'r'
+    { 162, 3, 5, 4, 0, -4},  // 0x73 's'
+    { 164, 3, 5, 4, 0, -4},  // 0x74 't'
+    { 166, 3, 5, 4, 0, -4},  // 0x75 'u'
+    { 168, 3, 5, 4, 0, -4},  // 0x76 'v'
+    { 170, 3, 5, 4, 0, -4},  // 0x77 'w'
+    { 172, 3, 5, 4, 0, -4},  // 0x78 'x'
+    { 174, 3, 5, 4, 0, -4},  // 0x79 'y'
+    { 176, 3, 5, 4, 0, -4},  // 0x7A 'z'
+    { 178, 3, 5, 4, 0, -4},  // 0x7B '{'
+    { 180, 1, 5, 2, 0, -4},  // 0x7C '|'
+    { 181, 3, 5, 4, 0, -4},  // 0x7D '}'
+    { 183, 3, 5, 4, 0, -4},  // 0x7E '~'
+};
+
+const GFXfont Picopixel PROGMEM = {(uint8_t*)PicopixelBitmaps, (GFXglyph*)PicopixelGlyphs, 0x20, 0x7E, 7};
+
+#endif
@@ -0,0 +1,137 @@
+#include "HTTPClient.h"
+
+bool HTTPClient::begin(WiFiClient& newClient, const String& url) {
+    client = &newClient;
+
+    int schemeEnd = url.indexOf("://");
+    if (schemeEnd < 0) return false;
+    String scheme = url.substring(0, schemeEnd);
+    if (scheme != "http" && scheme != "https") return false;
+    port = scheme == "https" ? 443 : 80;
+
+    String rest = url.substring(schemeEnd + 3);
+    int pathStart = rest.indexOf('/');
+    host = pathStart < 0 ? rest : rest.substring(0, pathStart);
+    uri = pathStart < 0 ? String("/") : rest.substring(pathStart);
+
+    int colon = host.indexOf(':');
+    if (colon >= 0) {
+        port = (uint16_t)host.substring(colon + 1).toInt();
+        host = host.substring(0, colon);
+    }
+    return true;
+}
+
+bool HTTPClient::begin(const String& url) {
+    if (!ownClient) ownClient = new WiFiClient();
+    return begin(*ownClient, url);
+}
+
+void HTTPClient::end() {
+    if (connected()) {
+        if (client->available() > 0) client->flush();
+        if (!(reuse && canReuse)) client->stop();
+    }
+    if (ownClient) {
+        ownClient->stop();
+        delete ownClient;
+        ownClient = nullptr;
+    }
+    client = nullptr;
+}
+
+void HTTPClient::collectHeaders(const char* headerKeys[], size_t count) {
+    headers.clear();
+    for (size_t i = 0; i < count; i++) headers.push_back({headerKeys[i], ""});
+}
+
+String HTTPClient::header(const char* name) {
+    for (auto& h : headers) {
+        if (h.key.equalsIgnoreCase(name)) return h.value;
+    }
+    return "";
+}
+
+bool HTTPClient::connect() {
+    if (connected()) {
+        // Reusing the kept-alive socket; anything left over is stale
+        while (client->available() > 0) client->read();
+        return true;
+    }
+    return client && client->connect(host.c_str(), port, connectTimeout);
+}
+
+int HTTPClient::GET() {
+    if (!connect()) return HTTPC_ERROR_CONNECTION_REFUSED;
+
+    String request = String("GET ") + uri + (http10 ? " HTTP/1.0\r\n" : " HTTP/1.1\r\n");
+    request += "Host: " + host + (port != 80 && port != 443 ? ":" + String(port) : String("")) + "\r\n";
+    request += "User-Agent: ESP32HTTPClient\r\n";
+    request += reuse && !http10 ? "Connection: keep-alive\r\n" : "Connection: close\r\n";
+    request += "Accept-Encoding: identity;q=1,chunked;q=0.1,*;q=0\r\n\r\n";
+    if (client->write((const uint8_t*)request.c_str(), request.length()) != request.length()) {
+        return HTTPC_ERROR_SEND_HEADER_FAILED;
+    }
+    return handleHeaderResponse();
+}
+
+int HTTPClient::handleHeaderResponse() {
+    if (!connected()) return HTTPC_ERROR_NOT_CONNECTED;
+
+    canReuse = reuse;
+    size = -1;
+    for (auto& h : headers) h.value = "";
+
+    int code = 0;
+    client->setTimeout(timeout);
+    unsigned long lastData = millis();
+    while (connected()) {
+        if (client->available() <= 0) {
+            if (millis() - lastData > timeout) return HTTPC_ERROR_READ_TIMEOUT;
+            yield();
+            continue;
+        }
+
+        String line = client->readStringUntil('\n');
+        line.trim();
+        lastData = millis();
+
+        if (line.startsWith("HTTP/1.")) {
+            if (canReuse) canReuse = line[7] != '0';
+            code = line.substring(9, line.indexOf(' ', 9)).toInt();
+            continue;
+        }
+        if (line.length() == 0) return code ? code : HTTPC_ERROR_NO_HTTP_SERVER;
+
+        int colon = line.indexOf(':');
+        if (colon < 0) continue;
+        String key = line.substring(0, colon);
+        String value = line.substring(colon + 1);
+        value.trim();
+
+        if (key.equalsIgnoreCase("Content-Length")) size = value.toInt();
+        if (key.equalsIgnoreCase("Connection") && value.indexOf("close") >= 0 && value.indexOf("keep-alive") < 0) canReuse = false;
+        for (auto& h : headers) {
+            if (h.key.equalsIgnoreCase(key)) h.value = value;
+        }
+    }
+    return HTTPC_ERROR_CONNECTION_LOST;
+}
+
+String HTTPClient::getString() {
+    String body;
+    if (!client) return body;
+    int left = size;
+    unsigned long lastData = millis();
+    while (left != 0 && connected() && millis() - lastData <= timeout) {
+        int c = client->read();
+        if (c < 0) {
+            yield();
+            continue;
+        }
+        body += (char)c;
+        lastData = millis();
+        if (left > 0) left--;
+    }
+    return body;
+}
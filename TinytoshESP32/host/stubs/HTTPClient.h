@@ -0,0 +1,67 @@
+#ifndef HOST_HTTPCLIENT_H
+#define HOST_HTTPCLIENT_H
+
+#include <Arduino.h>
+#include <vector>
+#include "WiFiClient.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+#define HTTP_CODE_OK 200
+
+// The subset of the ESP32 core's HTTPClient the firmware uses, with the same
+// connection rules: with setReuse(true) a request goes out on the already
+// connected client, and end() keeps the socket open unless the response was
+// HTTP/1.0 or said "Connection: close".
+class HTTPClient {
+public:
+    ~HTTPClient() { end(); }
+
+    bool begin(WiFiClient& client, const String& url);
+    bool begin(const String& url);
+    void end();
+
+    void setReuse(bool reuse) { this->reuse = reuse; }
+    void useHTTP10(bool http10) { this->http10 = http10; }
+    void setConnectTimeout(int32_t timeoutMs) { connectTimeout = timeoutMs; }
+    void setTimeout(uint16_t timeoutMs) { timeout = timeoutMs; }
+    void collectHeaders(const char* headerKeys[], size_t count);
+
+    int GET();
+
+    String header(const char* name);
+    int getSize() { return size; }
+    WiFiClient& getStream() { return *client; }
+    WiFiClient* getStreamPtr() { return connected() ? client : nullptr; }
+    String getString();
+    bool connected() { return client && (client->available() > 0 || client->connected()); }
+
+private:
+    struct Header {
+        String key;
+        String value;
+    };
+
+    WiFiClient* client = nullptr;
+    WiFiClient* ownClient = nullptr;
+    String host;
+    uint16_t port = 80;
+    String uri;
+    bool reuse = true;
+    bool canReuse = false;
+    bool http10 = false;
+    int32_t connectTimeout = 5000;
+    uint16_t timeout = 5000;
+    int size = -1;
+    std::vector<Header> headers;
+
+    bool connect();
+    int handleHeaderResponse();
+};
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef HOST_HARDWARE_SERIAL_H
+#define HOST_HARDWARE_SERIAL_H
+
+#include <string>
+#include "Stream.h"
+
+// Serial on the host: output goes to stdout (or is captured), input comes
+// from whatever a test queued with hostFeed().
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long baud) { baudRate = baud; }
+    void end() {}
+    void updateBaudRate(unsigned long baud) { baudRate = baud; }
+    unsigned long baud() const { return baudRate; }
+    operator bool() const { return true; }
+
+    int available() override { return rx.size() - rxPos; }
+    int read() override;
+    int peek() override { return rxPos < rx.size() ? (uint8_t)rx[rxPos] : -1; }
+    size_t readBytes(char* buffer, size_t length) override;
+    size_t read(uint8_t* buffer, size_t size) { return readBytes((char*)buffer, size); }
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+    // Harness hooks
+    void hostFeed(const void* data, size_t length);
+    void hostFeed(const char* text);
+    // false drops output instead of printing it (benchmarks)
+    void hostEcho(bool enabled) { echo = enabled; }
+    void hostCapture(bool enabled) { capture = enabled; }
+    std::string hostTakeOutput();
+
+private:
+    unsigned long baudRate = 115200;
+    std::string rx;
+    size_t rxPos = 0;
+    std::string captured;
+    bool echo = true;
+    bool capture = false;
+};
+
+extern HardwareSerial Serial;
+
+#endif
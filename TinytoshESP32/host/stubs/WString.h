@@ -0,0 +1,108 @@
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+#include <cstddef>
+#include <string>
+
+// Host stand-in for the Arduino String: the subset the firmware uses, with
+// the same formatting rules (floats default to 2 decimals, toInt() stops at
+// the first non-digit, indexOf() returns -1).
+class String {
+public:
+    String() {}
+    String(const char* s) : s(s ? s : "") {}
+    String(const std::string& s) : s(s) {}
+    explicit String(char c) : s(1, c) {}
+    String(int value, unsigned char base = 10);
+    String(unsigned int value, unsigned char base = 10);
+    String(long value, unsigned char base = 10);
+    String(unsigned long value, unsigned char base = 10);
+    String(long long value, unsigned char base = 10);
+    String(unsigned long long value, unsigned char base = 10);
+    String(float value, unsigned int decimals = 2);
+    String(double value, unsigned int decimals = 2);
+
+    const char* c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    bool isEmpty() const { return s.empty(); }
+    bool reserve(unsigned int size) { s.reserve(size); return true; }
+
+    char charAt(unsigned int index) const { return index < s.size() ? s[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char& operator[](unsigned int index) { return s[index]; }
+    void setCharAt(unsigned int index, char c) { if (index < s.size()) s[index] = c; }
+
+    bool concat(const String& other) { s += other.s; return true; }
+    bool concat(const char* other) { if (other) s += other; return true; }
+    bool concat(const char* other, unsigned int length) { if (other) s.append(other, length); return true; }
+    bool concat(char c) { s += c; return true; }
+
+    String& operator+=(const String& other) { s += other.s; return *this; }
+    String& operator+=(const char* other) { if (other) s += other; return *this; }
+    String& operator+=(char c) { s += c; return *this; }
+    String& operator+=(int value) { return *this += String(value); }
+    String& operator+=(unsigned int value) { return *this += String(value); }
+    String& operator+=(long value) { return *this += String(value); }
+    String& operator+=(unsigned long value) { return *this += String(value); }
+    String& operator+=(float value) { return *this += String(value); }
+    String& operator+=(double value) { return *this += String(value); }
+
+    bool equals(const String& other) const { return s == other.s; }
+    bool equals(const char* other) const { return s == (other ? other : ""); }
+    bool equalsIgnoreCase(const String& other) const;
+    bool startsWith(const String& prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+    bool endsWith(const String& suffix) const;
+    int compareTo(const String& other) const { return s.compare(other.s); }
+
+    bool operator==(const String& other) const { return s == other.s; }
+    bool operator==(const char* other) const { return equals(other); }
+    bool operator!=(const String& other) const { return s != other.s; }
+    bool operator!=(const char* other) const { return !equals(other); }
+    bool operator<(const String& other) const { return s < other.s; }
+    bool operator>(const String& other) const { return s > other.s; }
+
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String& text, unsigned int from = 0) const;
+    int lastIndexOf(char c) const;
+    int lastIndexOf(const String& text) const;
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+
+    void replace(const String& find, const String& with);
+    void remove(unsigned int index);
+    void remove(unsigned int index, unsigned int count);
+    void toUpperCase();
+    void toLowerCase();
+    void trim();
+
+    long toInt() const;
+    float toFloat() const;
+    double toDouble() const;
+
+    const std::string& str() const { return s; }
+
+private:
+    std::string s;
+};
+
+// The core's concatenation temporary; ArduinoJson's String adapter names it
+class StringSumHelper : public String {
+public:
+    using String::String;
+};
+
+String operator+(const String& a, const String& b);
+String operator+(const String& a, const char* b);
+String operator+(const char* a, const String& b);
+String operator+(const String& a, char b);
+String operator+(const String& a, int b);
+String operator+(const String& a, unsigned int b);
+String operator+(const String& a, long b);
+String operator+(const String& a, unsigned long b);
+String operator+(const String& a, float b);
+String operator+(const String& a, double b);
+
+inline bool operator==(const char* a, const String& b) { return b == a; }
+inline bool operator!=(const char* a, const String& b) { return b != a; }
+
+#endif
@@ -0,0 +1,130 @@
+#include "WiFiClient.h"
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static uint16_t routedPort = 0;
+
+void WiFiClient::hostRouteAll(uint16_t port) { routedPort = port; }
+
+int WiFiClient::hostOpenSocket(const char* host, uint16_t port, int32_t timeoutMs) {
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    if (routedPort) {
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(routedPort);
+    } else {
+        addrinfo hints = {}, *result = nullptr;
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        if (getaddrinfo(host, nullptr, &hints, &result) != 0 || !result) return -1;
+        addr = *(sockaddr_in*)result->ai_addr;
+        addr.sin_port = htons(port);
+        freeaddrinfo(result);
+    }
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    int res = ::connect(fd, (sockaddr*)&addr, sizeof(addr));
+    if (res < 0 && errno == EINPROGRESS) {
+        pollfd pfd = {fd, POLLOUT, 0};
+        int error = 0;
+        socklen_t length = sizeof(error);
+        if (poll(&pfd, 1, timeoutMs) == 1 && getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length) == 0 && error == 0) res = 0;
+    }
+    if (res < 0) {
+        close(fd);
+        return -1;
+    }
+
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    return fd;
+}
+
+int WiFiClient::connect(const char* host, uint16_t port, int32_t timeoutMs) {
+    stop();
+    fd = hostOpenSocket(host, port, timeoutMs);
+    return fd >= 0;
+}
+
+void WiFiClient::stop() {
+    if (fd >= 0) close(fd);
+    fd = -1;
+    eof = false;
+    rxLength = 0;
+    rxPos = 0;
+}
+
+uint8_t WiFiClient::connected() {
+    return fd >= 0 && (!eof || rxPos < rxLength);
+}
+
+bool WiFiClient::fill(bool noticeClose) {
+    if (rxPos < rxLength) return true;
+    if (fd < 0 || eof) return false;
+
+    ssize_t n = recv(fd, rx, sizeof(rx), MSG_DONTWAIT);
+    if (n > 0) {
+        rxLength = n;
+        rxPos = 0;
+        return true;
+    }
+    if ((n == 0 && noticeClose) || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) eof = true;
+    return false;
+}
+
+int WiFiClient::available() {
+    fill(false);
+    return (int)(rxLength - rxPos);
+}
+
+int WiFiClient::read() {
+    if (!fill(true)) return -1;
+    return (uint8_t)rx[rxPos++];
+}
+
+int WiFiClient::read(uint8_t* buffer, size_t size) {
+    if (!fill(true)) return -1;
+    size_t n = std::min(size, rxLength - rxPos);
+    memcpy(buffer, rx + rxPos, n);
+    rxPos += n;
+    return (int)n;
+}
+
+int WiFiClient::peek() {
+    if (!fill(true)) return -1;
+    return (uint8_t)rx[rxPos];
+}
+
+size_t WiFiClient::write(const uint8_t* buffer, size_t size) {
+    if (fd < 0) return 0;
+    size_t sent = 0;
+    while (sent < size) {
+        ssize_t n = send(fd, buffer + sent, size - sent, MSG_NOSIGNAL);
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            pollfd pfd = {fd, POLLOUT, 0};
+            poll(&pfd, 1, 100);
+            continue;
+        }
+        if (n <= 0) {
+            eof = true;
+            break;
+        }
+        sent += n;
+    }
+    return sent;
+}
+
+void WiFiClient::flush() {
+    while (available() > 0) rxPos = rxLength;
+}
@@ -0,0 +1,47 @@
+#ifndef HOST_WIFICLIENT_H
+#define HOST_WIFICLIENT_H
+
+#include <Arduino.h>
+
+// Plain POSIX TCP socket behind the ESP32 WiFiClient API. Like the core's
+// client, a peer close only shows up once read() runs into it: available()
+// and connected() keep reporting a dropped keep-alive socket as usable.
+class WiFiClient : public Stream {
+public:
+    WiFiClient() {}
+    virtual ~WiFiClient() { stop(); }
+    WiFiClient(const WiFiClient&) = delete;
+    WiFiClient& operator=(const WiFiClient&) = delete;
+
+    virtual int connect(const char* host, uint16_t port, int32_t timeoutMs = 3000);
+    virtual uint8_t connected();
+    virtual void stop();
+
+    int available() override;
+    int read() override;
+    virtual int read(uint8_t* buffer, size_t size);
+    int peek() override;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    // The core's flush() discards whatever is buffered for reading
+    void flush() override;
+
+    operator bool() { return connected(); }
+
+    // Harness hook: connect every host to 127.0.0.1:port instead (0 resolves names normally)
+    static void hostRouteAll(uint16_t port);
+    // Harness helper, shared with esp_tls: a connected non-blocking TCP
+    // socket to host (or the routed port), or -1
+    static int hostOpenSocket(const char* host, uint16_t port, int32_t timeoutMs);
+
+private:
+    int fd = -1;
+    bool eof = false;
+    uint8_t rx[1460];
+    size_t rxLength = 0;
+    size_t rxPos = 0;
+
+    bool fill(bool noticeClose);
+};
+
+#endif
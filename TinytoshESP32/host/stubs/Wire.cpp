@@ -0,0 +1,42 @@
+#include "Wire.h"
+
+TwoWire Wire;
+
+void TwoWire::beginTransmission(uint8_t address) {
+    txAddress = address;
+    txLength = 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+    if (txLength >= sizeof(txBuffer)) return 0;
+    txBuffer[txLength++] = data;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t length) {
+    size_t n = 0;
+    while (n < length && write(data[n])) n++;
+    return n;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+    (void)sendStop;
+    bytesSent += txLength + 1;
+    for (const Attachment& a : devices) {
+        if (a.address == txAddress) {
+            a.device->receive(txBuffer, txLength);
+            return 0;
+        }
+    }
+    return 2;   // address NACK, as on the bus
+}
+
+void TwoWire::hostAttach(uint8_t address, WireDevice* device) {
+    for (Attachment& a : devices) {
+        if (a.address == address) {
+            a.device = device;
+            return;
+        }
+    }
+    devices.push_back({address, device});
+}
@@ -0,0 +1,49 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <Arduino.h>
+#include <vector>
+
+// Same transmit buffer as the ESP32 core, so writes are chunked the same way
+#define I2C_BUFFER_LENGTH 128
+
+// Receives each completed transmission addressed to it
+class WireDevice {
+public:
+    virtual ~WireDevice() {}
+    virtual void receive(const uint8_t* data, size_t length) = 0;
+};
+
+class TwoWire {
+public:
+    bool begin() { return true; }
+    bool setClock(uint32_t frequency) { clock = frequency; return true; }
+    uint32_t getClock() const { return clock; }
+
+    void beginTransmission(uint8_t address);
+    size_t write(uint8_t data);
+    size_t write(const uint8_t* data, size_t length);
+    uint8_t endTransmission(bool sendStop = true);
+
+    // Harness hooks
+    void hostAttach(uint8_t address, WireDevice* device);
+    // Bytes on the bus, including the address byte of each transmission
+    uint64_t hostBytesSent() const { return bytesSent; }
+
+private:
+    struct Attachment {
+        uint8_t address;
+        WireDevice* device;
+    };
+
+    uint32_t clock = 100000;
+    uint8_t txAddress = 0;
+    uint8_t txBuffer[I2C_BUFFER_LENGTH];
+    size_t txLength = 0;
+    uint64_t bytesSent = 0;
+    std::vector<Attachment> devices;
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef HOST_ESP_TLS_H
+#define HOST_ESP_TLS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <sys/types.h>
+
+// The slice of ESP-IDF's esp_tls client API the firmware uses, over OpenSSL.
+// Like mbedTLS in IDF 4.4 it stops at TLS 1.2, so session tickets and
+// resumption behave as they would on the device. Certificates are checked
+// against the CA handed to hostTlsTrust() instead of a bundle.
+typedef int esp_err_t;
+#ifndef ESP_OK
+#define ESP_OK 0
+#define ESP_FAIL -1
+#endif
+
+#define CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS 1
+
+#define ESP_TLS_ERR_SSL_WANT_READ -0x6900
+#define ESP_TLS_ERR_SSL_WANT_WRITE -0x6880
+
+struct esp_tls;
+typedef struct esp_tls esp_tls_t;
+struct esp_tls_client_session;
+typedef struct esp_tls_client_session esp_tls_client_session_t;
+
+typedef struct esp_tls_cfg {
+    int timeout_ms;
+    esp_err_t (*crt_bundle_attach)(void* conf);
+    esp_tls_client_session_t* client_session;
+} esp_tls_cfg_t;
+
+esp_tls_t* esp_tls_init(void);
+// 1 once the handshake is done, -1 on failure
+int esp_tls_conn_new_sync(const char* hostname, int hostlen, int port, const esp_tls_cfg_t* cfg, esp_tls_t* tls);
+esp_err_t esp_tls_get_conn_sockfd(esp_tls_t* tls, int* sockfd);
+ssize_t esp_tls_conn_read(esp_tls_t* tls, void* data, size_t datalen);
+ssize_t esp_tls_conn_write(esp_tls_t* tls, const void* data, size_t datalen);
+int esp_tls_conn_destroy(esp_tls_t* tls);
+esp_tls_client_session_t* esp_tls_get_client_session(esp_tls_t* tls);
+void esp_tls_free_client_session(esp_tls_client_session_t* session);
+
+// Harness hook: the PEM CA server certificates must chain to
+void hostTlsTrust(const char* caPem);
+
+#endif
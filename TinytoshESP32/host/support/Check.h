@@ -0,0 +1,33 @@
+#ifndef HOST_CHECK_H
+#define HOST_CHECK_H
+
+#include <cstdio>
+
+// Minimal assertions for the host tests: failures are counted and reported,
+// and checkResult() becomes the test's exit code.
+inline int checkFailures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            checkFailures++; \
+        } \
+    } while (0)
+
+#define CHECK_EQ(actual, expected) \
+    do { \
+        long long a_ = (long long)(actual), e_ = (long long)(expected); \
+        if (a_ != e_) { \
+            fprintf(stderr, "%s:%d: CHECK_EQ failed: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, a_, e_); \
+            checkFailures++; \
+        } \
+    } while (0)
+
+inline int checkResult() {
+    if (checkFailures) fprintf(stderr, "%d check(s) failed\n", checkFailures);
+    else printf("All checks passed\n");
+    return checkFailures ? 1 : 0;
+}
+
+#endif
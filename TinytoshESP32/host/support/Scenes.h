@@ -0,0 +1,132 @@
+#ifndef HOST_SCENES_H
+#define HOST_SCENES_H
+
+#include "structs.h"
+
+// Canned app states covering every screen and its main variants, shared by
+// the golden-frame test and the render benchmark.
+struct Scene {
+    const char* name;
+    int screen;
+    void (*setup)(AppState& state);
+};
+
+inline void sceneTime(AppState& s) { (void)s; }
+inline void sceneTime12NoDate(AppState& s) {
+    s.config.time_format = "12";
+    s.config.date_display = false;
+}
+
+inline void sceneWeather(AppState& s) {
+    s.config.city = "Berlin";
+    s.weather.temp = 21.4;
+    s.weather.apparent_temperature = 20.1;
+    s.weather.humidity = 48;
+    s.weather.wind_speed = 12.3;
+    s.weather.weather_code = 2;
+    s.weather.is_day = true;
+}
+inline void sceneWeatherDecimal(AppState& s) {
+    sceneWeather(s);
+    s.config.round_temps = false;
+    s.weather.temp = -3.6;
+    s.weather.weather_code = 71;
+}
+inline void sceneWeatherEmpty(AppState& s) { (void)s; }
+
+inline void sceneAqi(AppState& s) {
+    s.config.city = "Berlin";
+    s.aqi.aqi = 42;
+    s.aqi.pm25 = 7.8;
+    s.aqi.pm10 = 15.2;
+    s.aqi.no2 = 21.6;
+    s.aqi.status = "Good";
+}
+
+inline void sceneStock(AppState& s) {
+    s.stock.symbol = "AAPL";
+    s.stock.name = "Apple Inc.";
+    s.stock.price = 189.84;
+    s.stock.previous_close = 187.15;
+    s.stock.percent_change = 1.44;
+}
+inline void sceneStockChart(AppState& s) {
+    sceneStock(s);
+    s.config.stock_chart = true;
+    for (int i = 0; i < 78; i++) s.stock.history.push(187.0f + 3.0f * sinf(i / 9.0f) + i * 0.03f);
+}
+
+inline void sceneCrypto(AppState& s) {
+    s.crypto.symbol = "BTC";
+    s.crypto.name = "Bitcoin";
+    s.crypto.price_usd = 67123.45;
+    s.crypto.percent_change_24h = -2.31;
+}
+inline void sceneCryptoChart(AppState& s) {
+    sceneCrypto(s);
+    s.config.crypto_chart = true;
+    for (int i = 0; i < 96; i++) s.crypto.history.push(68700.0f - i * 16.0f + 220.0f * cosf(i / 5.0f));
+}
+
+inline void sceneCurrency(AppState& s) {
+    s.currency.base = "USD";
+    s.currency.target = "EUR";
+    s.currency.rate = 0.9213;
+    s.config.currency_multiplier = 100;
+}
+
+inline void scenePcBars(AppState& s) {
+    s.pc.cpu_percent = 37;
+    s.pc.mem_percent = 62;
+    s.pc.disk_percent = 81;
+    s.pc.net_down_kb = 2300;
+}
+inline void scenePcHosts(AppState& s) {
+    scenePcBars(s);
+    const char* ids[] = {"desk", "laptop", "nas"};
+    for (int i = 0; i < 3; i++) {
+        strlcpy(s.pc_hosts.slots[i].id, ids[i], PC_ID_LEN);
+        s.pc_hosts.slots[i].id_hash = 0x1000 + i;
+    }
+    s.pc_hosts.shown = 1;
+}
+inline void scenePcHistory(AppState& s) {
+    scenePcBars(s);
+    s.config.pc_view = 1;
+    for (int i = 0; i < 128; i++) {
+        s.pc_history.record(40 + 30 * sinf(i / 7.0f), 60 + i / 8.0f, 81, 1500 + 1400 * sinf(i / 3.0f));
+    }
+}
+inline void scenePcEmpty(AppState& s) { (void)s; }
+
+inline void sceneMedia(AppState& s) {
+    s.media.status = "playing";
+    s.media.name = "Across the Universe of Sound";
+    s.media.author = "The Beatles";
+    s.media.album = "Let It Be Naked (Remastered Deluxe Edition)";
+}
+inline void sceneMediaEmpty(AppState& s) { (void)s; }
+
+inline const Scene SCENES[] = {
+    {"time", SCREEN_TIME, sceneTime},
+    {"time_12h_nodate", SCREEN_TIME, sceneTime12NoDate},
+    {"weather", SCREEN_WEATHER, sceneWeather},
+    {"weather_decimal", SCREEN_WEATHER, sceneWeatherDecimal},
+    {"weather_empty", SCREEN_WEATHER, sceneWeatherEmpty},
+    {"aqi", SCREEN_AIR_QUALITY, sceneAqi},
+    {"stock", SCREEN_STOCK, sceneStock},
+    {"stock_chart", SCREEN_STOCK, sceneStockChart},
+    {"crypto", SCREEN_CRYPTO, sceneCrypto},
+    {"crypto_chart", SCREEN_CRYPTO, sceneCryptoChart},
+    {"currency", SCREEN_CURRENCY, sceneCurrency},
+    {"pc_bars", SCREEN_PC_MONITOR, scenePcBars},
+    {"pc_hosts", SCREEN_PC_MONITOR, scenePcHosts},
+    {"pc_history", SCREEN_PC_MONITOR, scenePcHistory},
+    {"pc_empty", SCREEN_PC_MONITOR, scenePcEmpty},
+    {"media", SCREEN_PC_MEDIA, sceneMedia},
+    {"media_empty", SCREEN_PC_MEDIA, sceneMediaEmpty},
+};
+
+inline const int NUM_SCENES = sizeof(SCENES) / sizeof(SCENES[0]);
+
+#endif
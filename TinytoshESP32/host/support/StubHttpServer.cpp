@@ -0,0 +1,268 @@
+#include "StubHttpServer.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cstdio>
+#include <climits>
+#include <netinet/in.h>
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// The test CA and the key every leaf certificate shares, made once per process
+struct Authority {
+    EVP_PKEY* caKey;
+    X509* ca;
+    EVP_PKEY* leafKey;
+    std::string pem;
+};
+
+static void addExtension(X509* cert, X509* issuer, int nid, const char* value) {
+    X509V3_CTX ctx;
+    X509V3_set_ctx_nodb(&ctx);
+    X509V3_set_ctx(&ctx, issuer, cert, nullptr, nullptr, 0);
+    X509_EXTENSION* extension = X509V3_EXT_conf_nid(nullptr, &ctx, nid, value);
+    X509_add_ext(cert, extension, -1);
+    X509_EXTENSION_free(extension);
+}
+
+static X509* makeCertificate(const std::string& name, EVP_PKEY* key, X509* issuer, EVP_PKEY* issuerKey) {
+    static std::atomic<long> serial{1};
+    X509* cert = X509_new();
+    X509_set_version(cert, 2);
+    ASN1_INTEGER_set(X509_get_serialNumber(cert), serial++);
+    X509_gmtime_adj(X509_getm_notBefore(cert), -3600);
+    X509_gmtime_adj(X509_getm_notAfter(cert), 7 * 24 * 3600);
+    X509_set_pubkey(cert, key);
+    X509_NAME_add_entry_by_txt(X509_get_subject_name(cert), "CN", MBSTRING_ASC, (const unsigned char*)name.c_str(), -1, -1, 0);
+    X509_set_issuer_name(cert, X509_get_subject_name(issuer ? issuer : cert));
+    if (issuer) {
+        addExtension(cert, issuer, NID_subject_alt_name, ("DNS:" + name).c_str());
+        addExtension(cert, issuer, NID_basic_constraints, "CA:FALSE");
+    } else {
+        addExtension(cert, cert, NID_basic_constraints, "critical,CA:TRUE");
+        addExtension(cert, cert, NID_key_usage, "critical,keyCertSign");
+    }
+    X509_sign(cert, issuerKey, EVP_sha256());
+    return cert;
+}
+
+static const Authority& authority() {
+    static const Authority instance = [] {
+        Authority a;
+        a.caKey = EVP_EC_gen("P-256");
+        a.ca = makeCertificate("Tinytosh Test CA", a.caKey, nullptr, a.caKey);
+        a.leafKey = EVP_EC_gen("P-256");
+        BIO* bio = BIO_new(BIO_s_mem());
+        PEM_write_bio_X509(bio, a.ca);
+        char* data;
+        long length = BIO_get_mem_data(bio, &data);
+        a.pem.assign(data, length);
+        BIO_free(bio);
+        return a;
+    }();
+    return instance;
+}
+
+std::string StubHttpServer::caPem() { return authority().pem; }
+
+int StubHttpServer::selectCertificate(SSL* ssl, void* arg) {
+    StubHttpServer* server = (StubHttpServer*)arg;
+    const char* name = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+    const Authority& a = authority();
+    X509* cert;
+    {
+        std::lock_guard<std::mutex> guard(server->lock);
+        X509*& issued = server->certificates[name ? name : "localhost"];
+        if (!issued) issued = makeCertificate(name ? name : "localhost", a.leafKey, a.ca, a.caKey);
+        cert = issued;
+    }
+    return SSL_use_certificate(ssl, cert) == 1 && SSL_use_PrivateKey(ssl, a.leafKey) == 1;
+}
+
+void StubHttpServer::setTlsResumption(bool enabled) {
+    if (enabled) {
+        SSL_CTX_clear_options(tlsContext, SSL_OP_NO_TICKET);
+        SSL_CTX_set_session_cache_mode(tlsContext, SSL_SESS_CACHE_SERVER);
+    } else {
+        SSL_CTX_set_options(tlsContext, SSL_OP_NO_TICKET);
+        SSL_CTX_set_session_cache_mode(tlsContext, SSL_SESS_CACHE_OFF);
+        SSL_CTX_flush_sessions(tlsContext, LONG_MAX);
+    }
+}
+
+StubHttpServer::StubHttpServer() {
+    // Both ends write to sockets the other may have closed
+    signal(SIGPIPE, SIG_IGN);
+    tlsContext = SSL_CTX_new(TLS_server_method());
+    SSL_CTX_set_max_proto_version(tlsContext, TLS1_2_VERSION);
+    SSL_CTX_set_options(tlsContext, SSL_OP_IGNORE_UNEXPECTED_EOF);
+    SSL_CTX_set_session_id_context(tlsContext, (const unsigned char*)"stub", 4);
+    SSL_CTX_set_cert_cb(tlsContext, selectCertificate, this);
+
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(listenFd, (sockaddr*)&addr, sizeof(addr));
+    listen(listenFd, 16);
+
+    socklen_t length = sizeof(addr);
+    getsockname(listenFd, (sockaddr*)&addr, &length);
+    listenPort = ntohs(addr.sin_port);
+
+    acceptThread = std::thread(&StubHttpServer::acceptLoop, this);
+}
+
+StubHttpServer::~StubHttpServer() {
+    running = false;
+    acceptThread.join();
+    close(listenFd);
+    dropConnections();
+    for (auto& worker : workers) worker.join();
+    SSL_CTX_free(tlsContext);
+    for (auto& issued : certificates) X509_free(issued.second);
+}
+
+void StubHttpServer::route(const std::string& path, const StubResponse& response) {
+    std::lock_guard<std::mutex> guard(lock);
+    routes[path] = response;
+}
+
+bool StubHttpServer::routeFile(const std::string& path, const std::string& file) {
+    FILE* f = fopen(file.c_str(), "rb");
+    if (!f) return false;
+    StubResponse response;
+    char chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) response.body.append(chunk, n);
+    fclose(f);
+    response.contentType = "text/plain";
+    route(path, response);
+    return true;
+}
+
+std::string StubHttpServer::lastRequestLine() {
+    std::lock_guard<std::mutex> guard(lock);
+    return lastLine;
+}
+
+void StubHttpServer::dropConnections() {
+    std::lock_guard<std::mutex> guard(lock);
+    for (int fd : openFds) shutdown(fd, SHUT_RDWR);
+}
+
+void StubHttpServer::acceptLoop() {
+    while (running) {
+        pollfd pfd = {listenFd, POLLIN, 0};
+        if (poll(&pfd, 1, 20) != 1) continue;
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) continue;
+
+        accepted++;
+        std::lock_guard<std::mutex> guard(lock);
+        openFds.push_back(fd);
+        workers.emplace_back(&StubHttpServer::serve, this, fd);
+    }
+}
+
+std::string StubHttpServer::render(const StubResponse& response) {
+    std::string out = "HTTP/1.1 " + std::to_string(response.status) + (response.status == 200 ? " OK" : " Error") + "\r\n";
+    out += "Content-Type: " + response.contentType + "\r\n";
+    out += response.close ? "Connection: close\r\n" : "Connection: keep-alive\r\n";
+    if (!response.chunked) {
+        out += "Content-Length: " + std::to_string(response.body.size()) + "\r\n\r\n" + response.body;
+        return out;
+    }
+
+    out += "Transfer-Encoding: chunked\r\n\r\n";
+    const size_t CHUNK = 7;
+    char size[16];
+    for (size_t pos = 0; pos < response.body.size(); pos += CHUNK) {
+        size_t n = std::min(CHUNK, response.body.size() - pos);
+        snprintf(size, sizeof(size), "%zx", n);
+        out += size;
+        if (pos == 0) out += ";note=first";
+        out += "\r\n" + response.body.substr(pos, n) + "\r\n";
+    }
+    out += "0\r\nX-Trailer: done\r\n\r\n";
+    return out;
+}
+
+void StubHttpServer::serve(int fd) {
+    std::string pending;
+    char chunk[1024];
+    bool open = true;
+
+    // A ClientHello starts with a handshake record (0x16); anything else is plain HTTP
+    SSL* ssl = nullptr;
+    pollfd first = {fd, POLLIN, 0};
+    while (running && poll(&first, 1, 20) != 1) {}
+    uint8_t type = 0;
+    if (running && recv(fd, &type, 1, MSG_PEEK) == 1 && type == 0x16) {
+        ssl = SSL_new(tlsContext);
+        SSL_set_fd(ssl, fd);
+        if (SSL_accept(ssl) == 1) {
+            handshakes++;
+            if (SSL_session_reused(ssl)) resumed++;
+        } else {
+            ERR_clear_error();
+            open = false;
+        }
+    }
+
+    while (open && running) {
+        size_t headerEnd;
+        while ((headerEnd = pending.find("\r\n\r\n")) == std::string::npos) {
+            pollfd pfd = {fd, POLLIN, 0};
+            if (!(ssl && SSL_pending(ssl) > 0) && poll(&pfd, 1, 20) != 1) {
+                if (!running) break;
+                continue;
+            }
+            ssize_t n = ssl ? SSL_read(ssl, chunk, sizeof(chunk)) : recv(fd, chunk, sizeof(chunk), 0);
+            if (n <= 0) break;
+            pending.append(chunk, n);
+        }
+        if (headerEnd == std::string::npos) break;
+
+        std::string head = pending.substr(0, headerEnd);
+        pending.erase(0, headerEnd + 4);
+        std::string requestLine = head.substr(0, head.find("\r\n"));
+        size_t pathStart = requestLine.find(' ') + 1;
+        std::string path = requestLine.substr(pathStart, requestLine.find(' ', pathStart) - pathStart);
+
+        StubResponse response;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            lastLine = requestLine;
+            auto it = routes.find(path);
+            if (it == routes.end()) it = routes.find(path.substr(0, path.find('?')));
+            if (it != routes.end()) response = it->second;
+            else response = {404, "not found"};
+        }
+        if (head.find("Connection: close") != std::string::npos) response.close = true;
+
+        std::string out = render(response);
+        if (ssl) SSL_write(ssl, out.data(), (int)out.size());
+        else send(fd, out.data(), out.size(), MSG_NOSIGNAL);
+        served++;
+        open = !response.close;
+    }
+
+    if (ssl) {
+        SSL_shutdown(ssl);
+        SSL_free(ssl);
+        ERR_clear_error();
+    }
+    std::lock_guard<std::mutex> guard(lock);
+    openFds.erase(std::remove(openFds.begin(), openFds.end(), fd), openFds.end());
+    close(fd);
+}
@@ -0,0 +1,79 @@
+#ifndef HOST_STUB_HTTP_SERVER_H
+#define HOST_STUB_HTTP_SERVER_H
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef struct ssl_st SSL;
+typedef struct ssl_ctx_st SSL_CTX;
+typedef struct x509_st X509;
+
+// In-process HTTP/1.1 server on 127.0.0.1 for the fetch-path tests. Serves
+// canned responses by path (the Host header is ignored, so every origin can
+// be routed here), keeps connections alive unless told otherwise, and counts
+// accepted connections so tests can tell a reused socket from a new one.
+// A connection that opens with a TLS ClientHello is served over TLS 1.2 with
+// a certificate for the requested name, signed by a test CA (see caPem()),
+// and session tickets on, so tests can count full and resumed handshakes.
+struct StubResponse {
+    int status = 200;
+    std::string body;
+    bool chunked = false;   // chunked transfer encoding, with an extension and a trailer
+    bool close = false;     // "Connection: close" and hang up after the response
+    std::string contentType = "application/json";
+};
+
+class StubHttpServer {
+public:
+    StubHttpServer();
+    ~StubHttpServer();
+
+    uint16_t port() const { return listenPort; }
+    void route(const std::string& path, const StubResponse& response);
+    // Serves a file's contents; returns false if it can't be read
+    bool routeFile(const std::string& path, const std::string& file);
+
+    int connections() const { return accepted; }
+    int requests() const { return served; }
+    std::string lastRequestLine();
+
+    // The CA the TLS certificates chain to, for hostTlsTrust()
+    static std::string caPem();
+    int tlsHandshakes() const { return handshakes; }
+    int tlsResumed() const { return resumed; }
+    // Off: no tickets and no session cache, so every handshake is a full one
+    void setTlsResumption(bool enabled);
+
+    // Closes every open connection from the server side, as a keep-alive
+    // timeout would
+    void dropConnections();
+
+private:
+    int listenFd = -1;
+    uint16_t listenPort = 0;
+    std::atomic<bool> running{true};
+    std::atomic<int> accepted{0};
+    std::atomic<int> served{0};
+    std::atomic<int> handshakes{0};
+    std::atomic<int> resumed{0};
+    SSL_CTX* tlsContext = nullptr;
+    std::thread acceptThread;
+
+    std::mutex lock;
+    std::map<std::string, StubResponse> routes;
+    std::vector<int> openFds;
+    std::vector<std::thread> workers;
+    std::map<std::string, X509*> certificates;
+    std::string lastLine;
+
+    void acceptLoop();
+    void serve(int fd);
+    static int selectCertificate(SSL* ssl, void* arg);
+    std::string render(const StubResponse& response);
+};
+
+#endif
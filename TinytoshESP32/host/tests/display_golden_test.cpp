@@ -0,0 +1,126 @@
+// Renders every scene through DisplayService and compares the frame with
+// golden/<scene>.pbm. Run with --update (or UPDATE_GOLDEN=1) to rewrite the
+// goldens after an intended change; on a mismatch the rendered frame is left
+// next to the test binary as <scene>.actual.pbm for viewing.
+#include <string>
+#include <vector>
+
+#include "Check.h"
+#include "Scenes.h"
+#include "DisplayService.h"
+
+static bool updateGolden = false;
+
+static std::vector<uint8_t> readFile(const std::string& path) {
+    std::vector<uint8_t> data;
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return data;
+    uint8_t chunk[512];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) data.insert(data.end(), chunk, chunk + n);
+    fclose(f);
+    return data;
+}
+
+static void writeFile(const std::string& path, const uint8_t* data, size_t length) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) {
+        fprintf(stderr, "Can't write %s\n", path.c_str());
+        return;
+    }
+    fwrite(data, 1, length, f);
+    fclose(f);
+}
+
+static int differingPixels(const std::vector<uint8_t>& a, const uint8_t* b, size_t length) {
+    int count = 0;
+    for (size_t i = 10; i < length && i < a.size(); i++) count += __builtin_popcount(a[i] ^ b[i]);
+    return count;
+}
+
+static void checkFrame(DisplayService& ds, const char* name) {
+    uint8_t pbm[DisplayService::FRAME_PBM_SIZE];
+    size_t length = ds.encodeFramePBM(pbm, sizeof(pbm));
+    CHECK_EQ(length, DisplayService::FRAME_PBM_SIZE);
+
+    std::string path = std::string(GOLDEN_DIR) + "/" + name + ".pbm";
+    if (updateGolden) {
+        writeFile(path, pbm, length);
+        printf("updated %s\n", path.c_str());
+        return;
+    }
+
+    std::vector<uint8_t> golden = readFile(path);
+    if (golden.size() != length || memcmp(golden.data(), pbm, length) != 0) {
+        std::string actual = std::string(name) + ".actual.pbm";
+        writeFile(actual, pbm, length);
+        fprintf(stderr, "%s: frame differs from %s (%d pixels%s); wrote %s\n", name, path.c_str(),
+                differingPixels(golden, pbm, length), golden.empty() ? ", golden missing" : "", actual.c_str());
+        checkFailures++;
+    }
+}
+
+// After a flush the modelled GDDRAM has to match the buffer, whichever page spans were sent
+static void checkPanel(DisplayService& ds, const char* name) {
+    if (memcmp(ds.display.hostPanel(), ds.display.getBuffer(), DisplayService::FRAME_BUFFER_SIZE) != 0) {
+        fprintf(stderr, "%s: panel out of sync with the buffer after flush()\n", name);
+        checkFailures++;
+    }
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--update") == 0) updateGolden = true;
+    }
+    if (getenv("UPDATE_GOLDEN")) updateGolden = true;
+    Serial.hostEcho(false);
+
+    DisplayService ds(128, 64, -1);
+    TimeService timeService;
+    ds.begin();
+    checkPanel(ds, "begin");
+
+    uint8_t weatherFrame[DisplayService::FRAME_BUFFER_SIZE];
+    for (const Scene& scene : SCENES) {
+        AppState state;
+        scene.setup(state);
+        ds.display.clearDisplay();
+        ds.drawScreen(scene.screen, state, timeService);
+        ds.flush();
+        checkFrame(ds, scene.name);
+        checkPanel(ds, scene.name);
+        if (strcmp(scene.name, "weather") == 0) memcpy(weatherFrame, ds.display.getBuffer(), sizeof(weatherFrame));
+    }
+
+    ds.showOLEDStatus({"Connecting to", "Tinytosh-Setup", "\n", "192.168.4.1"});
+    checkFrame(ds, "status");
+    checkPanel(ds, "status");
+
+    // An unchanged screen is skipped, a config change redraws it
+    AppState state;
+    sceneWeather(state);
+    CHECK(ds.drawScreenIfChanged(SCREEN_WEATHER, state, timeService));
+    CHECK(!ds.drawScreenIfChanged(SCREEN_WEATHER, state, timeService));
+    state.config.version++;
+    CHECK(ds.drawScreenIfChanged(SCREEN_WEATHER, state, timeService));
+
+    // Every transition ends on the next screen's frame, one frame per TRANSITION_FRAME_MS
+    for (int effect = ANIM_SLIDE_HORIZONTAL; effect < ANIM_RANDOM; effect++) {
+        state.config.anim_mask = 1 << effect;
+        ds.startTransition(SCREEN_TIME, SCREEN_WEATHER, state, timeService);
+        CHECK(ds.isAnimating());
+
+        int frames = 0;
+        while (ds.isAnimating() && frames < 100) {
+            ds.stepTransition();
+            hostAdvanceClock(DisplayService::TRANSITION_FRAME_MS);
+            frames++;
+        }
+        CHECK(!ds.isAnimating());
+        CHECK(frames > 2);
+        checkPanel(ds, "transition");
+        CHECK(memcmp(ds.display.getBuffer(), weatherFrame, sizeof(weatherFrame)) == 0);
+    }
+
+    return checkResult();
+}
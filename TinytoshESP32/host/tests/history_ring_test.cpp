@@ -0,0 +1,62 @@
+// HistoryRing's running min/max against a rescan of the held samples, for
+// the series that used to force a rescan on every push (flat, rising,
+// falling) and for noise, across wrap-around and clear().
+#include <vector>
+
+#include "Check.h"
+#include "HistoryRing.h"
+
+template <typename T, int N>
+static void checkSeries(const char* name, const std::vector<int>& values) {
+    HistoryRing<T, N> ring;
+    int mismatches = 0;
+    for (size_t i = 0; i < values.size(); i++) {
+        ring.push((T)values[i]);
+
+        T lo = ring.at(0), hi = ring.at(0);
+        for (int k = 1; k < ring.count; k++) {
+            lo = std::min(lo, ring.at(k));
+            hi = std::max(hi, ring.at(k));
+        }
+        if (ring.min != lo || ring.max != hi) mismatches++;
+    }
+    if (mismatches) fprintf(stderr, "%s: %d pushes with a stale min/max\n", name, mismatches);
+    CHECK_EQ(mismatches, 0);
+    CHECK_EQ(ring.count, std::min((int)values.size(), N));
+    CHECK_EQ(ring.at(ring.count - 1), (T)values.back());
+}
+
+int main() {
+    const int PUSHES = 1000;
+    std::vector<int> flat(PUSHES, 42), zero(PUSHES, 0), rising, falling, noise, steps;
+    for (int i = 0; i < PUSHES; i++) {
+        rising.push_back(i % 256);
+        falling.push_back(255 - i % 256);
+        noise.push_back((int)random(0, 101));
+        steps.push_back((i / 37) % 2 ? 90 : 10);
+    }
+
+    checkSeries<uint8_t, 128>("flat", flat);
+    checkSeries<uint8_t, 128>("zero", zero);
+    checkSeries<uint8_t, 128>("rising", rising);
+    checkSeries<uint8_t, 128>("falling", falling);
+    checkSeries<uint8_t, 128>("noise", noise);
+    checkSeries<uint8_t, 128>("steps", steps);
+    checkSeries<uint8_t, 128>("short", std::vector<int>{5, 3, 9});
+
+    std::vector<int> prices;
+    for (int i = 0; i < PUSHES; i++) prices.push_back((int)random(-3000, 3001));
+    checkSeries<int16_t, 96>("prices", prices);
+
+    // clear() starts over: nothing from before it counts
+    HistoryRing<uint8_t, 8> ring;
+    for (int i = 0; i < 20; i++) ring.push(100);
+    ring.clear();
+    ring.push(7);
+    ring.push(3);
+    CHECK_EQ(ring.count, 2);
+    CHECK_EQ(ring.min, 3);
+    CHECK_EQ(ring.max, 7);
+
+    return checkResult();
+}
@@ -0,0 +1,163 @@
+// HttpConnectionPool against an in-process HTTP server: keep-alive reuse for
+// back-to-back requests to one origin, body framing (Content-Length and
+// chunked), draining vs dropping a partly read body, retry on a socket the
+// server closed, LRU eviction, and the idle close between refresh cycles.
+// https:// origins run over TLS: certificates are checked, and a new
+// connection to an origin resumes the session of the last one, including
+// across the idle close.
+#include "Check.h"
+#include "StubHttpServer.h"
+#include "HttpConnectionPool.h"
+
+static const uint16_t TIMEOUT_MS = 300;
+
+// Reads up to the end of the body; readString() would sit out the stream timeout
+static String readBody(HttpBodyStream& body) {
+    String text;
+    unsigned long start = millis();
+    while (!body.finished() && millis() - start < TIMEOUT_MS) {
+        int c = body.read();
+        if (c >= 0) text += (char)c;
+    }
+    return text;
+}
+
+static String fetch(HttpConnectionPool& pool, const String& url, int& code) {
+    HTTPClient& http = pool.get(url, TIMEOUT_MS, code);
+    String body;
+    if (code == HTTP_CODE_OK) body = readBody(pool.body(http));
+    pool.release(http);
+    return body;
+}
+
+static void nextCycle(HttpConnectionPool& pool) {
+    hostAdvanceClock(15 * 60 * 1000UL);
+    pool.closeIdle();
+}
+
+int main() {
+    Serial.hostEcho(false);
+    StubHttpServer server;
+    WiFiClient::hostRouteAll(server.port());
+
+    server.route("/q/l/", {200, "AAPL,189.84"});
+    server.route("/q/d/l/", {200, "Date,Time,Close\n2026-03-13,15:30:00,189.1\n"});
+    server.route("/chunked", {200, "{\"price\":67123.45,\"change\":-2.31}", true});
+    server.route("/big", {200, std::string(4096, 'x')});
+    server.route("/small", {200, std::string(300, 'y')});
+    server.route("/close", {200, "bye", false, true});
+
+    HttpConnectionPool pool;
+    int code = 0;
+
+    // The server's certificate doesn't chain to a trusted CA: no connection
+    CHECK(fetch(pool, "https://stooq.com/q/l/?s=aapl.us", code) == "");
+    CHECK(code < 0);
+    CHECK_EQ(server.tlsHandshakes(), 0);
+    hostTlsTrust(StubHttpServer::caPem().c_str());
+    int connectionsBefore = server.connections();
+
+    // Quote then intraday history from the same origin share one socket
+    CHECK(fetch(pool, "https://stooq.com/q/l/?s=aapl.us", code) == "AAPL,189.84");
+    CHECK_EQ(code, 200);
+    CHECK(fetch(pool, "https://stooq.com/q/d/l/?s=aapl.us&i=5", code).startsWith("Date,Time,Close"));
+    CHECK_EQ(server.connections() - connectionsBefore, 1);
+    CHECK_EQ(server.requests(), 2);
+    CHECK_EQ(server.tlsHandshakes(), 1);
+    CHECK_EQ(server.tlsResumed(), 0);
+
+    // Chunked bodies are decoded, extensions and trailers skipped, and the socket stays usable
+    CHECK(fetch(pool, "https://stooq.com/chunked", code) == "{\"price\":67123.45,\"change\":-2.31}");
+    CHECK(fetch(pool, "https://stooq.com/q/l/", code) == "AAPL,189.84");
+    CHECK_EQ(server.connections() - connectionsBefore, 1);
+
+    // A short unread tail is drained and the socket reused; a long one drops it
+    {
+        HTTPClient& http = pool.get("https://stooq.com/small", TIMEOUT_MS, code);
+        CHECK_EQ(http.getSize(), 300);
+        pool.release(http);
+    }
+    CHECK(fetch(pool, "https://stooq.com/q/l/", code) == "AAPL,189.84");
+    CHECK_EQ(server.connections() - connectionsBefore, 1);
+    {
+        HTTPClient& http = pool.get("https://stooq.com/big", TIMEOUT_MS, code);
+        uint8_t head[16];
+        CHECK_EQ(pool.body(http).readBytes(head, sizeof(head)), sizeof(head));
+        pool.release(http);
+    }
+    CHECK(fetch(pool, "https://stooq.com/q/l/", code) == "AAPL,189.84");
+    CHECK_EQ(server.connections() - connectionsBefore, 2);
+
+    // The server timed the kept-alive socket out: one retry on a fresh connection
+    server.dropConnections();
+    delay(20);
+    CHECK(fetch(pool, "https://stooq.com/q/l/", code) == "AAPL,189.84");
+    CHECK_EQ(code, 200);
+    CHECK_EQ(server.connections() - connectionsBefore, 3);
+    CHECK_EQ(server.tlsResumed(), 2);
+
+    // "Connection: close" is honoured
+    CHECK(fetch(pool, "https://stooq.com/close", code) == "bye");
+    CHECK(fetch(pool, "https://stooq.com/q/l/", code) == "AAPL,189.84");
+    CHECK_EQ(server.connections() - connectionsBefore, 4);
+    CHECK_EQ(server.tlsHandshakes(), 4);
+    CHECK_EQ(server.tlsResumed(), 3);
+
+    // Two slots: a third origin evicts the least recently used one. Sessions
+    // are kept per origin: a first visit is a full handshake
+    fetch(pool, "https://api.open-meteo.com/q/l/", code);
+    CHECK_EQ(server.connections() - connectionsBefore, 5);
+    CHECK_EQ(server.tlsResumed(), 3);
+    fetch(pool, "https://stooq.com/q/l/", code);
+    CHECK_EQ(server.connections() - connectionsBefore, 5);
+    fetch(pool, "https://api.coingecko.com/q/l/", code);
+    CHECK_EQ(server.connections() - connectionsBefore, 6);
+    fetch(pool, "https://api.open-meteo.com/q/l/", code);
+    CHECK_EQ(server.connections() - connectionsBefore, 7);
+    CHECK_EQ(server.tlsHandshakes(), 7);
+    CHECK_EQ(server.tlsResumed(), 4);
+
+    // No socket survives to the next refresh cycle (>= 15 min): idle slots
+    // are closed, but the next cycle's handshakes resume the saved sessions
+    pool.closeIdle();
+    fetch(pool, "https://api.open-meteo.com/q/l/", code);
+    CHECK_EQ(server.connections() - connectionsBefore, 7);
+    hostAdvanceClock(15 * 60 * 1000UL);
+    pool.closeIdle();
+    fetch(pool, "https://api.open-meteo.com/q/l/", code);
+    CHECK_EQ(server.connections() - connectionsBefore, 8);
+    CHECK_EQ(server.tlsResumed(), 5);
+    fetch(pool, "https://stooq.com/q/l/", code);
+    fetch(pool, "https://api.coingecko.com/q/l/", code);
+    CHECK_EQ(server.connections() - connectionsBefore, 10);
+    CHECK_EQ(server.tlsHandshakes(), 10);
+    CHECK_EQ(server.tlsResumed(), 7);
+
+    // A server that stops taking sessions handshakes in full and the fresh
+    // session replaces the stale one; once it takes them again, the next
+    // session it issues is resumed
+    server.setTlsResumption(false);
+    nextCycle(pool);
+    CHECK(fetch(pool, "https://stooq.com/q/l/", code) == "AAPL,189.84");
+    CHECK_EQ(server.tlsResumed(), 7);
+    server.setTlsResumption(true);
+    nextCycle(pool);
+    CHECK(fetch(pool, "https://stooq.com/q/l/", code) == "AAPL,189.84");
+    CHECK_EQ(server.tlsResumed(), 7);
+    nextCycle(pool);
+    CHECK(fetch(pool, "https://stooq.com/q/l/", code) == "AAPL,189.84");
+    CHECK_EQ(server.tlsResumed(), 8);
+
+    // Plain http:// stays plain
+    int handshakes = server.tlsHandshakes();
+    CHECK(fetch(pool, "http://worldtimeapi.org/q/l/", code) == "AAPL,189.84");
+    CHECK_EQ(server.tlsHandshakes(), handshakes);
+
+    // A refused connection surfaces as an error code, not a hang
+    WiFiClient::hostRouteAll(1);
+    HTTPClient& http = pool.get("http://ip-api.com/json/", TIMEOUT_MS, code);
+    CHECK(code < 0);
+    pool.release(http);
+
+    return checkResult();
+}
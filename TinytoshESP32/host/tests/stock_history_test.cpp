@@ -0,0 +1,109 @@
+// StockService intraday history against the in-process HTTP server: the stooq
+// 5-minute CSV streamed into PriceSeries (latest session only, CRLF rows, no
+// final newline), as plain and chunked bodies, on the quote's socket. A failed
+// or empty history keeps the previous series; a new symbol clears it. The
+// parser itself is also fed byte by byte and past the ring's length.
+#include <fstream>
+#include <sstream>
+
+#include "Check.h"
+#include "StubHttpServer.h"
+#include "StockService.h"
+
+static const uint16_t TIMEOUT_MS = 500;
+static const std::string HISTORY_CSV = std::string(FIXTURE_DIR) + "/stooq-history-aapl.csv";
+
+// Latest session in the fixture: 78 five-minute rows from 188.40 to 193.77
+static const int SESSION_ROWS = 78;
+static const float SESSION_OPEN = 188.40f;
+static const float SESSION_CLOSE = 193.77f;
+
+static std::string readFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::stringstream text;
+    text << in.rdbuf();
+    return text.str();
+}
+
+static int16_t bps(float price, float reference) {
+    return (int16_t)roundf((price / reference - 1.0f) * 10000.0f);
+}
+
+static void checkSession(const PriceSeries& series) {
+    CHECK_EQ(series.ring.count, SESSION_ROWS);
+    CHECK(fabsf(series.reference - SESSION_OPEN) < 0.001f);
+    CHECK_EQ(series.ring.at(0), 0);
+    CHECK_EQ(series.ring.at(series.ring.count - 1), bps(SESSION_CLOSE, SESSION_OPEN));
+}
+
+int main() {
+    Serial.hostEcho(false);
+    StubHttpServer server;
+    WiFiClient::hostRouteAll(server.port());
+    CHECK(server.routeFile("/q/l/", std::string(FIXTURE_DIR) + "/stooq-quote.json"));
+    CHECK(server.routeFile("/q/d/l/", HISTORY_CSV));
+
+    HttpConnectionPool pool;
+    StockService stocks(pool);
+    StockData data;
+
+    // Quote plus history, back to back on one socket
+    CHECK(stocks.fetchStock("AAPL", data, TIMEOUT_MS, true));
+    CHECK(data.symbol == "AAPL");
+    CHECK(server.lastRequestLine().find("/q/d/l/?s=aapl.us&i=5 ") != std::string::npos);
+    CHECK_EQ(server.connections(), 1);
+    checkSession(data.history);
+
+    // The same CSV with chunked transfer encoding
+    StubResponse chunked;
+    chunked.body = readFile(HISTORY_CSV);
+    chunked.chunked = true;
+    chunked.contentType = "text/csv";
+    server.route("/q/d/l/", chunked);
+    data.history.clear();
+    CHECK(stocks.fetchStock("AAPL", data, TIMEOUT_MS, true));
+    checkSession(data.history);
+
+    // A failed or empty history leaves the quote updated and the old series alone
+    uint32_t version = data.version;
+    server.route("/q/d/l/", {404, "Not Found", false, false, "text/plain"});
+    CHECK(stocks.fetchStock("AAPL", data, TIMEOUT_MS, true));
+    CHECK(data.version != version);
+    checkSession(data.history);
+
+    server.route("/q/d/l/", {200, "No data", false, false, "text/csv"});
+    CHECK(stocks.fetchStock("AAPL", data, TIMEOUT_MS, true));
+    checkSession(data.history);
+
+    // Another symbol's series never mixes with the old one
+    CHECK(stocks.fetchStock("MSFT", data, TIMEOUT_MS, false));
+    CHECK(data.symbol == "MSFT");
+    CHECK_EQ(data.history.ring.count, 0);
+
+    // Byte-at-a-time input parses the same as whole reads
+    {
+        std::string csv = readFile(HISTORY_CSV);
+        PriceSeries series;
+        StockService::HistoryCsvParser parser(series);
+        for (char c : csv) parser.feed((const uint8_t*)&c, 1);
+        parser.finish();
+        CHECK_EQ(parser.rows(), 6 + SESSION_ROWS);
+        checkSession(series);
+    }
+
+    // Past the ring's length only the newest rows stay; an over-long line is skipped whole
+    {
+        PriceSeries series;
+        StockService::HistoryCsvParser parser(series);
+        std::string csv = "Date,Time,Close\n";
+        for (int i = 0; i < 120; i++) csv += "2026-03-13,10:00:00," + std::to_string(100 + i) + "\n";
+        csv += "2026-03-13,16:00:00," + std::string(200, '9') + "\n";
+        parser.feed((const uint8_t*)csv.data(), csv.size());
+        parser.finish();
+        CHECK_EQ(parser.rows(), 120);
+        CHECK_EQ(series.ring.count, PriceSeries::Ring::LENGTH);
+        CHECK_EQ(series.ring.at(series.ring.count - 1), bps(219, 100));
+    }
+
+    return checkResult();
+}
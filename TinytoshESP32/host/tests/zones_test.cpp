@@ -0,0 +1,69 @@
+// Resolves every IANA name in the timezone table through findPosixTimezone().
+// Where the host has tzdata, each POSIX rule must also give the same UTC
+// offsets as the system zone in winter and summer, which catches a table that
+// tz/build_zones.py generated from older tzdata than the host's.
+#include <string>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "Check.h"
+#include "zones.h"
+
+static const size_t EXPECTED_ZONES = 194;
+
+static long utcOffset(const char* tz, time_t at) {
+    setenv("TZ", tz, 1);
+    tzset();
+    struct tm local;
+    localtime_r(&at, &local);
+    return local.tm_gmtoff;
+}
+
+int main() {
+    CHECK_EQ(TIMEZONE_COUNT, EXPECTED_ZONES);
+
+    for (size_t i = 0; i < TIMEZONE_COUNT; i++) {
+        // Look up through a copy so a match can't come from pointer identity
+        std::string name = TIMEZONES[i].iana;
+        const char* posix = findPosixTimezone(name.c_str());
+        if (!posix || strcmp(posix, TIMEZONES[i].posix) != 0) {
+            fprintf(stderr, "%s: resolved to %s, expected %s\n", name.c_str(), posix ? posix : "(null)", TIMEZONES[i].posix);
+            checkFailures++;
+        }
+        CHECK(strlen(TIMEZONES[i].posix) > 0);
+
+        // Near misses must not resolve
+        CHECK(findPosixTimezone((name + "x").c_str()) == nullptr);
+        CHECK(findPosixTimezone(name.substr(0, name.size() - 1).c_str()) == nullptr);
+    }
+    CHECK(findPosixTimezone("") == nullptr);
+    CHECK(findPosixTimezone("europe/berlin") == nullptr);
+    CHECK(findPosixTimezone("Mars/Olympus_Mons") == nullptr);
+    CHECK(strcmp(findPosixTimezone("Europe/Berlin"), "CET-1CEST,M3.5.0,M10.5.0/3") == 0);
+
+    // Cross-check offsets against the host's tzdata, mid-January and mid-July 2026
+    struct stat st;
+    if (stat("/usr/share/zoneinfo", &st) == 0) {
+        const time_t DATES[] = {1768478400, 1784116800};
+        int compared = 0;
+        for (size_t i = 0; i < TIMEZONE_COUNT; i++) {
+            std::string zoneFile = std::string("/usr/share/zoneinfo/") + TIMEZONES[i].iana;
+            if (stat(zoneFile.c_str(), &st) != 0) continue;
+            compared++;
+            for (time_t at : DATES) {
+                long expected = utcOffset((std::string(":") + TIMEZONES[i].iana).c_str(), at);
+                long actual = utcOffset(TIMEZONES[i].posix, at);
+                if (actual != expected) {
+                    fprintf(stderr, "%s: %s gives UTC%+ld s at %ld, tzdata says %+ld s\n", TIMEZONES[i].iana,
+                            TIMEZONES[i].posix, actual, (long)at, expected);
+                    checkFailures++;
+                }
+            }
+        }
+        printf("Compared %d zones with the host tzdata\n", compared);
+    } else {
+        printf("No tzdata on this host; skipped the offset cross-check\n");
+    }
+
+    return checkResult();
+}
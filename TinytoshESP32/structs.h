@@ -2,6 +2,8 @@
 #define STRUCTS_H
 
 #include <Arduino.h>
+#include "PcHistory.h"
+#include "PriceSeries.h"
 
 enum ScreenType {
   SCREEN_TIME,
@@ -40,7 +42,6 @@ struct Config {
   // Network Data
   String device_id = "";
   String ip_address = "";
-  String active_pc_id = "";
 
   // Global Settings
   bool auto_detect = true;
@@ -68,6 +69,8 @@ struct Config {
 
   bool hide_empty_pc = false;
   bool hide_empty_media = false;
+  int pc_multi = 0; // 0: Rotate through PCs, 1: Combine all PCs
+  int pc_view = 0; // 0: Usage bars, 1-3: History over ~2 min / ~20 min / ~2 h
 
   // Weather & AQI Settings
   bool round_temps = true; 
@@ -81,8 +84,10 @@ struct Config {
   int currency_multiplier = 1;
   String stock_symbol = "GOOG";
   bool crypto_fn = true;
+  bool crypto_chart = false;
   bool currency_fn = true;
   bool stock_fn = true;
+  bool stock_chart = false;
 
   // Animation Settings
   uint16_t anim_mask = 62;
@@ -92,6 +97,9 @@ struct Config {
   String night_start = "22:00";
   String night_end = "06:00";
   int night_action = 1; // 0: None, 1: Dim, 2: Off
+
+  // Bumped whenever any setting above changes
+  unsigned long version = 0;
 };
 
 struct WeatherData {
@@ -102,6 +110,7 @@ struct WeatherData {
   int weather_code = -1; 
   bool is_day = NAN;
   String update_time = "N/A";
+  unsigned long version = 0;
 };
 
 struct AirQualityData {
@@ -110,6 +119,7 @@ struct AirQualityData {
   float pm10 = NAN;
   float no2 = NAN;
   String status = "N/A";
+  unsigned long version = 0;
 };
 
 struct StockData {
@@ -118,7 +128,9 @@ struct StockData {
   float price;
   float previous_close;
   float percent_change;
+  PriceSeries history;    // 5-minute closes of the latest session, when stock_chart is on
   bool updated = false;
+  unsigned long version = 0;
 };
 
 struct CryptoData {
@@ -126,7 +138,9 @@ struct CryptoData {
   String symbol;
   float price_usd;
   float percent_change_24h;
+  PriceSeries history;    // one price per fetch
   bool updated = false;
+  unsigned long version = 0;
 };
 
 struct CurrencyData {
@@ -135,6 +149,7 @@ struct CurrencyData {
   float rate;
   String date;
   bool updated = false;
+  unsigned long version = 0;
 };
 
 struct PcStats {
@@ -143,6 +158,25 @@ struct PcStats {
   float disk_percent;
   float net_down_kb;
   unsigned long last_update = 0;
+  unsigned long version = 0;
+};
+
+// One PC feeding telemetry. Slots are reused LRU-first once all are taken.
+const int MAX_PC_HOSTS = 4;
+const int PC_ID_LEN = 32;
+
+struct PcHost {
+  char id[PC_ID_LEN] = "";
+  uint32_t id_hash = 0;   // 0 marks a free slot
+  PcStats stats = {0.0, 0.0, 0.0, 0.0};
+};
+
+struct PcHosts {
+  PcHost slots[MAX_PC_HOSTS];
+  int shown = -1;               // slot on screen while rotating
+  unsigned long rotated_at = 0;
+  uint32_t media_owner = 0;     // id_hash of the PC the media screen follows
+  unsigned long version = 0;    // bumped when a PC joins or leaves
 };
 
 struct PcMedia {
@@ -151,6 +185,7 @@ struct PcMedia {
   String author;
   String album;
   unsigned long last_update = 0;
+  unsigned long version = 0;
 };
 
 struct StockOption {
@@ -312,7 +347,9 @@ struct AppState {
   CryptoData crypto;
   CurrencyData currency;
   StockData stock;
-  PcStats pc;
+  PcStats pc;          // what the PC screen shows: one host, or all of them combined
+  PcHosts pc_hosts;
+  PcHistory pc_history;  // all PCs combined, sampled once a second while any is connected
   PcMedia media;
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""Regenerates ../zones.cpp from tzdata.
+
+Each zone listed in zones.txt is read from a compiled zoneinfo tree (TZif
+version 2 or later) and its POSIX rule taken from the footer, the rule tzdata
+itself uses past the last listed transition. Run it after editing zones.txt or
+when tzdata changes rules, and commit the regenerated table:
+
+    python3 TinytoshESP32/tz/build_zones.py [zoneinfo-dir]
+
+The directory defaults to /usr/share/zoneinfo. host/tests/zones_test.cpp
+cross-checks the table against the host's tzdata.
+"""
+
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ZONE_LIST = os.path.join(HERE, "zones.txt")
+OUTPUT = os.path.join(HERE, "..", "zones.cpp")
+DEFAULT_ZONEINFO = "/usr/share/zoneinfo"
+
+LOOKUP = """
+constexpr size_t TIMEZONE_COUNT = sizeof(TIMEZONES) / sizeof(TIMEZONES[0]);
+
+static constexpr int compareZoneNames(const char* a, const char* b) {
+  while (*a && *a == *b) { a++; b++; }
+  return (unsigned char)*a - (unsigned char)*b;
+}
+
+static constexpr bool timezonesSorted() {
+  for (size_t i = 1; i < TIMEZONE_COUNT; i++) {
+    if (compareZoneNames(TIMEZONES[i - 1].iana, TIMEZONES[i].iana) >= 0) return false;
+  }
+  return true;
+}
+
+static_assert(timezonesSorted(), "TIMEZONES must be strictly sorted by IANA name");
+
+const char* findPosixTimezone(const char* iana) {
+  size_t lo = 0, hi = TIMEZONE_COUNT;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    int cmp = strcmp(TIMEZONES[mid].iana, iana);
+    if (cmp == 0) return TIMEZONES[mid].posix;
+    if (cmp < 0) lo = mid + 1;
+    else hi = mid;
+  }
+  return nullptr;
+}
+"""
+
+
+def read_zone_list():
+    zones = []
+    with open(ZONE_LIST, encoding="utf-8") as f:
+        for line in f:
+            line = line.strip()
+            if line and not line.startswith("#"):
+                zones.append(line)
+    if len(set(zones)) != len(zones):
+        raise SystemExit("zones.txt: duplicate zone")
+    return sorted(zones)
+
+
+def tzdata_version(zoneinfo):
+    try:
+        with open(os.path.join(zoneinfo, "tzdata.zi"), encoding="utf-8") as f:
+            first = f.readline().split()
+        if first[:2] == ["#", "version"]:
+            return first[2]
+    except (OSError, IndexError):
+        pass
+    return "(unknown version)"
+
+
+def posix_rule(zoneinfo, zone):
+    """Returns the footer of a TZif file: the POSIX TZ string between the last two newlines."""
+    path = os.path.join(zoneinfo, zone)
+    try:
+        with open(path, "rb") as f:
+            data = f.read()
+    except OSError:
+        raise SystemExit("%s: not found in %s" % (zone, zoneinfo))
+    if data[:4] != b"TZif" or data[4:5] < b"2":
+        raise SystemExit("%s: not a TZif version 2+ file" % path)
+    footer = data.rstrip(b"\n").rsplit(b"\n", 1)[-1].decode("ascii")
+    if not footer or '"' in footer or "\\" in footer:
+        raise SystemExit("%s: no usable POSIX rule in the footer" % path)
+    return footer
+
+
+def main():
+    zoneinfo = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_ZONEINFO
+    zones = read_zone_list()
+    width = max(len(zone) for zone in zones) + 4
+
+    out = [
+        "// Generated by tz/build_zones.py from tzdata %s and tz/zones.txt. Do not edit." % tzdata_version(zoneinfo),
+        '#include "zones.h"',
+        "",
+        "// Sorted by IANA name (byte order) so lookups can binary search; the",
+        "// static_assert below rejects an out-of-order or duplicate entry at build time.",
+        "constexpr TimezoneEntry TIMEZONES[] = {",
+    ]
+    entries = ['  {%s"%s"}' % (('"%s",' % zone).ljust(width), posix_rule(zoneinfo, zone)) for zone in zones]
+    out.append(",\n".join(entries))
+    out.append("};")
+
+    with open(OUTPUT, "w", newline="\n") as f:
+        f.write("\n".join(out) + "\n" + LOOKUP)
+    print("Wrote %s (%d zones)" % (os.path.normpath(OUTPUT), len(zones)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,311 @@
+// The page is a static asset; every value in it is filled in from /update and /events
+let formDirty = false;
+function weatherIcon(code) {
+  if (code === 0) return '☀️';
+  if (code >= 1 && code <= 3) return '🌤️';
+  if (code <= 48) return '🌫️';
+  if (code <= 55) return '🌧️';
+  if (code <= 65) return '☔';
+  if (code <= 75) return '❄️';
+  if (code <= 86) return '🌨️';
+  if (code <= 99) return '🌩️';
+  return '❓';
+}
+function updateVisibility(){
+  var pairs = [['autoDetect','manualFields',true], ['nightMode','nightFields',false], ['showTime', 'timeContent',false], ['showWeather','weatherContent',false], ['showPc','pcContent',false], ['showCrypto','cryptoContent',false], ['showCurrency','currencyContent',false], ['showStock','stockContent',false], ['showAQI','aqiContent',false], ['showMedia','mediaContent',false]];
+  pairs.forEach(p => {
+    var ch = document.getElementById(p[0]); if(!ch) return;
+    var target = document.getElementById(p[1]);
+    var shouldHide = p[2] ? ch.checked : !ch.checked;
+    target.className = shouldHide ? 'collapsible hidden' : 'collapsible';
+    target.querySelectorAll('input, select').forEach(el => el.disabled = shouldHide);
+  });
+  var ac = document.getElementById('autoCycle');
+  var si = document.getElementById('screenIntInput');
+  if(ac && si) si.disabled = !ac.checked;
+}
+['autoDetect', 'nightMode', 'showTime', 'showWeather', 'showPc', 'showCrypto', 'showCurrency', 'showStock', 'showAQI', 'showMedia', 'autoCycle'].forEach(id => { var el=document.getElementById(id); if(el) el.addEventListener('change', updateVisibility); });
+updateVisibility();
+
+// Handle "None" Checkbox Logic
+function toggleNone() {
+  const noneBox = document.getElementById('animNone');
+  const others = document.querySelectorAll('.anim-chk');
+  others.forEach(cb => {
+    cb.disabled = noneBox.checked;
+    if(noneBox.checked) cb.checked = false;
+    cb.parentElement.style.opacity = noneBox.checked ? '0.5' : '1';
+  });
+}
+function checkSafetyNet() {
+  if(!document.getElementById('animNone').checked) {
+    let count = 0;
+    document.querySelectorAll('.anim-chk').forEach(cb => { if(cb.checked) count++; });
+    if(count === 0) {
+      document.getElementById('animNone').checked = true;
+      toggleNone();
+    }
+  }
+}
+const nb = document.getElementById('animNone');
+if(nb) nb.addEventListener('change', toggleNone);
+document.querySelectorAll('.anim-chk').forEach(cb => {
+  cb.addEventListener('change', checkSafetyNet);
+});
+toggleNone();
+const list = document.getElementById('sortable-list');
+const orderInput = document.getElementById('screenOrderInput');
+
+// Function to sync DOM list with checkbox states using the data-target attribute
+function syncScreenOrder() {
+  const items = [...list.querySelectorAll('.sortable-item')];
+  let enabled = [], disabled = [];
+  items.forEach(item => {
+    const targetId = item.getAttribute('data-target');
+    const cb = document.getElementById(targetId);
+    if (cb && cb.checked) {
+      item.classList.remove('disabled'); item.setAttribute('draggable', 'true'); enabled.push(item);
+    } else {
+      item.classList.add('disabled'); item.removeAttribute('draggable'); disabled.push(item);
+    }
+  });
+  list.innerHTML = '';
+  enabled.forEach(el => list.appendChild(el));
+  disabled.forEach(el => list.appendChild(el));
+  updateOrderValue();
+}
+function reorderPhysicalPanels(orderCsv) {
+  const container = document.getElementById('dynamic-panels-container');
+  if (!container || !orderCsv) return;
+  const orderArr = orderCsv.split(',');
+  orderArr.forEach(id => {
+    const panel = document.getElementById('panel-' + id);
+    if (panel) container.appendChild(panel);
+  });
+}
+function updateOrderValue() {
+  const items = [...list.querySelectorAll('.sortable-item')];
+  orderInput.value = items.map(item => item.getAttribute('data-id')).join(',');
+  reorderPhysicalPanels(orderInput.value);
+}
+
+// Hook Checkboxes to the sync function
+const panelCheckboxes = ['showTime', 'showWeather', 'showAQI', 'showCrypto', 'showCurrency', 'showStock', 'showPc', 'showMedia'];
+panelCheckboxes.forEach(id => {
+  const el = document.getElementById(id);
+  if (el) el.addEventListener('change', syncScreenOrder);
+});
+
+// Universal Drag & Touch Logic
+function getDragAfterEl(y) {
+  return [...list.querySelectorAll('.sortable-item:not(.dragging):not(.disabled)')].reduce((closest, child) => {
+    const box = child.getBoundingClientRect();
+    const offset = y - box.top - box.height / 2;
+    if (offset < 0 && offset > closest.offset) return { offset: offset, element: child };
+    else return closest;
+  }, { offset: Number.NEGATIVE_INFINITY }).element;
+}
+function moveItem(y) {
+  const draggable = document.querySelector('.dragging');
+  if (!draggable) return;
+  const afterEl = getDragAfterEl(y);
+  if (afterEl == null) {
+    const firstDis = list.querySelector('.disabled');
+    if (firstDis) list.insertBefore(draggable, firstDis);
+    else list.appendChild(draggable);
+  } else { list.insertBefore(draggable, afterEl); }
+}
+
+// Standard Mouse Events (PC)
+list.addEventListener('dragstart', e => { if (e.target.classList.contains('disabled')) { e.preventDefault(); return; } e.target.classList.add('dragging'); });
+list.addEventListener('dragend', e => { e.target.classList.remove('dragging'); updateOrderValue(); formDirty = true; });
+list.addEventListener('dragover', e => { e.preventDefault(); moveItem(e.clientY); });
+
+// Touch Events (Mobile)
+list.addEventListener('touchstart', e => {
+  const item = e.target.closest('.sortable-item');
+  if (!item || item.classList.contains('disabled')) return;
+  item.classList.add('dragging');
+}, {passive: false});
+list.addEventListener('touchmove', e => {
+  if (!document.querySelector('.dragging')) return;
+  e.preventDefault();
+  moveItem(e.touches[0].clientY);
+}, {passive: false});
+list.addEventListener('touchend', e => {
+  const dragging = document.querySelector('.dragging');
+  if (dragging) { dragging.classList.remove('dragging'); updateOrderValue(); formDirty = true; }
+});
+syncScreenOrder();
+
+// Mask Calculator
+document.querySelector('form').addEventListener('submit', function(e) {
+  let mask = 0;
+  document.querySelectorAll('.anim-chk').forEach(cb => {
+    if(cb.checked) mask += parseInt(cb.value);
+  });
+  document.getElementById('finalMask').value = mask;
+});
+formDirty = false;
+document.querySelector('form').addEventListener('input', () => formDirty = true);
+document.querySelector('form').addEventListener('change', () => formDirty = true);
+function applyUpdate(d) {
+  const set = (id, val, html=false) => { const el = document.getElementById(id); if(el) { if(html) el.innerHTML = val; else el.innerText = val; return true; } return false; };
+  const hide = (id, state) => { const el = document.getElementById(id); if(el) el.classList.toggle('hidden', state); };
+  const setVal = (name, val) => { const el = document.querySelector('[name="'+name+'"]'); if(el && document.activeElement !== el) el.value = val; };
+  const setCb = (id, val, byName=false) => { const el = byName ? document.querySelector('[name="'+id+'"]') : document.getElementById(id); if(el) el.checked = (val === 1 || val === true || val === '1'); };
+  const setRadio = (name, val) => { const el = document.querySelector('[name="'+name+'"][value="'+val+'"]'); if(el) el.checked = true; };
+  if (d.refresh_min !== undefined && !formDirty) {
+    setVal('refresh_min', d.refresh_min);
+    setCb('autoCycle', d.auto_cycle);
+    setVal('screen_int', d.screen_int);
+    setRadio('time_format', d.time_format);
+    setCb('autoDetect', d.auto_detect);
+    setVal('city', d.city);
+    setVal('latitude', d.latitude);
+    setVal('longitude', d.longitude);
+    setVal('timezone', d.timezone);
+    setCb('nightMode', d.night_mode);
+    setVal('night_start', d.night_start);
+    setVal('night_end', d.night_end);
+    setVal('night_action', d.night_action);
+    setCb('showTime', d.show_time);
+    setCb('date_display', d.date_display, true);
+    setCb('showWeather', d.show_weather);
+    setRadio('temp_unit', d.temp_unit);
+    setCb('round_temps', d.round_temps, true);
+    setCb('showAQI', d.show_aqi);
+    setRadio('aqi_type', d.aqi_type);
+    setCb('showPc', d.show_pc);
+    setCb('showStock', d.show_stock);
+    setVal('stock_symbol', d.stock_symbol);
+    setCb('stock_fn', d.stock_fn, true);
+    setCb('stock_chart', d.stock_chart, true);
+    setCb('showCrypto', d.show_crypto);
+    setVal('crypto_id', d.crypto_id);
+    setCb('crypto_fn', d.crypto_fn, true);
+    setCb('crypto_chart', d.crypto_chart, true);
+    setCb('showCurrency', d.show_currency);
+    setVal('currency_base', d.currency_base);
+    setVal('currency_target', d.currency_target);
+    setVal('currency_multiplier', d.currency_multiplier);
+    setCb('currency_fn', d.currency_fn, true);
+    setCb('showMedia', d.show_media);
+    setCb('hide_empty_pc', d.hide_empty_pc, true);
+    setCb('hide_empty_media', d.hide_empty_media, true);
+    setVal('pc_multi', d.pc_multi);
+    setVal('pc_view', d.pc_view);
+    const mask = d.anim_mask;
+    document.querySelectorAll('.anim-chk').forEach(cb => { cb.checked = (mask & parseInt(cb.value)) !== 0; });
+    const noneBox = document.getElementById('animNone');
+    if (noneBox) { noneBox.checked = (mask === 0); toggleNone(); }
+    if (d.screen_order && !document.querySelector('.dragging')) {
+      const orderArr = d.screen_order.split(',');
+      const list = document.getElementById('sortable-list');
+      if (list) {
+        const items = [...list.querySelectorAll('.sortable-item')];
+        orderArr.forEach(id => { const item = items.find(el => el.getAttribute('data-id') === id); if(item) list.appendChild(item); });
+        updateOrderValue();
+      }
+    }
+    updateVisibility();
+    syncScreenOrder();
+    formDirty = false;
+    // Saving before the settings arrived would have sent an empty form
+    document.getElementById('saveButton').disabled = false;
+  }
+
+// Live Data Render Block
+  if (d.device_id !== undefined) set('device-id', d.device_id);
+  if (d.ip_address !== undefined) set('ip-address', 'IP: ' + d.ip_address);
+  if (d.city !== undefined) set('location-info', '📍 ' + d.city + ' (' + d.timezone + ')');
+  set('time-display', d.time);
+  set('preview-time', d.time);
+  set('preview-date', d.date);
+  if (d.temp !== undefined && d.temp !== 'nan') {
+    set('value-temp', d.temp + ' °' + d.temp_unit);
+    set('icon-temp', weatherIcon(d.weather_code));
+    hide('weather-no-data', true); hide('weather-grid', false);
+    set('value-feels', d.apparent_temperature + ' °' + d.temp_unit);
+    set('value-hum', d.humidity + '%');
+    set('value-wind', d.wind_speed + ' km/h');
+    set('weather-upd', 'Last Update: ' + d.update_time);
+  }
+  if (d.aqi !== undefined && d.aqi !== 'nan') {
+    set('value-aqi', d.aqi);
+    hide('aqi-no-data', true); hide('aqi-grid', false);
+    const aqiLabel = document.querySelector('#value-aqi + .tile-label'); if(aqiLabel) aqiLabel.innerText = d.aqi_status + ' Index';
+    set('value-pm25', d.pm25 + ' <small>µg</small>', true);
+    set('value-pm10', d.pm10 + ' <small>µg</small>', true);
+    set('value-no2', d.no2 + ' <small>µg</small>', true);
+    set('aqi-upd', 'Last Update: ' + d.update_time);
+  }
+  if (d.pc_cpu !== undefined && d.pc_cpu !== '0.00' && d.pc_cpu !== '0') {
+    set('pc-cpu', Math.round(parseFloat(d.pc_cpu)) + '%');
+    hide('pc-no-data', true); hide('pc-grid', false);
+    set('pc-net', Math.round(parseFloat(d.pc_net)) + ' KB/s');
+    set('pc-ram', Math.round(parseFloat(d.pc_ram)) + '%');
+    set('pc-disk', Math.round(parseFloat(d.pc_disk)) + '%');
+  }
+  if (d.crypto_price !== undefined && d.crypto_price !== 'nan') {
+    set('crypto-price', d.crypto_price + '$');
+    hide('crypto-no-data', true); hide('crypto-grid', false);
+    set('crypto-sym', d.crypto_symbol + ' Price');
+    set('crypto-change', d.crypto_change + '%');
+    set('crypto-trend-icon', parseFloat(d.crypto_change) >= 0 ? '📈' : '📉');
+    set('crypto-upd', 'Last Update: ' + d.update_time);
+  }
+  if (d.currency_base_text !== undefined) {
+    set('currency-base-val', d.currency_base_text);
+    hide('currency-no-data', true); hide('currency-grid', false);
+    set('currency-target-val', d.currency_target_text);
+    set('currency-upd', 'Last Update: ' + d.update_time);
+  }
+  if (d.stock_price !== undefined && d.stock_price !== 'nan') {
+    set('stock-price', '$' + d.stock_price);
+    hide('stock-no-data', true); hide('stock-grid', false);
+    set('stock-change', d.stock_change + '%');
+    set('stock-trend-icon', parseFloat(d.stock_change) >= 0 ? '📈' : '📉');
+    set('stock-sym', d.stock_symbol + ' Price');
+    set('stock-upd', 'Last Update: ' + d.update_time);
+  }
+  if (d.media_status !== undefined) {
+    let s = d.media_status || 'stopped';
+    set('web-media-status', s.charAt(0).toUpperCase() + s.slice(1));
+    set('web-media-name', d.media_name || 'No Media');
+    set('web-media-author', d.media_author || 'Unknown');
+    set('web-media-album', d.media_album || 'Unknown');
+  }
+  if (d.pc_status !== undefined) set('pc-link-status', d.pc_status);
+}
+// The device sends only keys changed since our cursor (null = removed); a new boot id means it rebooted and sent everything
+let deviceState = {};
+let deviceRev = null;
+let deviceBoot = null;
+function mergeUpdate(d, full) {
+  if (full || d.boot !== deviceBoot) deviceState = {};
+  Object.keys(d).forEach(k => { if (d[k] === null) delete deviceState[k]; else deviceState[k] = d[k]; });
+  deviceRev = d.rev;
+  deviceBoot = d.boot;
+  applyUpdate(deviceState);
+}
+function updateData() {
+  fetch(deviceRev === null ? '/update' : '/update?since=' + deviceRev + '&boot=' + deviceBoot)
+    .then(r => r.status === 304 ? null : r.json())
+    .then(d => { if (d) mergeUpdate(d, false); })
+    .catch(e => console.log('Sync error:', e));
+}
+
+// Live updates are pushed over /events; polling only runs while the stream is down
+let pollTimer = null;
+function startPolling() { if (!pollTimer) pollTimer = setInterval(updateData, 15000); }
+function stopPolling() { if (pollTimer) { clearInterval(pollTimer); pollTimer = null; } }
+if (window.EventSource) {
+  const events = new EventSource('/events');
+  events.addEventListener('state', e => { stopPolling(); mergeUpdate(JSON.parse(e.data), true); });
+  events.addEventListener('delta', e => mergeUpdate(JSON.parse(e.data), false));
+  events.onerror = () => startPolling();
+} else {
+  startPolling();
+}
+updateData();
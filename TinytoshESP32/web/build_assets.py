@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""Regenerates ../web_assets.h from the files in this folder.
+
+Each asset is gzipped (level 9, fixed mtime so the output is reproducible) and
+embedded in flash together with an ETag derived from its content. index.html is
+a template: {{NAME}} fields are filled with the other assets' ETags and with
+<option> lists built from the firmware's tables (zones.cpp, structs.h), so the
+page needs no rendering on the device. Run it after editing anything in web/
+or those tables and commit the regenerated header:
+
+    python3 TinytoshESP32/web/build_assets.py
+"""
+
+import gzip
+import hashlib
+import html
+import os
+import re
+
+# Linked as ?v=<etag>, so those URLs never change content and are cached for good;
+# the page itself keeps its URL and is revalidated against its ETag instead
+IMMUTABLE = "public, max-age=31536000, immutable"
+REVALIDATE = "no-cache"
+
+# In dependency order: a template may only use the ETags of assets above it
+ASSETS = [
+    ("/app.css", "app.css", "text/css", IMMUTABLE),
+    ("/app.js", "app.js", "application/javascript", IMMUTABLE),
+    ("/", "index.html", "text/html", REVALIDATE),
+]
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+FIRMWARE = os.path.join(HERE, "..")
+OUTPUT = os.path.join(FIRMWARE, "web_assets.h")
+
+
+def read_table(filename, name):
+    """Returns the initializer of `name[] = { ... };` in a firmware source file."""
+    with open(os.path.join(FIRMWARE, filename), encoding="utf-8") as f:
+        source = f.read()
+    match = re.search(r"\b%s\[\] = \{(.*?)\n\};" % name, source, re.S)
+    if not match:
+        raise SystemExit("%s: table %s not found" % (filename, name))
+    # Comments would otherwise match as entries
+    return re.sub(r"//[^\n]*", "", match.group(1))
+
+
+def options(pairs):
+    return "\n".join("<option value='%s'>%s</option>" % (html.escape(v), html.escape(t)) for v, t in pairs)
+
+
+def template_fields():
+    zones = re.findall(r'\{"([^"]+)",\s*"', read_table("zones.cpp", "TIMEZONES"))
+    stocks = re.findall(r'\{"([^"]+)",\s*"([^"]+)"\}', read_table("structs.h", "topStocks"))
+    coins = re.findall(r'\{(\d+),\s*"([^"]+)"\}', read_table("structs.h", "topCoins"))
+    currencies = re.findall(r'\{"([^"]+)",\s*"[^"]*"\}', read_table("structs.h", "allCurrencies"))
+    return {
+        "TIMEZONE_OPTIONS": options((z, z) for z in zones),
+        "STOCK_OPTIONS": options((ticker, "%s - %s" % (name, ticker)) for name, ticker in stocks),
+        "COIN_OPTIONS": options(coins),
+        "CURRENCY_OPTIONS": options((code, code[:3].upper()) for code in currencies),
+    }
+
+
+def fill_template(text, fields, filename):
+    def field(match):
+        if match.group(1) not in fields:
+            raise SystemExit("%s: unknown field {{%s}}" % (filename, match.group(1)))
+        return fields[match.group(1)]
+    return re.sub(r"\{\{(\w+)\}\}", field, text)
+
+
+def c_bytes(data, indent="    ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%02x" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    out = [
+        "// Generated by web/build_assets.py from the files in web/. Do not edit.",
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "struct WebAsset {",
+        "    const char* path;",
+        "    const char* contentType;",
+        "    const char* etag;",
+        "    const char* cacheControl;",
+        "    const uint8_t* data;   // gzip-compressed body",
+        "    size_t length;",
+        "};",
+        "",
+    ]
+
+    entries = []
+    fields = template_fields()
+    for path, filename, content_type, cache_control in ASSETS:
+        with open(os.path.join(HERE, filename), "rb") as f:
+            raw = f.read()
+        if filename.endswith(".html"):
+            raw = fill_template(raw.decode("utf-8"), fields, filename).encode("utf-8")
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha1(raw).hexdigest()[:16]
+        symbol = "ASSET_" + filename.replace(".", "_").upper()
+
+        out.append("// %s: %d bytes, %d gzipped" % (filename, len(raw), len(packed)))
+        out.append("static const uint8_t %s[] PROGMEM = {" % symbol)
+        out.append(c_bytes(packed))
+        out.append("};")
+        out.append("")
+        entries.append('    { "%s", "%s", "\\"%s\\"", "%s", %s, sizeof(%s) },' % (path, content_type, etag, cache_control, symbol, symbol))
+        out.append('#define %s_ETAG "%s"' % (symbol, etag))
+        out.append("")
+        fields[filename.replace(".", "_").upper() + "_ETAG"] = etag
+
+    out.append("static const WebAsset WEB_ASSETS[] = {")
+    out.extend(entries)
+    out.append("};")
+    out.append("static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);")
+    out.append("")
+    out.append("#endif")
+    out.append("")
+
+    with open(OUTPUT, "w", newline="\n") as f:
+        f.write("\n".join(out))
+    print("Wrote %s" % os.path.normpath(OUTPUT))
+
+
+if __name__ == "__main__":
+    main()
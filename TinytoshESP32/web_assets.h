@@ -0,0 +1,974 @@
+// Generated by web/build_assets.py from the files in web/. Do not edit.
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+    const char* path;
+    const char* contentType;
+    const char* etag;
+    const char* cacheControl;
+    const uint8_t* data;   // gzip-compressed body
+    size_t length;
+};
+
+// app.css: 6187 bytes, 1953 gzipped
+static const uint8_t ASSET_APP_CSS[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58, 0x6b, 0x6f, 0xeb, 0xb8,
+    0x11, 0xfd, 0x9e, 0x5f, 0xc1, 0xfa, 0x62, 0x9b, 0xe4, 0xd6, 0xb2, 0x25, 0xdb, 0x72, 0x1c, 0xfb,
+    0xe6, 0x62, 0xdb, 0x7b, 0xf7, 0x05, 0x74, 0x81, 0xa2, 0xd9, 0xdd, 0x2f, 0x45, 0x3f, 0x50, 0x12,
+    0x25, 0x13, 0xa1, 0x44, 0x81, 0xa2, 0xe2, 0x64, 0x83, 0xfc, 0xf7, 0x9d, 0xa1, 0x28, 0x59, 0x2f,
+    0xe7, 0xd1, 0x2d, 0x8c, 0x3c, 0x4c, 0x51, 0x9c, 0xe1, 0x99, 0x33, 0x67, 0x86, 0x9c, 0x7f, 0x24,
+    0x5f, 0x6e, 0x6f, 0xc9, 0x6f, 0x54, 0x71, 0x1a, 0x08, 0x56, 0x90, 0x8f, 0xf3, 0xb3, 0xad, 0x92,
+    0x52, 0x93, 0x27, 0xe2, 0x38, 0x41, 0xb2, 0x25, 0x1f, 0xdc, 0xd8, 0xbb, 0x5a, 0xd0, 0x1d, 0x7c,
+    0x0d, 0xa9, 0x8a, 0x60, 0xc0, 0x63, 0x8b, 0xeb, 0x65, 0x80, 0x03, 0x34, 0x0c, 0x59, 0xa6, 0x61,
+    0x68, 0x19, 0x6c, 0x16, 0xf1, 0x1a, 0x87, 0x34, 0x7b, 0xc0, 0x81, 0xd8, 0x8b, 0xfd, 0xf8, 0xba,
+    0x1e, 0x70, 0xd2, 0x52, 0x33, 0x7c, 0xf5, 0x7a, 0x45, 0x61, 0x2a, 0x0e, 0x07, 0x52, 0x45, 0x4c,
+    0xe1, 0xab, 0xcb, 0x95, 0xe7, 0xfb, 0x3b, 0xf2, 0x7c, 0x76, 0x36, 0xff, 0x48, 0x7e, 0x10, 0x32,
+    0xa0, 0x82, 0xfc, 0x43, 0x46, 0x8f, 0xe4, 0xaf, 0xe4, 0x8b, 0xcc, 0x34, 0xe5, 0x19, 0x53, 0xe4,
+    0x56, 0x3f, 0x5a, 0xef, 0x3e, 0x82, 0x67, 0x81, 0x7c, 0x70, 0x0a, 0xfe, 0x3b, 0xcf, 0xc0, 0xbf,
+    0x6a, 0x21, 0x58, 0xef, 0x01, 0xd7, 0xd8, 0xeb, 0x54, 0x4c, 0x61, 0x0c, 0x5e, 0x7f, 0x22, 0x29,
+    0x55, 0x09, 0xcf, 0xb6, 0xc4, 0xdd, 0x91, 0x9c, 0x46, 0x91, 0x99, 0xee, 0xe2, 0x2c, 0xfb, 0x3c,
+    0x86, 0xe5, 0x9d, 0x98, 0xa6, 0x5c, 0x3c, 0x6e, 0xc9, 0xf9, 0x2d, 0x4b, 0x24, 0x23, 0xbf, 0xfe,
+    0x74, 0x3e, 0x25, 0xbf, 0xd0, 0xbd, 0x4c, 0xe9, 0x94, 0xfc, 0xc0, 0x32, 0x76, 0x0f, 0x7f, 0x7f,
+    0x63, 0x2a, 0xa2, 0x19, 0xfc, 0x53, 0xd0, 0xac, 0x70, 0x0a, 0xa6, 0x78, 0xbc, 0x23, 0x01, 0x0d,
+    0xef, 0x12, 0x25, 0xcb, 0x2c, 0x72, 0x42, 0x29, 0x24, 0xec, 0xe5, 0x9e, 0xaa, 0x0b, 0x04, 0xed,
+    0x72, 0x47, 0x3a, 0x23, 0x08, 0xc1, 0x65, 0xcb, 0x87, 0x85, 0x9b, 0x83, 0xb3, 0x02, 0x36, 0xe6,
+    0xec, 0x19, 0x4f, 0xf6, 0x00, 0x98, 0x37, 0x5b, 0xa3, 0x63, 0xb3, 0xb0, 0xd9, 0x31, 0xba, 0xff,
+    0xe0, 0x1c, 0x78, 0xa4, 0xf7, 0x5b, 0xb2, 0x71, 0xcd, 0x2b, 0xcd, 0x86, 0x08, 0x2d, 0xb5, 0xac,
+    0x31, 0xfb, 0x91, 0x51, 0x40, 0x00, 0xe0, 0xfa, 0x85, 0xa7, 0x8c, 0x7c, 0xe5, 0x45, 0x2e, 0xe8,
+    0x23, 0x42, 0x35, 0xa3, 0x79, 0x0e, 0x16, 0xcc, 0xd3, 0xa7, 0xda, 0x3c, 0x20, 0xa5, 0xb5, 0x4c,
+    0x6b, 0x2f, 0x0c, 0x06, 0x80, 0x25, 0x83, 0x81, 0x99, 0xaf, 0x58, 0xda, 0xf3, 0xbd, 0x0a, 0xf1,
+    0xa5, 0x9d, 0x78, 0xb0, 0xee, 0x5e, 0xb9, 0x80, 0xa3, 0x89, 0x2c, 0x15, 0x3c, 0x01, 0x8f, 0x70,
+    0x12, 0x53, 0xe8, 0xd1, 0x07, 0x0d, 0x5e, 0x38, 0x91, 0xf5, 0xe2, 0x69, 0x74, 0xd6, 0x18, 0x3a,
+    0x2d, 0x47, 0x56, 0xd6, 0x91, 0x8e, 0xc9, 0x0d, 0x9a, 0x14, 0x4c, 0xc3, 0x02, 0x4e, 0x91, 0xd3,
+    0xd0, 0x20, 0xe9, 0x2c, 0x72, 0x13, 0xf6, 0x0f, 0x42, 0x86, 0x54, 0x73, 0x99, 0x39, 0x3c, 0x8b,
+    0xe5, 0x09, 0xab, 0x15, 0x7a, 0x8e, 0x96, 0x39, 0x20, 0x88, 0xef, 0x0d, 0xdc, 0xa8, 0x78, 0xda,
+    0xdf, 0xec, 0xca, 0x75, 0x6b, 0xa8, 0x7f, 0x8a, 0x60, 0x2d, 0xae, 0x1f, 0x81, 0xa0, 0x0f, 0x06,
+    0x61, 0x6e, 0x07, 0x90, 0x7f, 0x6f, 0x30, 0xeb, 0xf9, 0x68, 0xb7, 0x21, 0x82, 0x67, 0xdc, 0x3f,
+    0x12, 0x69, 0x4b, 0x54, 0x12, 0xd0, 0x0b, 0x77, 0x6a, 0x3e, 0x33, 0xcf, 0x07, 0x57, 0x2c, 0xbf,
+    0x15, 0x8d, 0x78, 0x59, 0x00, 0x0c, 0xe6, 0x0d, 0x9b, 0x3c, 0x5e, 0xfe, 0x40, 0x0a, 0x29, 0x78,
+    0x54, 0x53, 0xcf, 0x8c, 0x5f, 0x1a, 0x26, 0xf1, 0xc8, 0x6c, 0x09, 0x9c, 0x7a, 0x57, 0x3c, 0xb5,
+    0x02, 0x8a, 0xc7, 0x52, 0x01, 0x41, 0xca, 0x3c, 0x67, 0x2a, 0xa4, 0x05, 0xdb, 0x75, 0x33, 0x25,
+    0x95, 0x99, 0xc4, 0x08, 0xb0, 0x4e, 0xd0, 0xbc, 0x99, 0x67, 0x82, 0x66, 0xb7, 0xdb, 0xb0, 0xac,
+    0x0a, 0xd0, 0x8c, 0xe7, 0xb5, 0x3b, 0xad, 0x77, 0xdc, 0xd9, 0xf5, 0x90, 0x71, 0xc3, 0x40, 0x8c,
+    0x18, 0xee, 0x59, 0xf1, 0xad, 0x95, 0x42, 0x53, 0x5d, 0x16, 0x4e, 0x40, 0xa3, 0x84, 0x9d, 0x08,
+    0x47, 0xc7, 0xfc, 0x66, 0x84, 0x68, 0xeb, 0x57, 0xb0, 0xe8, 0x73, 0xd0, 0x6b, 0xd2, 0x68, 0xc4,
+    0x4f, 0xa0, 0x66, 0x1e, 0x3a, 0x90, 0xea, 0x77, 0x4e, 0xe5, 0xdb, 0x31, 0x1e, 0x1f, 0x3c, 0x37,
+    0xb8, 0xde, 0x78, 0x35, 0xb5, 0xfe, 0x45, 0x33, 0x26, 0x0a, 0x93, 0xc5, 0xa8, 0x74, 0x17, 0x5f,
+    0x40, 0x6c, 0x2b, 0xd9, 0xbb, 0x34, 0x4c, 0xcb, 0xf1, 0x39, 0x6a, 0x5f, 0x8b, 0x2d, 0x15, 0x60,
+    0x28, 0xcb, 0x1d, 0x79, 0xf1, 0x8f, 0x1c, 0x69, 0x78, 0x63, 0xa9, 0xf6, 0x1a, 0x71, 0xfa, 0xd1,
+    0x5b, 0x59, 0x60, 0x2b, 0x15, 0x71, 0xc6, 0x9c, 0x30, 0x94, 0xf5, 0xaf, 0xa7, 0xc4, 0x5b, 0xba,
+    0x53, 0x78, 0x63, 0x3d, 0x05, 0x60, 0xdd, 0x23, 0x75, 0x87, 0xd6, 0x1a, 0x0e, 0x3e, 0xdb, 0x6d,
+    0x39, 0x90, 0x42, 0x82, 0x35, 0x8a, 0x6d, 0x53, 0xf4, 0x45, 0x25, 0x6a, 0x48, 0x77, 0x85, 0x01,
+    0x84, 0x85, 0x22, 0x5a, 0xec, 0x03, 0x09, 0x50, 0x38, 0x89, 0x02, 0x4b, 0x4f, 0xc4, 0x4a, 0xd0,
+    0x96, 0xe0, 0xf7, 0x9d, 0xf9, 0x0d, 0xdc, 0x4a, 0x61, 0x4c, 0x33, 0x54, 0xec, 0x32, 0xcd, 0x00,
+    0x17, 0xc5, 0x72, 0x46, 0xf5, 0xc5, 0x02, 0xdc, 0x8f, 0x11, 0x80, 0x84, 0x36, 0x69, 0xda, 0x76,
+    0xa6, 0x12, 0xcb, 0xa1, 0x99, 0xcf, 0x60, 0xe6, 0x1e, 0x1d, 0x87, 0x89, 0x56, 0xab, 0x8d, 0x58,
+    0xcc, 0x34, 0x37, 0x1b, 0x1a, 0x00, 0xe5, 0xf9, 0x80, 0xd1, 0x72, 0x4a, 0x56, 0x0b, 0x84, 0x69,
+    0xd5, 0x43, 0x09, 0x57, 0x67, 0x83, 0xa0, 0xf4, 0x0a, 0x47, 0x3f, 0xb2, 0x66, 0x70, 0x5c, 0x8c,
+    0x8d, 0x1b, 0x0e, 0x87, 0xaa, 0xd2, 0x4d, 0xbc, 0xc5, 0x6c, 0x31, 0x96, 0xac, 0x1b, 0xbb, 0x49,
+    0xf3, 0x96, 0xa0, 0x81, 0x89, 0x75, 0x27, 0x61, 0xae, 0xfc, 0x57, 0x12, 0xf6, 0xbd, 0x89, 0x53,
+    0x5b, 0xbb, 0xa7, 0xa2, 0x64, 0x5d, 0x6b, 0x50, 0x13, 0x4f, 0x64, 0xe7, 0x58, 0xfd, 0x30, 0xb1,
+    0xd1, 0x66, 0xa1, 0xfe, 0x32, 0xd5, 0x5e, 0x61, 0x42, 0x26, 0x1d, 0x98, 0x43, 0x1d, 0x1b, 0x1c,
+    0x43, 0x89, 0x8a, 0x09, 0x30, 0x8d, 0xcc, 0x89, 0xe3, 0xed, 0xfe, 0x5f, 0xd4, 0x6e, 0x62, 0xb6,
+    0x1c, 0x96, 0x9a, 0x66, 0xd2, 0x9b, 0x23, 0x39, 0xac, 0x21, 0x95, 0x68, 0x7c, 0x0f, 0x18, 0x93,
+    0xef, 0x04, 0x4b, 0x61, 0x9e, 0xe9, 0x8e, 0xea, 0xa0, 0x35, 0xe4, 0x0f, 0xa0, 0x32, 0xde, 0x8d,
+    0x2d, 0xf0, 0x56, 0x54, 0x79, 0x96, 0x97, 0xfa, 0x3f, 0xfa, 0x31, 0x67, 0x37, 0xe7, 0x38, 0x78,
+    0xfe, 0xdf, 0x29, 0x69, 0x8f, 0x65, 0x65, 0x1a, 0x30, 0xd5, 0x1f, 0xc5, 0x26, 0x00, 0xc7, 0x0a,
+    0x26, 0x58, 0xa8, 0x47, 0x1c, 0xb2, 0xc9, 0xe2, 0xb9, 0xee, 0x37, 0xe4, 0x2f, 0x3c, 0xcd, 0xa5,
+    0xd2, 0x34, 0xd3, 0x83, 0xda, 0x58, 0x77, 0x3c, 0xc0, 0x4c, 0x4c, 0xac, 0x57, 0xf5, 0xab, 0x87,
+    0xe8, 0xba, 0x5b, 0x5f, 0xeb, 0x46, 0xad, 0xe9, 0x69, 0x5f, 0x69, 0x44, 0x2a, 0xa4, 0xa0, 0x8b,
+    0x62, 0x14, 0x18, 0x1d, 0xc2, 0x48, 0x26, 0x33, 0x60, 0x32, 0xe0, 0x16, 0xdc, 0x71, 0x88, 0xd2,
+    0xe0, 0xc9, 0xf3, 0x59, 0xb3, 0xe3, 0x96, 0x59, 0x9e, 0xd2, 0x04, 0xa6, 0x94, 0x4a, 0x5c, 0x9c,
+    0x23, 0x01, 0xb7, 0x66, 0x60, 0x5e, 0xdc, 0x27, 0x7f, 0x7b, 0x48, 0xc5, 0xae, 0xd4, 0xf1, 0x66,
+    0xfa, 0x09, 0xbe, 0x91, 0x98, 0x0b, 0x71, 0x33, 0xf9, 0x66, 0xb1, 0xac, 0xfa, 0xe7, 0x09, 0xa9,
+    0xfa, 0xc3, 0x9b, 0xc9, 0x62, 0x35, 0x21, 0xf7, 0x9c, 0x1d, 0xa0, 0xef, 0xb8, 0x99, 0xb8, 0xd0,
+    0x00, 0x2e, 0x56, 0x04, 0xc7, 0x0c, 0x8c, 0xd5, 0x63, 0x58, 0x29, 0x2b, 0x6e, 0x26, 0x7b, 0xad,
+    0xf3, 0xed, 0x7c, 0x7e, 0x38, 0x1c, 0x66, 0x87, 0xe5, 0x4c, 0xaa, 0x64, 0xbe, 0x70, 0x5d, 0x17,
+    0x6d, 0x4d, 0x3e, 0x7f, 0xca, 0xa9, 0xde, 0x93, 0xe8, 0x66, 0xf2, 0xf3, 0x15, 0x20, 0x2f, 0x7c,
+    0x02, 0x1f, 0xc7, 0xff, 0x7d, 0x32, 0xff, 0xfc, 0x09, 0x27, 0x7c, 0x3e, 0xbf, 0xec, 0xa0, 0x55,
+    0x69, 0x23, 0x6e, 0xcd, 0xfe, 0xdb, 0x79, 0x9a, 0xcb, 0x82, 0x63, 0xcb, 0x05, 0x69, 0x82, 0x3e,
+    0x1a, 0xf6, 0xb6, 0xa4, 0x67, 0xc8, 0x86, 0x13, 0x05, 0x79, 0x6c, 0xea, 0x76, 0x5b, 0x43, 0x1c,
+    0x52, 0xc1, 0xb2, 0x88, 0x42, 0xe9, 0xe1, 0xe1, 0x1d, 0x44, 0x96, 0x67, 0x11, 0x87, 0x56, 0x4f,
+    0x62, 0x47, 0x0b, 0x68, 0x69, 0x64, 0x03, 0xcf, 0xee, 0x99, 0xd2, 0x17, 0x1e, 0xf6, 0xdd, 0xa5,
+    0x2a, 0x30, 0xa2, 0xb9, 0xe4, 0x9d, 0xd5, 0xb7, 0xb1, 0x0c, 0xcb, 0xa2, 0xe6, 0x63, 0xf5, 0xcd,
+    0x1c, 0x24, 0x0c, 0x5d, 0xc6, 0xb3, 0x53, 0x96, 0x1a, 0x7b, 0xf4, 0x3a, 0xb4, 0xe6, 0xd0, 0xb1,
+    0xa7, 0x91, 0x3c, 0x60, 0x03, 0x8e, 0x9f, 0x25, 0x6c, 0x78, 0x54, 0x22, 0x16, 0xc7, 0xcc, 0xd9,
+    0x02, 0xf1, 0xf1, 0x64, 0x85, 0x15, 0x49, 0xa2, 0xf2, 0xe9, 0x47, 0xd4, 0x51, 0xff, 0xe8, 0x6a,
+    0x26, 0x11, 0x12, 0x21, 0x0f, 0x2c, 0x1a, 0xe5, 0x6a, 0x7d, 0xdc, 0x7a, 0x3e, 0x8b, 0x39, 0x13,
+    0x51, 0xc1, 0x74, 0xe3, 0xf8, 0xdb, 0x13, 0x61, 0xd3, 0xe9, 0x3b, 0x17, 0x6e, 0xbf, 0xbe, 0x55,
+    0x4c, 0x3f, 0xdd, 0x89, 0x62, 0x6b, 0xd0, 0x29, 0x71, 0x12, 0x20, 0x8f, 0x05, 0x62, 0xb1, 0xe7,
+    0x11, 0x34, 0xc1, 0xe8, 0x9f, 0x60, 0x09, 0xc4, 0xea, 0x1d, 0x1d, 0xe7, 0xf1, 0x54, 0x66, 0xb5,
+    0x6f, 0xa4, 0x37, 0x7c, 0xa1, 0xa0, 0x54, 0x1a, 0xf8, 0x65, 0xcf, 0xc2, 0x3b, 0x08, 0x0e, 0x34,
+    0x4d, 0x14, 0xac, 0xff, 0x1b, 0x76, 0x2c, 0x8d, 0x16, 0xb6, 0x69, 0x15, 0xda, 0x49, 0x7d, 0x9d,
+    0x42, 0x7c, 0xa4, 0xa1, 0x66, 0xe5, 0xe6, 0x09, 0x2a, 0x0c, 0x68, 0x55, 0xcb, 0x97, 0x11, 0x98,
+    0xe6, 0x10, 0xb7, 0xb6, 0x15, 0xad, 0xb6, 0xe6, 0x0c, 0xe4, 0x38, 0x16, 0x0c, 0x15, 0x05, 0x33,
+    0xc0, 0xe1, 0xd0, 0x8d, 0x14, 0xc7, 0x3c, 0x30, 0x9d, 0xc7, 0x66, 0x10, 0x98, 0xaa, 0x7c, 0xf4,
+    0xed, 0x0f, 0xd5, 0x1b, 0xcc, 0x9a, 0xcd, 0x38, 0x18, 0xc0, 0x7c, 0x68, 0xf3, 0x44, 0x63, 0x53,
+    0x97, 0xfc, 0xea, 0xdd, 0x77, 0xfb, 0xbb, 0x1e, 0xf5, 0xae, 0xd7, 0xc6, 0x75, 0x9c, 0xcd, 0x20,
+    0x8a, 0x54, 0xd4, 0xc1, 0xfb, 0x7b, 0x06, 0x52, 0x88, 0x2a, 0x62, 0xce, 0xfa, 0x4a, 0x8a, 0xd6,
+    0x49, 0x7f, 0x46, 0xe1, 0x61, 0xe3, 0xd2, 0xb0, 0x1b, 0xeb, 0x35, 0x2f, 0x2d, 0x06, 0x75, 0x80,
+    0xe9, 0x57, 0x9e, 0x67, 0xbb, 0xf0, 0xbb, 0xda, 0x44, 0x68, 0x0e, 0xf1, 0x67, 0x24, 0x4a, 0x8d,
+    0xf9, 0x37, 0x1d, 0xed, 0x16, 0xbe, 0x3f, 0xad, 0x7f, 0x3a, 0xad, 0xc4, 0x6b, 0x07, 0xbc, 0x91,
+    0xb7, 0xbd, 0xcb, 0xe3, 0x66, 0x30, 0x36, 0x7f, 0x3e, 0x6e, 0xdd, 0xf4, 0x6b, 0x35, 0x88, 0x75,
+    0x24, 0xab, 0xa0, 0x7d, 0x55, 0x34, 0x49, 0x50, 0xd4, 0xc8, 0x6d, 0xa8, 0x18, 0xcb, 0x0a, 0xf2,
+    0x4f, 0x5e, 0x68, 0x13, 0xb2, 0x02, 0xeb, 0x78, 0x80, 0xdd, 0x23, 0x8e, 0x3c, 0x11, 0xfc, 0x03,
+    0x27, 0x1f, 0x08, 0x69, 0x2d, 0xa3, 0xed, 0x9b, 0x98, 0xba, 0xba, 0x23, 0x76, 0xa8, 0xa8, 0xbb,
+    0xff, 0x4d, 0xd7, 0x86, 0x5a, 0xf4, 0xa2, 0x90, 0x3d, 0xb7, 0xdc, 0xb4, 0xb8, 0x75, 0xc2, 0x56,
+    0x8b, 0x61, 0x7d, 0xb1, 0x64, 0xe3, 0x7b, 0xca, 0xa3, 0xb7, 0x60, 0x5e, 0x23, 0x9d, 0x28, 0x1a,
+    0x8c, 0x77, 0x1d, 0x27, 0x8f, 0x75, 0x46, 0xfa, 0x6c, 0xa1, 0x3d, 0x4e, 0xc2, 0x22, 0x03, 0xe5,
+    0xcc, 0x56, 0x14, 0xf3, 0x6d, 0xb8, 0xb1, 0xad, 0xa0, 0x80, 0x7e, 0xb8, 0xe7, 0x22, 0x3a, 0xd6,
+    0xba, 0x7a, 0x3f, 0x75, 0xbf, 0xd2, 0x7b, 0x85, 0x86, 0x9a, 0xdf, 0x63, 0x73, 0xdc, 0x76, 0x39,
+    0x00, 0x6c, 0x86, 0x73, 0x67, 0xe3, 0xa5, 0x6d, 0xd5, 0xdd, 0x8c, 0xf1, 0x3f, 0xa7, 0x8a, 0x61,
+    0x77, 0x57, 0x2f, 0x1a, 0xb1, 0x98, 0x96, 0x42, 0x57, 0x5d, 0x3b, 0xb0, 0xc9, 0xd9, 0x83, 0x74,
+    0xb7, 0x4f, 0x80, 0xca, 0x2a, 0xaa, 0xff, 0x86, 0x7b, 0x9a, 0x41, 0x9b, 0xdf, 0xf3, 0x12, 0xd9,
+    0x0a, 0x1b, 0x18, 0x14, 0xe0, 0x57, 0x3b, 0xfd, 0xaa, 0x8c, 0x57, 0x57, 0x6c, 0x02, 0xaa, 0x0e,
+    0x9e, 0xce, 0x7f, 0xe6, 0x45, 0x88, 0x4c, 0x0f, 0x4a, 0x80, 0x31, 0xeb, 0xb6, 0x79, 0x27, 0x6a,
+    0x47, 0x35, 0x7a, 0xd8, 0x83, 0x37, 0x6d, 0x81, 0x58, 0xb7, 0x13, 0xbd, 0x6e, 0x31, 0x86, 0xe4,
+    0x7e, 0x51, 0x5c, 0xcd, 0x8c, 0x56, 0x2b, 0x3d, 0x7a, 0x23, 0x33, 0x72, 0xd3, 0xd3, 0xe2, 0x54,
+    0x9f, 0x42, 0xd5, 0xc6, 0xb6, 0x7b, 0x4c, 0xaa, 0x2e, 0x64, 0xd7, 0xf6, 0x26, 0x40, 0x8c, 0x5f,
+    0xe5, 0x6c, 0x5e, 0x3e, 0x18, 0x8e, 0x15, 0x9d, 0x54, 0x3b, 0x6e, 0xff, 0xd4, 0xdf, 0x39, 0x0d,
+    0xc0, 0x9c, 0x32, 0x37, 0xc7, 0xba, 0x58, 0x4a, 0x6d, 0x1c, 0x7a, 0xfd, 0x4e, 0x47, 0xbd, 0xdd,
+    0x91, 0xd6, 0x51, 0x68, 0xf4, 0xf2, 0x66, 0x06, 0xcb, 0x08, 0x9a, 0x17, 0x3c, 0x30, 0xe4, 0x6c,
+    0xe3, 0x06, 0x2d, 0x1b, 0x18, 0x5b, 0x16, 0x84, 0xd9, 0x5e, 0x64, 0x56, 0x89, 0x4f, 0x5b, 0x85,
+    0x31, 0xaa, 0xbd, 0xfd, 0xec, 0x55, 0xab, 0x7b, 0x6b, 0x04, 0xcf, 0x7a, 0xf3, 0xf2, 0xad, 0x4c,
+    0x75, 0xb3, 0x53, 0xc9, 0xf0, 0xb7, 0x29, 0x8b, 0x38, 0x25, 0x17, 0xad, 0x3b, 0xe2, 0x35, 0xde,
+    0x11, 0x5f, 0xc2, 0xea, 0xc3, 0xab, 0x90, 0xd3, 0x45, 0x0d, 0xd6, 0x22, 0xfd, 0x1b, 0xdb, 0x16,
+    0x9a, 0x4b, 0x7b, 0x13, 0xfb, 0x0c, 0x26, 0xff, 0x00, 0x0c, 0xbd, 0xc1, 0x5b, 0x2b, 0x18, 0x00,
+    0x00,
+};
+
+#define ASSET_APP_CSS_ETAG "541f3ad0b0ce94bc"
+
+// app.js: 14409 bytes, 4278 gzipped
+static const uint8_t ASSET_APP_JS[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x3b, 0x4d, 0x6f, 0x1c, 0x47,
+    0x76, 0x77, 0xfe, 0x8a, 0x92, 0x93, 0xa8, 0xbb, 0x21, 0x4e, 0x73, 0xa4, 0x5d, 0x6d, 0x76, 0x49,
+    0xd3, 0x86, 0x44, 0xc9, 0x31, 0xb3, 0x12, 0xad, 0x98, 0xb2, 0x83, 0x05, 0x21, 0x0c, 0x6a, 0xba,
+    0x6b, 0x38, 0x65, 0xf6, 0x74, 0xb7, 0xbb, 0xab, 0x49, 0xcf, 0xda, 0x04, 0xf6, 0x90, 0x43, 0x02,
+    0x24, 0xc8, 0x61, 0x73, 0xc8, 0x25, 0xd8, 0x4b, 0x80, 0x24, 0xc8, 0x25, 0x97, 0x00, 0x39, 0xef,
+    0x4f, 0xc9, 0x1f, 0xc8, 0xfe, 0x84, 0xbc, 0xf7, 0xaa, 0xaa, 0xbb, 0xaa, 0x3f, 0x46, 0x14, 0xd7,
+    0x0b, 0xac, 0x35, 0x55, 0xf5, 0xde, 0xab, 0x57, 0xef, 0xfb, 0x55, 0x35, 0x0f, 0x0e, 0xd8, 0xdb,
+    0xb5, 0x60, 0x25, 0xbf, 0x14, 0x4c, 0xd6, 0x8c, 0xb3, 0x5a, 0x71, 0x25, 0x13, 0xc6, 0xeb, 0x5a,
+    0xa8, 0x23, 0x26, 0xae, 0x45, 0xb5, 0x65, 0xd7, 0x3c, 0x6b, 0x60, 0x39, 0x67, 0x52, 0x21, 0xd0,
+    0x4a, 0x66, 0x99, 0x48, 0x71, 0xbc, 0xaa, 0x8a, 0x0d, 0x3b, 0x68, 0xca, 0x94, 0x2b, 0xc1, 0x78,
+    0x9e, 0xb2, 0x03, 0x40, 0xc8, 0x55, 0xbd, 0x97, 0x09, 0xc5, 0x56, 0x45, 0xb5, 0x79, 0x21, 0x2b,
+    0xb5, 0x65, 0xc7, 0x6c, 0xc5, 0xb3, 0x5a, 0x1c, 0xed, 0xad, 0x9a, 0x3c, 0x51, 0xb2, 0xc8, 0xd9,
+    0x8d, 0xe0, 0x6a, 0x2d, 0xaa, 0xd3, 0xa4, 0xc8, 0xc3, 0xa4, 0x48, 0x45, 0xc4, 0xbe, 0xdf, 0x63,
+    0x4c, 0xae, 0x18, 0x8d, 0xd8, 0xf1, 0xf1, 0x31, 0x9b, 0x47, 0xac, 0x12, 0xaa, 0xa9, 0x72, 0x16,
+    0xfc, 0xef, 0x3f, 0xff, 0xe6, 0xff, 0xfe, 0xe7, 0x1f, 0x83, 0x23, 0x17, 0xe4, 0x93, 0x63, 0xf6,
+    0x98, 0x3d, 0x7c, 0xc8, 0x68, 0xf0, 0xf1, 0x31, 0xfb, 0x49, 0x07, 0xfe, 0x87, 0xdf, 0xfd, 0xfd,
+    0xbf, 0x0e, 0xe0, 0x01, 0xe4, 0xa7, 0x3f, 0xf7, 0x60, 0xfe, 0x73, 0x0c, 0xe6, 0xe9, 0x53, 0x0f,
+    0xe6, 0xdf, 0xc6, 0x60, 0x7e, 0xf6, 0xd4, 0x65, 0xed, 0x9f, 0x06, 0xeb, 0x7f, 0xee, 0xae, 0xff,
+    0xcb, 0xdf, 0x8c, 0x91, 0xf8, 0xf9, 0xcf, 0xbc, 0x6d, 0xfe, 0x7d, 0x0c, 0xe6, 0x17, 0xbf, 0xf0,
+    0x60, 0xfe, 0xc3, 0xc2, 0x74, 0xa4, 0x7f, 0x0b, 0xe3, 0xdb, 0x4e, 0xa8, 0x5a, 0x0f, 0x5f, 0xcb,
+    0x5a, 0x2e, 0x65, 0x26, 0xd5, 0x36, 0x8c, 0x50, 0xa8, 0xd7, 0xbc, 0x02, 0xf5, 0xca, 0xaa, 0x06,
+    0x35, 0x5c, 0x5c, 0x04, 0xbc, 0x51, 0xc5, 0x0b, 0xa1, 0x44, 0xa2, 0x82, 0xfd, 0x60, 0xc3, 0xf3,
+    0x86, 0x67, 0x9f, 0x49, 0x91, 0xa5, 0x75, 0xb0, 0xaf, 0xaa, 0x46, 0xbc, 0xdb, 0x67, 0x17, 0x41,
+    0x2e, 0x2f, 0xd7, 0xea, 0x35, 0xb0, 0x01, 0x20, 0xf4, 0xdb, 0x42, 0x90, 0x1a, 0x09, 0xa4, 0x5e,
+    0x17, 0x37, 0x6f, 0xe5, 0x06, 0x20, 0x58, 0xa0, 0xe0, 0xdf, 0x93, 0x22, 0x57, 0xa0, 0xf9, 0x3e,
+    0xc8, 0x5f, 0x6b, 0x3d, 0x03, 0x1d, 0xa3, 0xf1, 0x09, 0xb8, 0x37, 0x09, 0x80, 0x94, 0xc9, 0xc4,
+    0xea, 0x49, 0xb5, 0x2d, 0x55, 0x01, 0x10, 0x09, 0xfd, 0x98, 0x82, 0x6a, 0xaa, 0x4a, 0xe4, 0xc9,
+    0x16, 0xe1, 0xcc, 0xcf, 0x09, 0xc8, 0x73, 0x55, 0x24, 0x57, 0x00, 0x56, 0xe3, 0xbf, 0x13, 0x30,
+    0xcf, 0xfe, 0xea, 0x14, 0x20, 0xf8, 0xb7, 0x72, 0x62, 0xfd, 0xb5, 0x48, 0x25, 0x47, 0x11, 0xe2,
+    0xbf, 0x3d, 0x98, 0x77, 0xa8, 0x26, 0x92, 0x79, 0x0c, 0x4e, 0xf0, 0x92, 0x27, 0xeb, 0xb0, 0x64,
+    0xc7, 0x9f, 0x90, 0x8d, 0x6b, 0x85, 0x24, 0x6b, 0xd0, 0x46, 0x5a, 0x24, 0xcd, 0x06, 0xd0, 0xe2,
+    0x4b, 0xa1, 0x5e, 0x66, 0x02, 0x7f, 0x3e, 0xdf, 0x9e, 0xa6, 0x61, 0x79, 0x31, 0x7f, 0x17, 0x1d,
+    0x81, 0x2d, 0x84, 0x0f, 0x92, 0xb5, 0xb5, 0x81, 0xa3, 0x16, 0x57, 0xf1, 0x0a, 0x10, 0x76, 0xe2,
+    0x3f, 0x06, 0xfc, 0x16, 0x1e, 0xb8, 0x6d, 0xb2, 0xf4, 0x73, 0x89, 0x7e, 0xc5, 0xca, 0x8b, 0x27,
+    0xef, 0xd8, 0xa7, 0xb0, 0x7f, 0x9c, 0xac, 0x45, 0x72, 0x05, 0x6e, 0x7c, 0xc8, 0x1e, 0x74, 0x23,
+    0x8d, 0xa5, 0x77, 0x88, 0x93, 0x0c, 0xa2, 0xc0, 0x19, 0xdf, 0x20, 0x9e, 0x43, 0xe4, 0x53, 0x16,
+    0x24, 0x45, 0x96, 0xf1, 0x12, 0xec, 0x2c, 0x13, 0x6c, 0x2d, 0xd3, 0x54, 0xe4, 0x01, 0xd0, 0x71,
+    0xa7, 0x03, 0x8f, 0xd2, 0xb7, 0x0d, 0x84, 0x91, 0x73, 0x91, 0x81, 0xd5, 0x15, 0xd5, 0xb3, 0x2c,
+    0x0b, 0x03, 0x99, 0x97, 0x8d, 0xda, 0x67, 0x35, 0xcd, 0x05, 0x51, 0x2b, 0x27, 0x91, 0xa1, 0xa0,
+    0x44, 0x16, 0xa7, 0xb2, 0xe6, 0x4b, 0x0c, 0x33, 0xee, 0xde, 0x74, 0xaa, 0x5b, 0xfa, 0x2f, 0x9e,
+    0x8c, 0x27, 0x3b, 0xa4, 0x40, 0x96, 0x7e, 0xb2, 0x4d, 0x80, 0x97, 0x16, 0xa1, 0x96, 0xbb, 0x10,
+    0xea, 0xa4, 0x12, 0x22, 0x3f, 0xcd, 0xd5, 0x29, 0x32, 0xa7, 0xb1, 0x40, 0x09, 0xb0, 0x0b, 0xc4,
+    0x99, 0x5a, 0x46, 0xf0, 0x7f, 0x97, 0xad, 0x07, 0x3c, 0xe9, 0xc4, 0x76, 0xbb, 0xe7, 0xbb, 0x16,
+    0x73, 0x9d, 0x88, 0x79, 0xee, 0xe2, 0xf9, 0x05, 0x6b, 0xcd, 0x9f, 0x79, 0xa6, 0xce, 0x7a, 0x26,
+    0xcd, 0x5c, 0xc3, 0x65, 0x9d, 0x85, 0x32, 0xd7, 0x18, 0x99, 0x73, 0xe6, 0x77, 0xad, 0x48, 0x65,
+    0x4a, 0xb6, 0x47, 0x02, 0x10, 0xd9, 0xf1, 0xd4, 0xf1, 0x65, 0xaa, 0x6d, 0x4e, 0x64, 0x11, 0xca,
+    0x9f, 0xa7, 0xe9, 0x4b, 0x8c, 0xe5, 0xaf, 0x64, 0x0d, 0xa6, 0x2d, 0xaa, 0x30, 0x48, 0xd6, 0x3c,
+    0xbf, 0xc4, 0x13, 0xf4, 0xe3, 0x0c, 0xe0, 0xa1, 0x4e, 0x86, 0xe1, 0xe7, 0x68, 0x6f, 0xef, 0xe0,
+    0x80, 0x7d, 0x0e, 0x89, 0x01, 0xec, 0xe4, 0xa3, 0xb3, 0x22, 0x17, 0x1f, 0xb1, 0x13, 0x94, 0xd8,
+    0xb2, 0xf8, 0x8e, 0xbd, 0x2a, 0x2e, 0x65, 0xd2, 0x05, 0x2f, 0x55, 0x5c, 0x5e, 0x66, 0x02, 0x61,
+    0x42, 0x9d, 0x0c, 0x20, 0x35, 0xd4, 0x8a, 0xe5, 0x30, 0xf1, 0x1c, 0xa0, 0x77, 0xe9, 0x39, 0x97,
+    0x1b, 0xc4, 0xd3, 0x0a, 0xd3, 0x68, 0x05, 0x4a, 0xb7, 0x76, 0xb1, 0x86, 0x26, 0x18, 0x23, 0xe2,
+    0x2c, 0x59, 0x5f, 0x69, 0x44, 0x8d, 0xd2, 0x4a, 0x2d, 0x59, 0x76, 0x1e, 0x9b, 0x2c, 0x5d, 0xbd,
+    0x1b, 0x96, 0x7c, 0x97, 0x01, 0xc1, 0xf5, 0xe6, 0x23, 0x44, 0xb3, 0x4e, 0xd6, 0x66, 0x40, 0x43,
+    0xae, 0xe4, 0xa0, 0x57, 0x7b, 0x8c, 0xb8, 0x56, 0xdb, 0x4c, 0xc4, 0x45, 0xc9, 0x13, 0x49, 0xd9,
+    0xb2, 0x47, 0x09, 0x3d, 0x6e, 0x1e, 0x3f, 0x25, 0x17, 0x7b, 0x1c, 0x58, 0x17, 0x70, 0x02, 0x3f,
+    0xc1, 0x9d, 0xf3, 0x95, 0x50, 0xdb, 0x33, 0xa1, 0x42, 0x9b, 0x4c, 0xc3, 0x07, 0x77, 0x90, 0x59,
+    0xc7, 0xae, 0x3e, 0x2b, 0x66, 0xee, 0xa4, 0x68, 0x72, 0x0c, 0x30, 0x73, 0xcd, 0xef, 0xdd, 0x64,
+    0xd8, 0x97, 0x1c, 0x32, 0xd0, 0x49, 0x20, 0xd2, 0x44, 0x1f, 0x3d, 0x3a, 0x32, 0xfe, 0x4b, 0x0c,
+    0x9a, 0x8d, 0x74, 0xb6, 0xd7, 0xfb, 0x33, 0xf6, 0x01, 0x4c, 0x03, 0x8f, 0x98, 0xb4, 0x8e, 0x0c,
+    0xa6, 0x6b, 0x43, 0x7a, 0xee, 0x16, 0x85, 0x05, 0xa2, 0x32, 0xc6, 0xb4, 0xbc, 0xab, 0x1d, 0xa1,
+    0x3a, 0x97, 0x11, 0x20, 0xec, 0xf2, 0x83, 0x6e, 0x3b, 0xc0, 0xb8, 0x9f, 0x90, 0xf6, 0xc8, 0x1a,
+    0x76, 0xec, 0xe1, 0xab, 0x16, 0xd5, 0x0e, 0xff, 0xf7, 0xcf, 0xa9, 0xcf, 0x96, 0x01, 0xee, 0xce,
+    0xe0, 0x56, 0x54, 0x0a, 0x2d, 0x78, 0x86, 0x80, 0x41, 0x8b, 0x56, 0x54, 0x29, 0x94, 0x61, 0x18,
+    0xef, 0xde, 0x1f, 0x19, 0xbf, 0x68, 0x61, 0x03, 0xe3, 0xda, 0x9f, 0x75, 0xde, 0xcb, 0xea, 0x6d,
+    0x9e, 0xb0, 0x17, 0x5f, 0xbc, 0xd6, 0x9c, 0xdc, 0x48, 0xb5, 0xd6, 0xcc, 0xa3, 0xaf, 0x63, 0x51,
+    0x29, 0x6a, 0xd6, 0xd4, 0x32, 0xbf, 0x64, 0xe0, 0x67, 0x0c, 0x22, 0x05, 0x9f, 0x99, 0x44, 0xc6,
+    0x95, 0xaa, 0xe4, 0xb2, 0x51, 0xa2, 0x33, 0x68, 0xa4, 0x75, 0xde, 0xed, 0xe9, 0x45, 0x04, 0xa9,
+    0xc4, 0x86, 0x6a, 0x99, 0x38, 0x8e, 0x71, 0xab, 0x31, 0x81, 0xb7, 0x87, 0x45, 0xe0, 0x20, 0xa2,
+    0x7c, 0x8c, 0x86, 0x2d, 0x72, 0xeb, 0xc4, 0x17, 0x90, 0xc8, 0x1d, 0x9f, 0xbe, 0x20, 0x10, 0x22,
+    0xdd, 0xc5, 0x4d, 0x18, 0x39, 0x31, 0x80, 0x36, 0xd7, 0x2c, 0x9f, 0x22, 0x0a, 0x2e, 0xa3, 0xa0,
+    0x9e, 0x59, 0xf6, 0xc3, 0xc0, 0x39, 0x55, 0x60, 0x0c, 0x50, 0xa3, 0x25, 0xbb, 0x0c, 0xcf, 0xd2,
+    0x6c, 0xdd, 0x82, 0xa1, 0x75, 0x60, 0x69, 0xbb, 0xec, 0x3b, 0xa7, 0x66, 0x51, 0x27, 0x66, 0x34,
+    0x96, 0xb8, 0x12, 0x9b, 0xe2, 0x1a, 0x77, 0x36, 0x47, 0x09, 0x30, 0x86, 0x23, 0x48, 0xed, 0x33,
+    0x56, 0xf1, 0xcb, 0x4b, 0x04, 0xa0, 0x72, 0x0d, 0x3c, 0x06, 0xe1, 0x8c, 0x30, 0xe2, 0xb2, 0xa9,
+    0xf5, 0x61, 0xad, 0xcf, 0x40, 0xf8, 0xaf, 0xc5, 0xd4, 0x8e, 0x60, 0xab, 0x23, 0xdb, 0x69, 0x3e,
+    0x46, 0x77, 0x04, 0x10, 0x0b, 0x3e, 0xdc, 0xaa, 0x4d, 0xe7, 0xa4, 0x49, 0x99, 0x83, 0xf1, 0x7f,
+    0xfe, 0xf6, 0xf5, 0x2b, 0x90, 0x56, 0x40, 0x81, 0xce, 0xf2, 0xe8, 0x97, 0x07, 0x04, 0xcc, 0xcb,
+    0x52, 0xe4, 0xe9, 0xc9, 0x5a, 0x66, 0x29, 0xe6, 0x2c, 0xa2, 0xd2, 0x6e, 0x74, 0x47, 0x78, 0x9d,
+    0xb2, 0xc8, 0xc6, 0xbe, 0xc6, 0x1e, 0x27, 0xf4, 0xe3, 0x6a, 0x25, 0xc8, 0x3d, 0xde, 0xac, 0xb7,
+    0xb5, 0x4c, 0x78, 0xf6, 0x86, 0xe7, 0x20, 0x99, 0x90, 0xe6, 0x4e, 0xea, 0x6b, 0xd7, 0x28, 0xe1,
+    0xbf, 0x8a, 0x4b, 0xe0, 0x7e, 0x97, 0x17, 0xa5, 0xdb, 0x9c, 0x6f, 0x64, 0x32, 0x2b, 0x89, 0xce,
+    0xac, 0xc5, 0xb1, 0x95, 0x06, 0x83, 0x7a, 0xaf, 0xa5, 0xf3, 0xc3, 0x0f, 0xec, 0x41, 0xb7, 0x53,
+    0x57, 0x03, 0x3a, 0x6e, 0xfb, 0xac, 0xc2, 0xed, 0x2c, 0x50, 0x5c, 0x97, 0x90, 0x75, 0x43, 0x28,
+    0x49, 0x75, 0x3a, 0x33, 0x10, 0xfd, 0x32, 0xc0, 0xb1, 0x4a, 0xe2, 0x63, 0x17, 0xc3, 0x04, 0x30,
+    0x0b, 0xd8, 0x23, 0x26, 0x5d, 0xeb, 0xa4, 0xe9, 0xa8, 0x3b, 0xb3, 0x27, 0x5a, 0xbd, 0x38, 0x92,
+    0xa4, 0x86, 0xb2, 0xfe, 0x11, 0x9c, 0xba, 0x0b, 0x5f, 0xb1, 0x6e, 0x52, 0x8f, 0x8d, 0x13, 0x6f,
+    0x78, 0xd9, 0x3a, 0xf0, 0x94, 0xa7, 0x4a, 0xb0, 0xdf, 0x28, 0xfe, 0xa6, 0x90, 0x79, 0x2b, 0xb5,
+    0x1d, 0x1a, 0x77, 0x76, 0xa1, 0x83, 0x51, 0x69, 0x53, 0x14, 0x57, 0x6d, 0x45, 0x03, 0x01, 0x0e,
+    0xc2, 0x20, 0x46, 0x37, 0x0a, 0x85, 0xf6, 0xe0, 0x7b, 0x8e, 0xb0, 0x1d, 0xd0, 0xe3, 0x5e, 0x13,
+    0x35, 0x52, 0x15, 0x3a, 0x05, 0xde, 0x07, 0x94, 0x85, 0x5d, 0x2d, 0xa9, 0xab, 0x42, 0x90, 0x53,
+    0x6f, 0xef, 0x11, 0x93, 0xd0, 0x3c, 0xee, 0xb4, 0x06, 0x63, 0x02, 0x68, 0x00, 0xef, 0x2f, 0x11,
+    0x7b, 0x01, 0xdc, 0xe4, 0x2d, 0x14, 0xd9, 0x57, 0xb9, 0xbc, 0x86, 0x3a, 0x8b, 0x67, 0xec, 0x05,
+    0x84, 0x08, 0xf6, 0x90, 0xbd, 0x2d, 0x1a, 0xe8, 0x86, 0x7a, 0xd5, 0x20, 0xec, 0x8d, 0xcb, 0xcf,
+    0x56, 0x4a, 0x54, 0x2f, 0xb3, 0x70, 0xab, 0x6d, 0xc5, 0x74, 0xbe, 0x77, 0x36, 0x92, 0xc3, 0xbc,
+    0x50, 0x61, 0x4c, 0xa1, 0x08, 0x12, 0x4f, 0x64, 0x86, 0x26, 0x46, 0x44, 0x60, 0x42, 0x10, 0xb7,
+    0xd2, 0x26, 0x11, 0x61, 0x98, 0x64, 0x45, 0x2d, 0x6a, 0x85, 0xf9, 0x16, 0x8c, 0x38, 0xea, 0x7b,
+    0xca, 0x92, 0x2a, 0x50, 0x5a, 0x43, 0xb1, 0x3c, 0x87, 0xb2, 0x25, 0x05, 0x8a, 0x27, 0x99, 0x84,
+    0xe3, 0x7f, 0x09, 0xdb, 0x87, 0x5e, 0xb8, 0x2f, 0x56, 0xab, 0x9a, 0x3a, 0xb4, 0x2d, 0x9b, 0x21,
+    0x6e, 0xac, 0x8a, 0xd2, 0xfc, 0x5a, 0x0b, 0x6c, 0x0b, 0xd8, 0x01, 0x7b, 0xd2, 0xf9, 0x93, 0x01,
+    0xff, 0x98, 0xcd, 0x31, 0xea, 0x9b, 0xd1, 0x27, 0xcc, 0xf0, 0x14, 0xeb, 0x89, 0xf6, 0x2e, 0xe0,
+    0x7b, 0x03, 0x71, 0x68, 0xfe, 0xdd, 0x07, 0x55, 0x90, 0x96, 0x0e, 0x35, 0x83, 0xec, 0x56, 0x53,
+    0xa6, 0x20, 0x6e, 0x70, 0x0c, 0x29, 0xf2, 0xca, 0x7d, 0x87, 0xc2, 0x59, 0xb3, 0x59, 0x82, 0xff,
+    0x9e, 0xbd, 0xfc, 0x8b, 0x67, 0x6f, 0x4f, 0xbf, 0x7e, 0xb9, 0x38, 0x3d, 0xfb, 0xec, 0xf4, 0xec,
+    0xf4, 0xed, 0xaf, 0xc0, 0x77, 0x63, 0x43, 0xd5, 0xf3, 0x61, 0x0c, 0xf2, 0xa7, 0x20, 0x58, 0xab,
+    0x10, 0x7d, 0xdc, 0x36, 0xd6, 0x4f, 0xd6, 0xdb, 0xa0, 0x18, 0xab, 0x05, 0x27, 0xd8, 0xb5, 0x78,
+    0xc3, 0xf8, 0xc6, 0xb5, 0xe2, 0x81, 0xe0, 0xc0, 0x12, 0x2c, 0x7a, 0x0b, 0x02, 0xf5, 0x72, 0x93,
+    0x65, 0x91, 0xa7, 0xb0, 0x15, 0xf4, 0xde, 0xea, 0x85, 0x44, 0x37, 0x1b, 0x5a, 0x0a, 0x72, 0xd3,
+    0x25, 0xb0, 0x56, 0x0d, 0x16, 0x27, 0xb2, 0xc9, 0xa8, 0x16, 0x95, 0x7a, 0x2e, 0xc0, 0x59, 0x44,
+    0xd8, 0xb2, 0xba, 0xdf, 0x92, 0x8e, 0x1c, 0x31, 0x0f, 0x12, 0x4c, 0x77, 0x34, 0x92, 0xb9, 0xc9,
+    0xa8, 0xbb, 0x09, 0x9b, 0x03, 0x61, 0x37, 0x65, 0xc2, 0xcb, 0xb9, 0x82, 0xd6, 0x89, 0x57, 0x29,
+    0x7b, 0x5d, 0x34, 0x80, 0x4f, 0xce, 0x56, 0xb3, 0xf0, 0xcd, 0x49, 0xb4, 0x97, 0x99, 0x5c, 0xdc,
+    0x73, 0x40, 0x24, 0x07, 0xc5, 0x56, 0x85, 0x1d, 0xa8, 0xb0, 0x65, 0x38, 0x38, 0x6c, 0xec, 0xb6,
+    0xf4, 0x94, 0xc7, 0x4d, 0xf4, 0xae, 0xdd, 0x64, 0x0e, 0x32, 0x64, 0x22, 0x2e, 0x2b, 0xba, 0xc4,
+    0x7b, 0x21, 0x56, 0xbc, 0xc9, 0xd0, 0xb2, 0xad, 0x76, 0xf0, 0x1c, 0x43, 0x42, 0xba, 0x20, 0xe8,
+    0xb4, 0x4b, 0x71, 0x7f, 0x07, 0x7b, 0x20, 0xa3, 0x8e, 0xb9, 0x11, 0x7a, 0x6d, 0x49, 0xe3, 0x90,
+    0x1c, 0xc9, 0xd3, 0xde, 0xf5, 0x22, 0x35, 0x01, 0xef, 0xdb, 0x18, 0xa8, 0x56, 0xee, 0xce, 0xc3,
+    0x73, 0xb6, 0xe6, 0x2d, 0x80, 0x1f, 0x74, 0xed, 0x5f, 0x99, 0xe3, 0xa0, 0x32, 0x74, 0x9c, 0xb2,
+    0x3a, 0x78, 0x5d, 0x40, 0x93, 0x2b, 0x26, 0xf5, 0xa0, 0x10, 0xd8, 0x57, 0x84, 0x97, 0xeb, 0x80,
+    0x67, 0xe7, 0xe8, 0xe4, 0x9c, 0xc3, 0x0c, 0xd7, 0x3a, 0x0a, 0x61, 0x40, 0x41, 0xd0, 0x2b, 0xc5,
+    0xc6, 0x55, 0xd8, 0xb9, 0xd2, 0x68, 0xe5, 0xe6, 0xb8, 0x21, 0x86, 0x82, 0x12, 0x56, 0x21, 0x20,
+    0x1f, 0xea, 0xfe, 0x74, 0x87, 0x04, 0xe9, 0x44, 0x28, 0x20, 0xf7, 0x40, 0xda, 0x8d, 0xdf, 0xef,
+    0xf2, 0x2e, 0x57, 0x23, 0x82, 0x87, 0x59, 0x47, 0xf4, 0xb4, 0x93, 0xa8, 0x2f, 0xe6, 0xef, 0x3a,
+    0x2d, 0xdc, 0x83, 0x57, 0xd7, 0xce, 0xfc, 0x50, 0x85, 0x4d, 0xc8, 0x07, 0x45, 0xaa, 0x36, 0x83,
+    0x80, 0xdd, 0xd8, 0xdf, 0x3f, 0x8e, 0xc5, 0x52, 0x5a, 0x1c, 0x74, 0x3b, 0xda, 0xe0, 0x5e, 0xf3,
+    0x1a, 0x8a, 0x0b, 0x9e, 0x25, 0x4d, 0xc6, 0x81, 0xb3, 0xbd, 0x29, 0x86, 0x91, 0x2c, 0x74, 0x96,
+    0x43, 0x31, 0xd4, 0xcd, 0x72, 0x23, 0xd1, 0x00, 0x6d, 0xfc, 0x0e, 0xcd, 0x3d, 0x3b, 0xb6, 0x42,
+    0x1b, 0xa4, 0x6e, 0x5a, 0xfc, 0x7b, 0xf7, 0xae, 0xac, 0xdf, 0xe4, 0x13, 0xd5, 0x47, 0xc7, 0x50,
+    0xed, 0x54, 0xb5, 0x38, 0xcd, 0x15, 0x2e, 0xda, 0x92, 0xc9, 0x96, 0xfa, 0x93, 0xe5, 0xe6, 0x4a,
+    0xe6, 0x3c, 0xc3, 0x53, 0xc3, 0x5e, 0xb6, 0x9a, 0x43, 0x82, 0xba, 0x78, 0x18, 0x79, 0x4e, 0xf8,
+    0x60, 0x89, 0xd0, 0xad, 0x23, 0x08, 0x24, 0xa4, 0x0c, 0xdf, 0xd7, 0x47, 0x74, 0x0f, 0x8a, 0x6d,
+    0xc5, 0x33, 0x49, 0xb2, 0x4d, 0x9e, 0x90, 0x1f, 0xb2, 0xed, 0x57, 0x64, 0x17, 0x61, 0xea, 0xe6,
+    0x4f, 0x5d, 0x2b, 0x40, 0x81, 0xb5, 0x8f, 0x2f, 0x2d, 0xfb, 0x6c, 0xad, 0x36, 0xd9, 0x31, 0x1d,
+    0x51, 0x17, 0x22, 0x77, 0xad, 0xce, 0xec, 0xed, 0x1d, 0x5d, 0xbd, 0x20, 0x11, 0xaa, 0xd2, 0xdc,
+    0xa6, 0x0a, 0xc8, 0x1f, 0xe9, 0x5c, 0x64, 0x17, 0xde, 0x8a, 0xef, 0x94, 0x5d, 0x30, 0xc5, 0x82,
+    0x31, 0x4d, 0x3b, 0xd4, 0xb2, 0xd6, 0x55, 0x85, 0x66, 0x64, 0xad, 0xaf, 0x92, 0x89, 0x61, 0xea,
+    0xec, 0xef, 0xc7, 0x26, 0xb0, 0xd0, 0xf9, 0x90, 0xbe, 0xd2, 0x08, 0x03, 0x73, 0x9b, 0x6c, 0x09,
+    0x7b, 0xfb, 0x82, 0x9c, 0xc0, 0x97, 0x70, 0x67, 0xe8, 0xa3, 0x04, 0x09, 0x6b, 0xc7, 0xce, 0x3d,
+    0x0d, 0x5e, 0x20, 0xce, 0xf1, 0x47, 0xc1, 0x23, 0xfc, 0xf7, 0x51, 0xf0, 0xd1, 0xbb, 0xc0, 0x72,
+    0x82, 0x45, 0x57, 0x8b, 0xc5, 0x41, 0x57, 0xd7, 0xc2, 0xb0, 0xcc, 0x1e, 0x40, 0x71, 0x61, 0x58,
+    0xb5, 0x06, 0x49, 0x92, 0xf2, 0x99, 0x3a, 0x59, 0x7a, 0xea, 0x5b, 0x6e, 0xf1, 0xce, 0x7c, 0x4a,
+    0x81, 0x7a, 0x95, 0x7d, 0xfa, 0x7e, 0x46, 0x65, 0xaa, 0xd9, 0x64, 0x87, 0x77, 0x16, 0x67, 0x7b,
+    0x2b, 0x16, 0x5e, 0xa3, 0xa0, 0x8e, 0xf1, 0x8d, 0x0c, 0xf2, 0x86, 0x1d, 0xa0, 0x66, 0xdd, 0x71,
+    0xf0, 0x38, 0x18, 0x48, 0xf8, 0x4b, 0x9e, 0xca, 0xe2, 0xc7, 0x92, 0xf1, 0x05, 0x49, 0x0d, 0x67,
+    0xe0, 0x87, 0x27, 0xf4, 0x1e, 0xbf, 0xc6, 0xe6, 0xda, 0x80, 0x0b, 0x31, 0x75, 0x55, 0x89, 0x7a,
+    0xbd, 0xd8, 0xc8, 0x9c, 0xb4, 0x00, 0x05, 0xb7, 0x80, 0xf8, 0x00, 0xc0, 0xa0, 0xad, 0x07, 0xad,
+    0x9b, 0xd9, 0xaa, 0x4f, 0x9b, 0x46, 0x18, 0x38, 0x68, 0x60, 0x43, 0x1e, 0x19, 0x53, 0xaf, 0x91,
+    0xbe, 0xdc, 0xc7, 0x01, 0x04, 0xc3, 0xd1, 0x22, 0xc1, 0x61, 0x07, 0x45, 0xf4, 0xf4, 0xc5, 0xd7,
+    0x42, 0xe2, 0xdb, 0x0e, 0xc0, 0x75, 0xc3, 0x0e, 0x8e, 0x04, 0x16, 0xd2, 0x23, 0xd8, 0x02, 0xf9,
+    0xe2, 0x1a, 0xd4, 0x19, 0x0f, 0x77, 0x6e, 0x5f, 0x09, 0xcc, 0xd6, 0x29, 0x8d, 0x7b, 0x7b, 0xe3,
+    0x65, 0x30, 0x81, 0x24, 0x74, 0xc7, 0xee, 0xad, 0x41, 0x46, 0x90, 0xaa, 0x49, 0x35, 0xf7, 0x76,
+    0xd0, 0x87, 0x29, 0xf2, 0x4b, 0x07, 0xc8, 0x8e, 0x7a, 0x50, 0xc8, 0xe7, 0xaf, 0xf1, 0xd6, 0xd3,
+    0x32, 0xfd, 0x6b, 0x7d, 0x9f, 0xe9, 0x70, 0xec, 0xbe, 0x64, 0xa4, 0x31, 0x8d, 0x16, 0x9b, 0x62,
+    0x40, 0x49, 0x2f, 0xd8, 0xa2, 0xc7, 0x02, 0xd2, 0x78, 0x14, 0x52, 0x27, 0x68, 0x0b, 0x07, 0xa3,
+    0x51, 0x28, 0x4e, 0xc1, 0xd3, 0x01, 0xd4, 0x13, 0x3e, 0x87, 0x4e, 0x23, 0x0d, 0x4a, 0x82, 0xc1,
+    0x02, 0x4f, 0xe2, 0xc3, 0x60, 0xdc, 0x5d, 0x40, 0xa1, 0x54, 0x66, 0x5c, 0x8b, 0xd5, 0x9d, 0xd8,
+    0xb7, 0xd1, 0xba, 0x47, 0xb4, 0xeb, 0xc8, 0x0d, 0x5d, 0xf3, 0x8c, 0x39, 0x54, 0xbf, 0xd8, 0x94,
+    0x8b, 0x26, 0x97, 0x46, 0xf9, 0x76, 0xe4, 0x53, 0xac, 0xb0, 0x6f, 0x5c, 0xe0, 0x62, 0xad, 0xad,
+    0xb3, 0x1b, 0x4f, 0x31, 0xa0, 0xef, 0x00, 0xcc, 0xe6, 0xfc, 0x5b, 0x39, 0xd8, 0x18, 0xe6, 0x16,
+    0x6a, 0x5b, 0x1a, 0x3b, 0x36, 0x83, 0x21, 0x1d, 0xba, 0x15, 0x30, 0x64, 0xca, 0x64, 0xb8, 0x6e,
+    0xaf, 0x10, 0x0c, 0x08, 0xbd, 0x8c, 0xf6, 0x7d, 0x01, 0xe7, 0x16, 0xf5, 0x76, 0xb3, 0x2c, 0x32,
+    0x0d, 0xe9, 0x4c, 0xf4, 0x28, 0xd2, 0xca, 0x2a, 0x77, 0xc0, 0x56, 0xf9, 0xe8, 0x11, 0x69, 0x0d,
+    0x92, 0xa8, 0xb1, 0x19, 0x67, 0x3c, 0x25, 0x91, 0xf6, 0x2a, 0xc4, 0xb0, 0xaa, 0xdf, 0x84, 0xfb,
+    0xbe, 0x43, 0x93, 0x0b, 0xa9, 0x2d, 0xac, 0x1d, 0xf9, 0xd4, 0xcc, 0xb4, 0x61, 0xb3, 0x1d, 0x8d,
+    0x6d, 0x6c, 0x16, 0x3b, 0x46, 0xdd, 0x89, 0x49, 0x4e, 0xbb, 0x6b, 0x1a, 0xcb, 0xab, 0x99, 0xe9,
+    0x73, 0x6b, 0xa6, 0x17, 0x4b, 0x5e, 0x6b, 0x45, 0x7a, 0x33, 0x53, 0xd0, 0xe6, 0xa6, 0xd9, 0x83,
+    0xd7, 0x73, 0x53, 0x18, 0x1b, 0xa8, 0xb7, 0x65, 0x09, 0x45, 0x75, 0xe5, 0x63, 0x75, 0xf3, 0xbd,
+    0x63, 0x5b, 0x00, 0x2b, 0xa3, 0x6e, 0x3c, 0x75, 0x68, 0xfb, 0x14, 0x69, 0x4e, 0x4c, 0xcf, 0xe3,
+    0x3e, 0x14, 0x96, 0x0f, 0x0b, 0xb0, 0x79, 0xb5, 0x05, 0x4b, 0x24, 0x48, 0x6f, 0x66, 0x8c, 0xb0,
+    0x03, 0xb0, 0x69, 0xe9, 0xf7, 0x27, 0xfb, 0x88, 0x74, 0xf4, 0x32, 0xd1, 0x87, 0x23, 0x0c, 0x3b,
+    0x18, 0xc2, 0x5c, 0x4b, 0x71, 0x63, 0x41, 0xf0, 0xb7, 0x77, 0x9d, 0x63, 0x4a, 0xe5, 0x94, 0x6a,
+    0xe1, 0x85, 0xae, 0x48, 0xff, 0x88, 0x77, 0x31, 0xef, 0x59, 0x30, 0x24, 0xe2, 0x0f, 0x47, 0x0a,
+    0xe6, 0x88, 0xf2, 0xde, 0xbc, 0x7b, 0x2f, 0xbb, 0xe7, 0x83, 0xa8, 0xce, 0xa8, 0x06, 0x0d, 0x8b,
+    0xc3, 0xfe, 0xeb, 0xa2, 0x65, 0x42, 0x3f, 0xc3, 0x1d, 0xf9, 0xaf, 0x68, 0x74, 0x45, 0x6f, 0x93,
+    0xb2, 0x49, 0x7f, 0x74, 0x1d, 0x4a, 0x79, 0xf8, 0x4e, 0xad, 0x9f, 0x7d, 0x48, 0x18, 0xdc, 0x5c,
+    0xfb, 0x04, 0x7b, 0xf7, 0xd7, 0x1d, 0xc6, 0x07, 0xbf, 0x6c, 0x99, 0x77, 0x0b, 0x60, 0x19, 0x67,
+    0x3a, 0x06, 0xfe, 0xd8, 0xcb, 0x66, 0xfd, 0xbf, 0xa9, 0x8b, 0x75, 0xbf, 0xbb, 0x37, 0x4f, 0x49,
+    0x32, 0x4f, 0xbb, 0x4f, 0x1a, 0x26, 0xae, 0xa0, 0x49, 0xf0, 0xb6, 0x92, 0xa3, 0xc7, 0x91, 0xe1,
+    0x7d, 0x92, 0x7e, 0x33, 0x69, 0x4d, 0x01, 0xff, 0x37, 0xf6, 0x76, 0xa1, 0x57, 0x6e, 0xf7, 0xba,
+    0xff, 0x8e, 0x3d, 0xca, 0x93, 0xed, 0x0f, 0x7b, 0x4e, 0x9c, 0x1e, 0x69, 0xb2, 0x70, 0x1a, 0xef,
+    0xa2, 0xf8, 0x35, 0xf6, 0xcd, 0x4b, 0xba, 0xb6, 0xd2, 0xb7, 0xdc, 0x42, 0x29, 0x98, 0xaa, 0x19,
+    0xaf, 0x2a, 0xa8, 0x99, 0x53, 0x76, 0x83, 0x9f, 0x69, 0xb0, 0x35, 0xbf, 0xc6, 0x35, 0xa8, 0x9e,
+    0x79, 0xce, 0xc8, 0x3d, 0x89, 0xea, 0xde, 0xce, 0xa7, 0xdd, 0x1a, 0x90, 0x9e, 0x37, 0x4a, 0x41,
+    0xa6, 0x8f, 0xdc, 0xb7, 0xf6, 0x96, 0x07, 0x7d, 0x21, 0xf6, 0x0a, 0xf6, 0x61, 0x2f, 0x40, 0x70,
+    0xec, 0x4b, 0x10, 0x0d, 0x18, 0xe1, 0xf3, 0x0c, 0xf2, 0x45, 0x5b, 0x34, 0xa6, 0xe2, 0x5a, 0x26,
+    0x02, 0xe2, 0xbc, 0x5f, 0x32, 0x46, 0xc8, 0x2a, 0x08, 0x9c, 0x56, 0x67, 0x26, 0x27, 0xb4, 0xb0,
+    0x5d, 0x97, 0x1f, 0xcb, 0x72, 0x01, 0x1d, 0x1e, 0x14, 0x8c, 0xf5, 0x28, 0x01, 0x59, 0xce, 0xcc,
+    0x32, 0xde, 0xb0, 0x9f, 0xbe, 0x39, 0x64, 0xf8, 0x34, 0xe2, 0xa2, 0x39, 0xb4, 0xe8, 0x29, 0x7f,
+    0x8c, 0x0a, 0x70, 0xcc, 0xb1, 0x82, 0x99, 0xc9, 0x7c, 0x45, 0x37, 0xfa, 0x7f, 0xf8, 0xdd, 0x6f,
+    0xff, 0xc1, 0x50, 0x22, 0xa4, 0x47, 0x30, 0x08, 0xf5, 0xd8, 0xd6, 0x63, 0x38, 0x17, 0x69, 0xd3,
+    0x26, 0x1a, 0x38, 0x3f, 0x73, 0x6b, 0x99, 0xb6, 0xdc, 0xa1, 0x65, 0xbc, 0x60, 0x81, 0x20, 0x36,
+    0x53, 0xb6, 0x24, 0x1a, 0x5f, 0x46, 0xcb, 0x68, 0x2b, 0x21, 0x87, 0x75, 0x2c, 0x48, 0x86, 0x45,
+    0xb7, 0x33, 0x1f, 0xe4, 0x1c, 0xf4, 0xd4, 0x95, 0xde, 0x61, 0x40, 0x21, 0x6b, 0x86, 0x00, 0x6d,
+    0xfd, 0x43, 0xe7, 0xf8, 0xfd, 0x7f, 0x99, 0x83, 0x0c, 0x0b, 0x22, 0x90, 0x27, 0x78, 0x8c, 0xc5,
+    0x71, 0x3f, 0x08, 0x4c, 0x63, 0x33, 0x5a, 0xd0, 0xa7, 0x81, 0x06, 0x05, 0xc3, 0x7d, 0x68, 0x3f,
+    0x23, 0x9b, 0xe5, 0x05, 0xb2, 0x8f, 0x89, 0x40, 0x07, 0xfd, 0xde, 0xf2, 0x65, 0x45, 0x6a, 0xd6,
+    0x3d, 0xd8, 0x51, 0x9f, 0xcf, 0x95, 0x80, 0x1e, 0x58, 0x17, 0x4c, 0xa5, 0xfe, 0x12, 0x83, 0x8a,
+    0x30, 0x51, 0x71, 0xe8, 0x78, 0xc5, 0xfb, 0x19, 0xd7, 0x54, 0xd6, 0xcd, 0x46, 0xe7, 0xa1, 0x66,
+    0x23, 0x53, 0xa3, 0xb8, 0x3f, 0x0b, 0x86, 0x70, 0x37, 0xd2, 0x14, 0xba, 0xf8, 0x63, 0x51, 0x97,
+    0x02, 0xe4, 0x89, 0x5b, 0x5c, 0x6d, 0x0e, 0xd6, 0x1e, 0xb8, 0x65, 0x1e, 0x7c, 0x16, 0xed, 0xe2,
+    0x15, 0x87, 0x70, 0xa2, 0xef, 0x0b, 0xac, 0xa5, 0x69, 0x6f, 0xee, 0x8a, 0xdb, 0xdb, 0x56, 0x67,
+    0x50, 0xf9, 0x8d, 0xa9, 0xcc, 0x4e, 0x4f, 0x69, 0x0c, 0xd6, 0x6d, 0xe1, 0xe8, 0x89, 0x19, 0xc6,
+    0x53, 0x22, 0xc6, 0xa5, 0x11, 0xf1, 0x9a, 0x7b, 0xfb, 0x6f, 0xe5, 0x2b, 0xbe, 0xdc, 0xd9, 0x24,
+    0xfe, 0x49, 0xbb, 0x33, 0x1c, 0x09, 0x2c, 0x13, 0x03, 0x37, 0xa2, 0x98, 0xd6, 0xd0, 0x52, 0x88,
+    0x5a, 0x5a, 0xde, 0x45, 0x85, 0xae, 0x71, 0xf1, 0x72, 0xa0, 0xa9, 0x49, 0x8a, 0xa7, 0x70, 0xe0,
+    0xef, 0x82, 0x81, 0xd0, 0xcb, 0xcd, 0x93, 0xa7, 0x3a, 0xa1, 0xc3, 0x0f, 0x02, 0xfc, 0xb8, 0xde,
+    0xf0, 0x2c, 0xfb, 0xe4, 0xf7, 0xff, 0x7d, 0xf9, 0xf1, 0x81, 0xfe, 0x19, 0xf4, 0x2b, 0x86, 0x0e,
+    0xf9, 0xf1, 0xdc, 0x20, 0x3f, 0x9e, 0x7f, 0x28, 0x72, 0x5e, 0x3c, 0xd1, 0xdd, 0x4a, 0xf1, 0xe4,
+    0xee, 0xa8, 0x28, 0xd4, 0xfb, 0xa8, 0x1d, 0xca, 0x95, 0xa4, 0x6c, 0xc6, 0x34, 0xef, 0xac, 0x04,
+    0xf3, 0x78, 0x3e, 0x0f, 0x46, 0xa6, 0x7d, 0x8b, 0x28, 0x93, 0x19, 0x2c, 0x01, 0x0b, 0xaf, 0xc1,
+    0x0c, 0x75, 0x6f, 0x12, 0x52, 0x59, 0xf2, 0x59, 0x56, 0x70, 0xd5, 0x6e, 0x06, 0x19, 0xdd, 0x35,
+    0x74, 0x6d, 0x14, 0x80, 0x3b, 0x61, 0x2e, 0xb0, 0x32, 0xe5, 0x8c, 0x88, 0x44, 0xf5, 0xeb, 0x8e,
+    0x0d, 0x01, 0x40, 0x6f, 0xc8, 0x7e, 0xf9, 0xfc, 0xa0, 0x0e, 0x7a, 0xe8, 0x15, 0xdf, 0xec, 0x46,
+    0x07, 0x80, 0x1e, 0xbf, 0x16, 0x15, 0xa2, 0xe7, 0xd5, 0x6e, 0x5c, 0x84, 0xf0, 0x90, 0x3b, 0xb1,
+    0x9b, 0xea, 0xbf, 0xac, 0x20, 0x85, 0x8c, 0x09, 0x7f, 0xb0, 0x3e, 0xf4, 0x3f, 0x0d, 0x32, 0x23,
+    0x10, 0xb7, 0xa3, 0xd0, 0x38, 0xb0, 0xe9, 0x9f, 0xfa, 0x12, 0x36, 0xf0, 0x13, 0x52, 0x36, 0xab,
+    0x53, 0x92, 0x36, 0xcb, 0xd0, 0xaa, 0xb9, 0x5b, 0xe9, 0xce, 0x8d, 0x84, 0xfb, 0x86, 0xd8, 0x18,
+    0x41, 0x69, 0xef, 0x37, 0xdd, 0x96, 0x07, 0x66, 0x86, 0x32, 0x35, 0x08, 0x0a, 0xc2, 0x69, 0x3a,
+    0xc3, 0xd0, 0x0e, 0x48, 0x9e, 0x48, 0x3d, 0xfc, 0x08, 0x3f, 0xe0, 0x9e, 0xe3, 0x97, 0x6d, 0x90,
+    0xfe, 0xfe, 0x96, 0x3e, 0x6d, 0x83, 0x1f, 0x7f, 0x37, 0x46, 0xf1, 0x3e, 0x7e, 0xe1, 0xf5, 0x4f,
+    0x10, 0xdc, 0xbf, 0x53, 0xfd, 0x5c, 0xec, 0xaa, 0xc2, 0x00, 0xcf, 0x10, 0x78, 0x06, 0x5e, 0x3c,
+    0x6c, 0xc1, 0x88, 0x84, 0xaf, 0x0f, 0x8b, 0x34, 0xa5, 0x11, 0xbb, 0x3e, 0xa9, 0x13, 0x0b, 0xa0,
+    0x5b, 0xb6, 0xe1, 0xbe, 0x7a, 0xde, 0xdd, 0xd9, 0xc7, 0xbb, 0x8f, 0x5c, 0x74, 0x7f, 0x3d, 0x69,
+    0xb7, 0xfd, 0xe5, 0xa1, 0xd9, 0x12, 0x44, 0x6b, 0xb5, 0x60, 0xa4, 0xb4, 0xa1, 0x83, 0xe7, 0x09,
+    0x49, 0x43, 0x4f, 0x48, 0x48, 0x2f, 0x4e, 0x89, 0x47, 0xaf, 0x3a, 0xe6, 0xd7, 0x5e, 0x0d, 0x8c,
+    0x5a, 0x9f, 0x06, 0x9f, 0x36, 0x3e, 0x17, 0xfb, 0x2e, 0xb6, 0xa7, 0xe9, 0x59, 0x87, 0x71, 0x6f,
+    0x3a, 0x26, 0xfc, 0x45, 0x23, 0xdc, 0x47, 0x27, 0xd4, 0xbc, 0xda, 0x94, 0x36, 0x6a, 0xa5, 0xf8,
+    0x5e, 0x43, 0x1f, 0xb3, 0xfa, 0xb0, 0x3f, 0xfc, 0xc0, 0x70, 0x5b, 0x68, 0x13, 0xd2, 0xc0, 0x2b,
+    0x23, 0x96, 0x33, 0x82, 0x9b, 0x69, 0x38, 0xbc, 0x4c, 0x8f, 0xf1, 0xa2, 0xe2, 0x99, 0x0a, 0xe7,
+    0x51, 0xac, 0x8a, 0xaf, 0x00, 0xa3, 0x3a, 0x01, 0xab, 0x0e, 0x31, 0xba, 0xd5, 0x71, 0x9d, 0xc1,
+    0x61, 0xc2, 0xc7, 0x51, 0x34, 0x4a, 0x04, 0xef, 0x72, 0x49, 0x08, 0x7a, 0x6f, 0x1c, 0xd2, 0xce,
+    0x67, 0x05, 0xd3, 0xbd, 0xfe, 0x38, 0x1a, 0x6f, 0xd4, 0xba, 0xa8, 0x1c, 0x44, 0x3d, 0x41, 0xa8,
+    0x5f, 0xe5, 0x57, 0x79, 0x71, 0x93, 0x4f, 0x61, 0x66, 0x4b, 0x53, 0x59, 0x19, 0x44, 0x1c, 0x0f,
+    0xf1, 0xbc, 0x24, 0x38, 0x2e, 0x3d, 0x1b, 0xeb, 0x33, 0x99, 0x5f, 0x75, 0xc2, 0x70, 0x10, 0xe8,
+    0x43, 0x9e, 0x03, 0xfd, 0x27, 0x30, 0xba, 0x21, 0xc0, 0xce, 0x25, 0xad, 0x59, 0x91, 0x67, 0x5b,
+    0x76, 0x25, 0xb6, 0x35, 0xd3, 0x26, 0x93, 0xb2, 0x5a, 0xe6, 0xb0, 0x5a, 0x34, 0x15, 0x03, 0x07,
+    0x84, 0xee, 0x10, 0x5a, 0xea, 0x26, 0xc3, 0x3a, 0x47, 0xbf, 0xfe, 0x61, 0xfb, 0xc6, 0x59, 0x2e,
+    0x6e, 0xd8, 0xb2, 0x28, 0xa0, 0x0b, 0x4c, 0xd9, 0x46, 0xf0, 0xbc, 0xc6, 0xbf, 0x98, 0xa9, 0x04,
+    0x4e, 0x01, 0x09, 0xfc, 0x03, 0x19, 0x6a, 0x8c, 0xe8, 0xaf, 0x6a, 0xd4, 0x1a, 0x9a, 0x27, 0xfa,
+    0x43, 0x19, 0xbd, 0xf3, 0x39, 0x3e, 0x78, 0x00, 0xbd, 0xef, 0x6f, 0x8f, 0x9c, 0xd9, 0x2f, 0xc5,
+    0x35, 0xd3, 0x1f, 0x38, 0xb8, 0xb3, 0xcf, 0x71, 0x0f, 0x3b, 0xdd, 0x7d, 0x9d, 0x21, 0x20, 0x60,
+    0xd8, 0x07, 0x26, 0x7c, 0xf5, 0xb3, 0x5f, 0x45, 0xd0, 0xd7, 0x0d, 0xc8, 0x2d, 0x08, 0x31, 0x8d,
+    0x89, 0x41, 0x94, 0x54, 0x47, 0x2b, 0x1a, 0xe1, 0x81, 0xb1, 0x2f, 0x96, 0xdf, 0x40, 0xcd, 0x16,
+    0xa3, 0x18, 0xc2, 0xb4, 0xbb, 0xc7, 0xb8, 0xea, 0xbe, 0x2b, 0x48, 0x2f, 0xae, 0xde, 0x51, 0xfb,
+    0xaa, 0xbf, 0xc0, 0x48, 0xa1, 0xc8, 0x53, 0xc2, 0xa5, 0x05, 0xeb, 0xe6, 0xc1, 0xc9, 0x9f, 0x44,
+    0x63, 0xa6, 0x35, 0xf3, 0x24, 0xe8, 0x9c, 0x15, 0x2f, 0xed, 0xaf, 0xbb, 0x49, 0x73, 0x54, 0xcd,
+    0x36, 0x4e, 0x7b, 0xcf, 0x68, 0x1d, 0xd1, 0xb1, 0x8f, 0xcd, 0xb0, 0x53, 0x34, 0x9f, 0x99, 0xad,
+    0x84, 0x02, 0xd6, 0x9d, 0x7d, 0x0c, 0xd3, 0x18, 0x05, 0xcc, 0x1f, 0x30, 0x51, 0x20, 0x30, 0xbf,
+    0x3f, 0x25, 0x75, 0x1f, 0x93, 0xeb, 0xb6, 0x38, 0xe0, 0xf8, 0x0f, 0x91, 0x0b, 0x67, 0x9a, 0x84,
+    0x47, 0x46, 0x1c, 0x43, 0xe9, 0x9e, 0x87, 0x15, 0xca, 0xa6, 0x8a, 0x8d, 0x39, 0xe2, 0x26, 0x3f,
+    0x99, 0xff, 0x14, 0xf6, 0xa0, 0xad, 0x0e, 0x61, 0xe5, 0x9b, 0x1a, 0x1a, 0x9c, 0xc8, 0x45, 0x49,
+    0x1d, 0x71, 0x46, 0x03, 0x1d, 0xea, 0xb0, 0x08, 0x62, 0xd2, 0x18, 0xd0, 0x3a, 0xe2, 0x57, 0x8d,
+    0x88, 0x82, 0x05, 0x77, 0x91, 0x89, 0x38, 0x2b, 0x2e, 0xc3, 0xe0, 0x1c, 0xbf, 0x38, 0x13, 0x55,
+    0x55, 0x54, 0x87, 0xf8, 0xe8, 0x1d, 0xb5, 0x5f, 0xa8, 0x51, 0xc7, 0xac, 0xcf, 0x84, 0x8d, 0xba,
+    0x60, 0xf8, 0x09, 0x26, 0xd8, 0x22, 0x7e, 0x0c, 0x61, 0xff, 0x5a, 0xeb, 0x88, 0x95, 0x45, 0x96,
+    0x61, 0x77, 0x4f, 0x66, 0x5f, 0x35, 0x60, 0xb7, 0x37, 0x6b, 0x28, 0xcc, 0x75, 0x9b, 0x0f, 0x41,
+    0x95, 0x6f, 0xf0, 0xef, 0xbe, 0x52, 0xf0, 0x3d, 0x32, 0x42, 0x04, 0xc7, 0xeb, 0xf6, 0x6a, 0x68,
+    0x83, 0x74, 0xdd, 0xff, 0x46, 0x93, 0x0b, 0x23, 0x73, 0xae, 0x07, 0x2d, 0x42, 0xe4, 0xe1, 0x82,
+    0x7f, 0x9e, 0xe6, 0x4a, 0x54, 0x90, 0xfa, 0xc2, 0x4e, 0x63, 0xfb, 0xec, 0xf1, 0xd3, 0xf9, 0x7c,
+    0x4e, 0x77, 0x4f, 0x0e, 0xdd, 0xa2, 0xec, 0x93, 0x75, 0xa8, 0x7e, 0xcf, 0x92, 0x4c, 0xf0, 0xaa,
+    0xa5, 0xd6, 0x2d, 0x1d, 0x0d, 0xb9, 0x65, 0xb7, 0x40, 0x19, 0x09, 0x60, 0x43, 0x56, 0xdc, 0xc4,
+    0xf4, 0xa4, 0x7b, 0x0e, 0xae, 0x9d, 0x08, 0xf7, 0x59, 0x56, 0x0b, 0x07, 0x91, 0xc0, 0xab, 0x1d,
+    0x98, 0x30, 0x30, 0x72, 0xd3, 0x71, 0x48, 0xff, 0x1e, 0x7b, 0x7e, 0x57, 0xba, 0xbf, 0x36, 0x1f,
+    0x9c, 0x78, 0x27, 0x38, 0xf2, 0x14, 0xfd, 0x97, 0xe7, 0x5f, 0x9c, 0xc5, 0x94, 0xae, 0x42, 0x81,
+    0xcd, 0x38, 0x8f, 0xda, 0x54, 0x79, 0xbb, 0x7b, 0x0f, 0xf0, 0x38, 0x4a, 0xac, 0xb4, 0xc7, 0xfb,
+    0x48, 0x6a, 0x63, 0x72, 0x09, 0x16, 0x39, 0xd9, 0x0c, 0x5e, 0x01, 0xd2, 0x2b, 0x9f, 0xaf, 0x3d,
+    0xb0, 0xa1, 0xee, 0x53, 0xe0, 0xc1, 0xd2, 0x9e, 0xeb, 0x63, 0x47, 0x7b, 0xff, 0x0f, 0x07, 0xb9,
+    0x17, 0xd8, 0x49, 0x38, 0x00, 0x00,
+};
+
+#define ASSET_APP_JS_ETAG "4bbe6c8c120711fd"
+
+// index.html: 43348 bytes, 8666 gzipped
+static const uint8_t ASSET_INDEX_HTML[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xdd, 0x6f, 0x24, 0xb9,
+    0x76, 0xdf, 0xfb, 0xfe, 0x15, 0x65, 0x04, 0xb8, 0xbd, 0x8b, 0x6c, 0xcf, 0x48, 0x2d, 0x69, 0x46,
+    0xbb, 0x3b, 0x23, 0xa3, 0xd5, 0xdd, 0xfa, 0x18, 0xf5, 0xd7, 0x74, 0xb7, 0xa4, 0x99, 0x79, 0x11,
+    0x58, 0x55, 0xec, 0x2e, 0x4e, 0x57, 0x15, 0x7b, 0xeb, 0x43, 0x52, 0x0b, 0x7e, 0x49, 0x82, 0xd8,
+    0x86, 0x61, 0x5f, 0xc3, 0xbb, 0x71, 0x60, 0x04, 0x08, 0x6e, 0x1e, 0x1c, 0xdc, 0x20, 0x8e, 0x81,
+    0xeb, 0x87, 0x00, 0xc9, 0x43, 0x6c, 0x20, 0x7f, 0xca, 0xfe, 0x03, 0xb9, 0x7f, 0x42, 0xce, 0x21,
+    0xeb, 0xab, 0x25, 0x91, 0x6c, 0x69, 0xb5, 0x31, 0x10, 0xe8, 0x45, 0x6a, 0x9e, 0xe2, 0x8f, 0x3c,
+    0x3c, 0x3c, 0x3c, 0xe7, 0x90, 0x45, 0xb2, 0xde, 0x78, 0x49, 0xe0, 0xef, 0xbd, 0xf1, 0x28, 0x71,
+    0xf7, 0xde, 0x24, 0x2c, 0xf1, 0xe9, 0xde, 0x84, 0x85, 0xcb, 0x84, 0xc7, 0x9e, 0xf5, 0x47, 0xd6,
+    0x39, 0xb5, 0xad, 0x21, 0x09, 0xa9, 0xff, 0xe6, 0xa5, 0x7c, 0xf6, 0xc5, 0x9b, 0x80, 0x26, 0xc4,
+    0x0a, 0x49, 0x40, 0xdf, 0xd6, 0x2e, 0x19, 0xbd, 0x5a, 0xf0, 0x28, 0xa9, 0x59, 0x0e, 0x0f, 0x13,
+    0x1a, 0x26, 0x6f, 0x6b, 0x57, 0xcc, 0x4d, 0xbc, 0xb7, 0x2e, 0xbd, 0x64, 0x0e, 0xad, 0x8b, 0xc4,
+    0xd7, 0x16, 0x0b, 0x59, 0xc2, 0x88, 0x5f, 0x8f, 0x1d, 0xe2, 0xd3, 0xb7, 0x9b, 0xb5, 0x3d, 0x59,
+    0x86, 0xe3, 0x91, 0x28, 0xa6, 0x80, 0x39, 0x9d, 0x1c, 0xd4, 0x77, 0x6b, 0x50, 0xb4, 0xcf, 0xc2,
+    0xb9, 0x15, 0x51, 0xff, 0x6d, 0x2d, 0x4e, 0x96, 0x3e, 0x8d, 0x3d, 0x4a, 0xa1, 0x6c, 0x2f, 0xa2,
+    0xd3, 0xb7, 0xb5, 0x97, 0x64, 0xb1, 0x78, 0xe1, 0xc4, 0xf1, 0x1f, 0x5e, 0xbe, 0xdd, 0xd9, 0xde,
+    0x9c, 0x6e, 0x11, 0x77, 0xc3, 0xde, 0x70, 0xe8, 0x37, 0xdb, 0xb6, 0x83, 0xd0, 0x97, 0xb2, 0x01,
+    0x36, 0x77, 0x97, 0x7b, 0x6f, 0x5c, 0x76, 0x69, 0x39, 0x3e, 0x89, 0xe3, 0xb7, 0x35, 0x64, 0x8c,
+    0xb0, 0x90, 0x46, 0x90, 0xe9, 0x8b, 0xea, 0x03, 0x28, 0xae, 0x8e, 0x18, 0x7c, 0x92, 0x37, 0xf8,
+    0xcd, 0x4b, 0xc8, 0xb0, 0xb7, 0x92, 0x6d, 0x81, 0x8d, 0xb7, 0x64, 0xc6, 0xba, 0x48, 0xd4, 0x64,
+    0xf9, 0xcc, 0x7d, 0x5b, 0x4b, 0x58, 0x40, 0xeb, 0x2e, 0x8b, 0x17, 0x3e, 0x59, 0xd6, 0xf6, 0xea,
+    0xf5, 0x6f, 0xeb, 0xf5, 0xbc, 0x08, 0xaf, 0x21, 0x72, 0xf8, 0xdc, 0x21, 0x09, 0xe3, 0x61, 0x9d,
+    0x85, 0x53, 0x5e, 0xdb, 0xfb, 0xfd, 0x6f, 0x7e, 0xfc, 0x0b, 0x60, 0xb5, 0xb1, 0x5a, 0x07, 0x73,
+    0x41, 0x74, 0x2c, 0x59, 0xd6, 0x6d, 0x7e, 0x5d, 0xbb, 0xfd, 0xa8, 0x9e, 0xd0, 0x6b, 0x10, 0x02,
+    0x16, 0x96, 0x49, 0x95, 0xb9, 0xc0, 0xc2, 0x5d, 0x4e, 0xd9, 0xa2, 0x92, 0x15, 0x12, 0xc4, 0x75,
+    0x23, 0x1a, 0xc7, 0xab, 0x79, 0xf1, 0xd9, 0xc2, 0xa9, 0xa3, 0xa0, 0xeb, 0x71, 0x42, 0x92, 0x34,
+    0xae, 0xe5, 0x78, 0x99, 0xac, 0xdb, 0xc4, 0x9d, 0xd1, 0x12, 0x24, 0xfe, 0x65, 0x89, 0x2f, 0xde,
+    0x4c, 0x79, 0x14, 0x58, 0xd0, 0x79, 0x1e, 0x87, 0x72, 0x66, 0xd8, 0x39, 0xc4, 0xc1, 0xe6, 0x41,
+    0xf7, 0xc4, 0xe4, 0x92, 0x0a, 0x19, 0xff, 0x41, 0xbd, 0x6e, 0xb5, 0x78, 0x60, 0x83, 0xd0, 0x5d,
+    0xeb, 0xd0, 0xe7, 0x36, 0xf1, 0xad, 0x31, 0x4d, 0x12, 0x16, 0xce, 0x62, 0xeb, 0x57, 0x56, 0x37,
+    0x93, 0x88, 0x54, 0x2b, 0xab, 0x5e, 0xbf, 0x47, 0xde, 0x50, 0xbd, 0xb7, 0xb5, 0x42, 0xa9, 0x0b,
+    0xed, 0xab, 0xed, 0xdd, 0x2a, 0x0f, 0x64, 0xb9, 0x85, 0x7a, 0x43, 0x6c, 0xea, 0xef, 0xb5, 0x09,
+    0x28, 0xd5, 0x78, 0x19, 0x3a, 0xd6, 0x31, 0x28, 0x63, 0x74, 0x09, 0xf9, 0xbe, 0xec, 0xb1, 0x30,
+    0xfe, 0xea, 0xdb, 0x37, 0x2f, 0x65, 0x8e, 0x37, 0x2c, 0x5c, 0xa4, 0x89, 0x95, 0x2c, 0x17, 0xa0,
+    0xbc, 0x61, 0x1a, 0xd8, 0xd0, 0xf9, 0x99, 0x2a, 0x83, 0x8e, 0x81, 0xb4, 0xbc, 0x8b, 0x80, 0x85,
+    0xb5, 0xbc, 0xc4, 0x42, 0x87, 0x3c, 0xea, 0xcc, 0xa1, 0x6f, 0xea, 0x92, 0x1a, 0x24, 0xf5, 0x8d,
+    0x9a, 0x25, 0x34, 0xf4, 0x6d, 0x2d, 0x20, 0xd1, 0x8c, 0x85, 0xf5, 0x84, 0x2f, 0xbe, 0xb5, 0x36,
+    0x37, 0x16, 0xd7, 0xd6, 0x1f, 0xb0, 0x00, 0x87, 0x04, 0x09, 0x93, 0xef, 0x6a, 0xab, 0x15, 0xe6,
+    0xc5, 0xc8, 0x1e, 0x22, 0x69, 0xc2, 0x5b, 0x4b, 0x07, 0x1a, 0x95, 0x71, 0x80, 0x84, 0x0b, 0x47,
+    0x52, 0x80, 0xf7, 0x14, 0x48, 0x30, 0x54, 0x2c, 0x91, 0xc7, 0x1a, 0x3b, 0x11, 0xa5, 0x61, 0x6c,
+    0x35, 0x21, 0x53, 0x00, 0xf2, 0x83, 0x91, 0xe4, 0x2f, 0xf3, 0x66, 0x7d, 0xf1, 0x66, 0x91, 0xb3,
+    0xea, 0x51, 0x5f, 0xaa, 0x81, 0xe4, 0x72, 0xef, 0x78, 0x6a, 0x81, 0x7e, 0x12, 0xdb, 0xa7, 0xee,
+    0xd7, 0x56, 0x9c, 0x15, 0x72, 0xc5, 0x7c, 0xdf, 0xe2, 0xa1, 0xbf, 0xc4, 0x21, 0x18, 0xce, 0xa8,
+    0x75, 0xe5, 0xd1, 0xd0, 0x5a, 0xf2, 0xd4, 0x5a, 0xa0, 0xc6, 0x58, 0x89, 0x47, 0x2d, 0x3b, 0x4d,
+    0x12, 0x1e, 0xbe, 0x78, 0xf3, 0x72, 0x51, 0xc8, 0x57, 0xf2, 0x90, 0x31, 0x54, 0x8a, 0x78, 0x4c,
+    0x1d, 0x93, 0x88, 0xb1, 0xbd, 0xb2, 0x72, 0x80, 0x1d, 0x63, 0x86, 0xbc, 0xd1, 0x92, 0x7a, 0xc1,
+    0xc2, 0x44, 0xe8, 0xce, 0x8a, 0xd8, 0x49, 0xc8, 0x02, 0x29, 0xf2, 0xda, 0x5e, 0x13, 0xd4, 0xec,
+    0x92, 0x5a, 0x4d, 0x20, 0x09, 0xed, 0x89, 0xbf, 0x35, 0x37, 0xfe, 0x56, 0x17, 0xd9, 0x1c, 0x5a,
+    0x14, 0xc8, 0x5e, 0xfa, 0x4e, 0x48, 0xa6, 0xd6, 0xe7, 0x21, 0x08, 0x9b, 0xc5, 0x56, 0x1a, 0x8a,
+    0xce, 0x11, 0x42, 0xa2, 0x3e, 0x75, 0x12, 0x10, 0x09, 0x73, 0x3c, 0x8b, 0x14, 0xf5, 0x59, 0x09,
+    0xb7, 0x44, 0xe7, 0x80, 0x74, 0x22, 0x9e, 0xce, 0xbc, 0x4c, 0x34, 0x55, 0x8b, 0x82, 0xfc, 0xce,
+    0x22, 0x1c, 0x9e, 0x5f, 0xac, 0x88, 0xc1, 0x63, 0x2e, 0x8c, 0x70, 0x29, 0x86, 0x29, 0x0b, 0x89,
+    0xdf, 0x23, 0xf1, 0xbc, 0xe8, 0x76, 0x40, 0x5d, 0x04, 0x82, 0x90, 0xf5, 0xfa, 0xc6, 0x1d, 0x05,
+    0x14, 0x25, 0xb3, 0x84, 0x06, 0x7a, 0x8d, 0x82, 0x5c, 0xb2, 0x45, 0x59, 0x63, 0xc0, 0xdc, 0xfc,
+    0x87, 0xbf, 0xb3, 0x90, 0x54, 0x0a, 0xeb, 0x81, 0xe5, 0x56, 0x33, 0x3a, 0x5e, 0xc9, 0x63, 0xa3,
+    0xb6, 0xf7, 0xd3, 0x1f, 0xff, 0xbb, 0xff, 0xf3, 0x3f, 0xfe, 0xd2, 0x1a, 0xfb, 0x60, 0xbe, 0xac,
+    0x23, 0x1e, 0xb1, 0x1b, 0x34, 0xb5, 0xfe, 0x93, 0x57, 0xb5, 0x8d, 0x55, 0xfd, 0x75, 0x59, 0xd5,
+    0x19, 0x8d, 0x84, 0xfe, 0x3f, 0x79, 0x45, 0xbb, 0x68, 0x9f, 0xff, 0xea, 0x1f, 0xad, 0x36, 0x8b,
+    0x63, 0xee, 0x83, 0xb6, 0x7d, 0xd9, 0xe7, 0x2c, 0xa6, 0x5f, 0x3d, 0x79, 0x45, 0x9b, 0xaf, 0xb0,
+    0xa6, 0x5f, 0xff, 0xbd, 0xd5, 0x4a, 0x23, 0x74, 0x4e, 0xd6, 0x60, 0x41, 0xc3, 0x27, 0xaf, 0x65,
+    0xab, 0x21, 0x6a, 0xf9, 0x9f, 0x20, 0xb0, 0x90, 0x82, 0xff, 0x0d, 0xad, 0x7d, 0x30, 0xfb, 0x6e,
+    0x5c, 0x56, 0x94, 0x5b, 0x75, 0x99, 0x9e, 0x80, 0x33, 0xb3, 0x0e, 0xc0, 0xc0, 0x93, 0xa4, 0x1c,
+    0xcd, 0x15, 0xf5, 0x8e, 0x88, 0xcb, 0x38, 0xe8, 0x37, 0x4f, 0x17, 0x77, 0x14, 0x54, 0x3e, 0xcb,
+    0xc6, 0xea, 0x0a, 0x9f, 0xe2, 0x49, 0xae, 0xeb, 0xe8, 0x2f, 0x2f, 0xa6, 0xa2, 0x8a, 0x52, 0x93,
+    0xa0, 0x7f, 0xad, 0xc6, 0x76, 0xfd, 0x88, 0xa7, 0x91, 0x42, 0x06, 0x3f, 0xa3, 0xf4, 0x4d, 0x10,
+    0x82, 0xb5, 0xd9, 0x58, 0x29, 0x3d, 0x77, 0x6d, 0x77, 0xed, 0x46, 0x6d, 0x4f, 0xb6, 0xdf, 0x22,
+    0xd3, 0x29, 0x18, 0x81, 0xd8, 0x02, 0x9b, 0xe1, 0x09, 0x73, 0x38, 0xe8, 0x76, 0xda, 0x56, 0xe6,
+    0xe9, 0xc1, 0x2a, 0xb8, 0x82, 0x58, 0x04, 0x47, 0xd2, 0x16, 0x80, 0xd3, 0x8f, 0xee, 0x18, 0xb1,
+    0xfb, 0x7c, 0x87, 0xc9, 0x2d, 0xb4, 0x69, 0x02, 0xb5, 0xaf, 0xf8, 0x05, 0x37, 0x23, 0x55, 0x1c,
+    0x83, 0xcc, 0x55, 0xfa, 0xd3, 0x15, 0xd7, 0x60, 0x7d, 0x79, 0x3c, 0xfc, 0x6a, 0x0d, 0xff, 0x70,
+    0x1a, 0xd3, 0x18, 0x2d, 0x7f, 0x64, 0x1d, 0x0f, 0xad, 0x2c, 0x62, 0x40, 0x53, 0x87, 0xf5, 0x45,
+    0xe0, 0x0b, 0xa9, 0xe5, 0x40, 0x60, 0xf2, 0x35, 0xc4, 0x77, 0x3c, 0x72, 0xc1, 0x74, 0x25, 0x34,
+    0xfe, 0x5a, 0xb6, 0x1f, 0x84, 0x0d, 0x03, 0x9e, 0x66, 0x66, 0x70, 0xca, 0xa8, 0xef, 0x42, 0x30,
+    0x27, 0xda, 0x10, 0x90, 0x30, 0x25, 0xfe, 0x81, 0x20, 0xd5, 0xca, 0x40, 0xcc, 0xf7, 0xc9, 0x22,
+    0x66, 0x36, 0xba, 0x71, 0x10, 0x12, 0x9d, 0xd1, 0xd0, 0xdd, 0xeb, 0x89, 0xac, 0x65, 0x23, 0x3a,
+    0x61, 0x12, 0xa1, 0x5f, 0x93, 0x4f, 0x73, 0xd5, 0x6c, 0x01, 0x0f, 0x56, 0x1f, 0xa4, 0x71, 0xbf,
+    0x9b, 0x91, 0x61, 0x8f, 0x94, 0x16, 0xb2, 0x7b, 0x2b, 0x86, 0x72, 0x49, 0xec, 0xd9, 0x9c, 0x44,
+    0xae, 0x30, 0xce, 0x59, 0xc3, 0xbf, 0xb0, 0xac, 0x37, 0x22, 0xb4, 0x59, 0xe9, 0x2d, 0xf9, 0xac,
+    0x0b, 0xbc, 0x24, 0xa9, 0x4b, 0xf5, 0x4e, 0x2d, 0x4e, 0xe8, 0x02, 0x87, 0xdd, 0x32, 0xaf, 0xda,
+    0xcf, 0x60, 0x45, 0xf0, 0xa4, 0xab, 0x82, 0x87, 0xb3, 0x47, 0xd5, 0x91, 0xe3, 0x6e, 0x45, 0x68,
+    0xd5, 0x41, 0x8c, 0xdd, 0x52, 0x16, 0x9b, 0xf9, 0xb3, 0x72, 0x88, 0xe0, 0x63, 0x94, 0x10, 0x5f,
+    0x08, 0x89, 0x67, 0x1a, 0xd5, 0x9c, 0x46, 0xa0, 0x39, 0x2f, 0x9b, 0x36, 0x73, 0x3f, 0x13, 0x08,
+    0x81, 0x56, 0xd3, 0x6f, 0x5e, 0xca, 0xdc, 0x4a, 0x98, 0xe3, 0x44, 0xa4, 0x04, 0x61, 0xca, 0x08,
+    0xf1, 0x67, 0x8c, 0x46, 0x71, 0x09, 0x92, 0x69, 0x13, 0x6c, 0x1f, 0x8c, 0x33, 0x49, 0x0b, 0x94,
+    0x4c, 0x9a, 0x40, 0x2d, 0xc2, 0x22, 0x5e, 0x60, 0x44, 0xca, 0x0c, 0xc1, 0xa8, 0x89, 0x84, 0x0e,
+    0xa9, 0xe0, 0x72, 0x92, 0x11, 0x4c, 0xd3, 0xa4, 0x82, 0xc3, 0x94, 0x09, 0xd2, 0xf1, 0x2f, 0x9a,
+    0x84, 0xa5, 0xa5, 0xe4, 0x73, 0x82, 0x09, 0xf8, 0x8e, 0x43, 0x0c, 0x17, 0xd2, 0xd8, 0x4e, 0xa3,
+    0x59, 0x01, 0xae, 0x12, 0x8d, 0x05, 0xa4, 0x76, 0xc9, 0x2b, 0x26, 0x4c, 0x80, 0x13, 0x98, 0xb7,
+    0x25, 0x3c, 0x0d, 0x0a, 0x50, 0x4e, 0x30, 0x01, 0xbb, 0x64, 0xc6, 0xcb, 0x0e, 0x17, 0x29, 0x13,
+    0xa4, 0x47, 0x60, 0x50, 0x94, 0x5d, 0x27, 0x93, 0x46, 0x10, 0x0f, 0x23, 0x7e, 0xc9, 0xca, 0x56,
+    0xe5, 0x04, 0x13, 0xb0, 0x8f, 0x9a, 0x61, 0xb3, 0x02, 0x97, 0xa5, 0x8d, 0x30, 0x18, 0x22, 0x01,
+    0x0d, 0xcb, 0xfa, 0x72, 0x82, 0x09, 0x38, 0x26, 0xfc, 0x62, 0xc2, 0x03, 0x5a, 0x00, 0x73, 0x82,
+    0x09, 0x38, 0x89, 0xd8, 0x82, 0xfb, 0x25, 0xa3, 0x59, 0xda, 0x08, 0x4b, 0x43, 0x56, 0x76, 0x80,
+    0x48, 0x99, 0x20, 0xe7, 0x10, 0x32, 0x78, 0x9c, 0xce, 0x0b, 0x54, 0x4e, 0x50, 0x03, 0x03, 0x2a,
+    0x07, 0xb4, 0x4b, 0x10, 0x55, 0x49, 0x99, 0x21, 0x10, 0x86, 0xf3, 0x88, 0xe0, 0xfc, 0xf3, 0x0e,
+    0xc9, 0x0c, 0x86, 0x5c, 0x29, 0x44, 0x53, 0xa4, 0x02, 0xce, 0x49, 0x6b, 0x80, 0x67, 0x38, 0x07,
+    0x0f, 0xc1, 0xa2, 0xa4, 0x34, 0xe4, 0xf1, 0x45, 0x93, 0x81, 0x2b, 0xac, 0x96, 0x74, 0xdf, 0x73,
+    0x63, 0xb1, 0xfb, 0x7c, 0xc6, 0x93, 0x0a, 0x43, 0x32, 0x6d, 0x84, 0xb5, 0x48, 0x44, 0x1c, 0x52,
+    0xa9, 0x3e, 0x23, 0x98, 0x81, 0x30, 0x6b, 0x81, 0x61, 0x55, 0x01, 0x4a, 0x82, 0x11, 0xd8, 0xa6,
+    0xe1, 0x25, 0xae, 0x84, 0xac, 0xa6, 0x8d, 0xb0, 0x8e, 0x1b, 0x40, 0xd0, 0xcf, 0xc3, 0x12, 0x98,
+    0x53, 0xcc, 0x50, 0xff, 0x62, 0x4c, 0xfc, 0x4b, 0xe2, 0xf2, 0x4a, 0xb5, 0x15, 0xa2, 0xb1, 0x80,
+    0x43, 0xee, 0x26, 0x1e, 0xb1, 0x4b, 0x70, 0x46, 0x30, 0x03, 0x53, 0x08, 0x63, 0x02, 0xe2, 0x57,
+    0xfa, 0xa5, 0x20, 0x19, 0xc1, 0x47, 0xc4, 0x67, 0x53, 0x72, 0x5d, 0x42, 0x33, 0xc2, 0x1a, 0xc0,
+    0x4b, 0x52, 0xd5, 0x4d, 0x99, 0x36, 0xc2, 0xde, 0x91, 0x80, 0x30, 0xa7, 0x82, 0xcb, 0x08, 0x46,
+    0x60, 0x97, 0x5c, 0x0c, 0xc9, 0x4d, 0x89, 0x93, 0x69, 0x33, 0x0c, 0x26, 0xbc, 0x15, 0x10, 0xa4,
+    0xcc, 0x10, 0x1c, 0x0e, 0xe1, 0x0c, 0xe2, 0x8c, 0x8a, 0xc6, 0x56, 0x88, 0xc6, 0x02, 0x7a, 0xf4,
+    0x9a, 0x39, 0xfc, 0xa2, 0x25, 0x42, 0xb7, 0x7b, 0x88, 0xe6, 0x02, 0x70, 0xf5, 0xf1, 0x12, 0x26,
+    0x87, 0x15, 0xcd, 0x2f, 0x69, 0x46, 0x78, 0x9f, 0x5e, 0x5d, 0x7c, 0xe4, 0x51, 0xc5, 0x5a, 0xe5,
+    0x14, 0x23, 0x74, 0x08, 0xa6, 0x30, 0x64, 0x15, 0x75, 0xc8, 0x08, 0x66, 0x20, 0x8f, 0x92, 0x3a,
+    0x49, 0xeb, 0xc3, 0x88, 0x85, 0x4e, 0xc5, 0xde, 0xad, 0xd2, 0xcd, 0xc5, 0xa4, 0x30, 0x1b, 0xe6,
+    0x17, 0x23, 0x10, 0x55, 0xa5, 0x8c, 0x92, 0x68, 0x2c, 0x60, 0x4c, 0xc0, 0xac, 0xad, 0x98, 0x8c,
+    0x9c, 0xb2, 0x06, 0x94, 0x83, 0x4a, 0xa5, 0xfe, 0x0a, 0x36, 0x23, 0x99, 0xc1, 0xc9, 0x05, 0x04,
+    0x29, 0x61, 0x45, 0x63, 0x72, 0x8a, 0x11, 0x3a, 0x61, 0x9f, 0xd3, 0x95, 0xa1, 0x94, 0x11, 0xcc,
+    0x40, 0x1e, 0xa1, 0x6d, 0xaa, 0x00, 0x25, 0xc1, 0x08, 0x3c, 0x83, 0xa0, 0x8f, 0xa7, 0x2b, 0x06,
+    0xb2, 0x20, 0xa9, 0xc1, 0x61, 0x42, 0x22, 0x27, 0x11, 0x1d, 0x42, 0xfc, 0x40, 0x80, 0x6f, 0x93,
+    0xd4, 0xe0, 0x98, 0x61, 0x48, 0x0c, 0xf3, 0x39, 0x1c, 0x12, 0x65, 0xc2, 0x00, 0x08, 0x02, 0x11,
+    0xbb, 0x17, 0xbf, 0x0d, 0xd9, 0x43, 0xe2, 0x2e, 0xa3, 0x3c, 0xbf, 0x48, 0x18, 0x00, 0xb1, 0x37,
+    0x23, 0x36, 0x4c, 0xaf, 0xf7, 0x56, 0x92, 0x06, 0x50, 0xb2, 0x8c, 0x44, 0xc4, 0x5e, 0x26, 0xf4,
+    0x80, 0x7d, 0x32, 0xf3, 0x5c, 0xe2, 0x66, 0x88, 0x2c, 0x65, 0x82, 0xcc, 0xd3, 0x22, 0xff, 0xdc,
+    0x58, 0x7e, 0x38, 0x9b, 0xf3, 0x79, 0x91, 0x5f, 0xa4, 0x4c, 0x90, 0x28, 0x04, 0xb5, 0x2e, 0x20,
+    0x22, 0x65, 0x80, 0x50, 0x16, 0xa5, 0xb9, 0xa4, 0x64, 0xc2, 0x00, 0x60, 0xb1, 0x37, 0xa7, 0x05,
+    0x5b, 0x32, 0xa5, 0x87, 0x80, 0x77, 0x17, 0xd1, 0x45, 0xf1, 0xdb, 0x90, 0x9d, 0xfb, 0x3c, 0xb0,
+    0x79, 0x0e, 0x90, 0x29, 0x3d, 0xa4, 0x0d, 0xde, 0x26, 0x76, 0xd2, 0x38, 0xc3, 0xe4, 0x49, 0x03,
+    0xc8, 0x23, 0xf3, 0x9c, 0x2d, 0xf1, 0xdb, 0x90, 0x1d, 0xe6, 0x1c, 0x2c, 0xcf, 0x8e, 0xbf, 0x4d,
+    0xd9, 0x63, 0x98, 0xdc, 0xd8, 0xb4, 0x40, 0xc8, 0xa4, 0x1e, 0x74, 0x00, 0x8c, 0xcf, 0xd2, 0xb8,
+    0x90, 0x56, 0x91, 0xd6, 0xc3, 0x0e, 0xc9, 0x4d, 0x8e, 0xc0, 0x9f, 0xfa, 0xcc, 0x47, 0x30, 0x37,
+    0xbf, 0x38, 0x81, 0x3f, 0x19, 0xa2, 0x48, 0x9b, 0x60, 0x97, 0x6e, 0x81, 0xb8, 0x34, 0x28, 0xfa,
+    0x71, 0x34, 0x4f, 0x93, 0x38, 0x57, 0x92, 0x2c, 0xa5, 0x87, 0xbc, 0x83, 0x0e, 0x88, 0x8a, 0x86,
+    0x67, 0x29, 0x13, 0x64, 0x09, 0x13, 0xad, 0xa8, 0xc4, 0xc8, 0xa4, 0x01, 0x44, 0xa3, 0x34, 0x26,
+    0x3e, 0xae, 0x54, 0xae, 0xa6, 0xf5, 0xb0, 0x13, 0x62, 0x17, 0x03, 0x4b, 0xfc, 0x36, 0x65, 0x0f,
+    0x1c, 0x8f, 0x24, 0x85, 0x7e, 0x15, 0x69, 0x13, 0x0c, 0x02, 0x68, 0x8f, 0x15, 0x20, 0x91, 0x32,
+    0x41, 0x12, 0x0f, 0x4c, 0xa8, 0x9b, 0x16, 0xa0, 0x2c, 0x6d, 0x80, 0x71, 0x7f, 0x4e, 0x0a, 0x71,
+    0x67, 0x29, 0x03, 0x24, 0x22, 0x71, 0xc8, 0x97, 0x24, 0x2a, 0x3a, 0xb6, 0x42, 0x31, 0x40, 0x53,
+    0x08, 0x5a, 0x2f, 0xba, 0x69, 0x00, 0xfd, 0x93, 0x63, 0x2b, 0x24, 0x3d, 0xb8, 0x47, 0x66, 0xc4,
+    0x2d, 0x1c, 0x46, 0x96, 0x32, 0x41, 0xe6, 0x24, 0x8e, 0x49, 0x54, 0x60, 0x64, 0xd2, 0x04, 0x0a,
+    0x99, 0x4f, 0x0a, 0x08, 0x26, 0xf4, 0x80, 0x3e, 0x44, 0x2e, 0x31, 0xcb, 0x11, 0x59, 0xca, 0x00,
+    0xe1, 0x97, 0x7c, 0x9e, 0xde, 0x84, 0xb4, 0x1c, 0x1d, 0x55, 0x92, 0x19, 0x1c, 0x33, 0x9b, 0x45,
+    0x2b, 0xd8, 0x8c, 0xa2, 0x87, 0x0e, 0x82, 0x02, 0x83, 0x3f, 0x0d, 0x99, 0x23, 0x92, 0xab, 0x3a,
+    0xfe, 0xd4, 0x67, 0x1e, 0x72, 0x8c, 0xc3, 0x42, 0x92, 0x17, 0x5f, 0xa4, 0x0d, 0xb0, 0x25, 0x58,
+    0x9c, 0x25, 0x29, 0xac, 0x50, 0x91, 0xd6, 0xc3, 0xde, 0x83, 0x96, 0xe6, 0xbd, 0x2a, 0x7e, 0xeb,
+    0xb3, 0x8f, 0xd8, 0x92, 0xb8, 0x5e, 0x96, 0x5f, 0x26, 0xf4, 0x80, 0x31, 0x99, 0x7b, 0x30, 0x53,
+    0xca, 0x95, 0x2d, 0x4f, 0x9a, 0x40, 0x01, 0x89, 0xe6, 0x30, 0xe6, 0x0a, 0x54, 0x96, 0x36, 0xc0,
+    0x28, 0x2f, 0x4c, 0x8a, 0xf8, 0x6d, 0xc8, 0x8e, 0x2f, 0x41, 0xbd, 0xc2, 0x05, 0xe5, 0x49, 0x03,
+    0x88, 0x85, 0x33, 0xb2, 0xe0, 0x51, 0xee, 0x86, 0x8a, 0xb4, 0x01, 0x16, 0x51, 0x37, 0xa4, 0x73,
+    0xee, 0x2f, 0x4b, 0xbd, 0x59, 0xa1, 0xe9, 0xe1, 0x13, 0xc2, 0x16, 0x34, 0x67, 0x54, 0x26, 0x4c,
+    0x00, 0x0c, 0x23, 0xc2, 0xa4, 0x80, 0xc8, 0xa4, 0x01, 0x64, 0x33, 0x9f, 0xc5, 0x45, 0x35, 0x32,
+    0x65, 0x80, 0x50, 0x2f, 0x2a, 0x2c, 0x89, 0x4c, 0x98, 0x00, 0xfe, 0x45, 0xf3, 0x92, 0x5d, 0x16,
+    0x10, 0x99, 0x34, 0x80, 0x3c, 0x16, 0x2c, 0xbc, 0xdc, 0x20, 0x67, 0x29, 0x03, 0x84, 0xcf, 0x97,
+    0x79, 0xc4, 0x23, 0x7e, 0x9b, 0xb2, 0x97, 0xfd, 0x22, 0x7e, 0xeb, 0xb3, 0x9f, 0xfa, 0x04, 0x62,
+    0x0f, 0x52, 0x19, 0x3b, 0x15, 0x8a, 0x01, 0x1a, 0xa5, 0xc1, 0xf7, 0xb9, 0x8c, 0x65, 0x42, 0x0f,
+    0x38, 0x63, 0x54, 0x18, 0x80, 0x5c, 0xe3, 0x8a, 0xb4, 0x01, 0xe6, 0x13, 0x97, 0x81, 0x31, 0x4b,
+    0x8a, 0x88, 0xb7, 0x42, 0xd1, 0x43, 0x3f, 0x92, 0x6a, 0xb0, 0x91, 0xa5, 0x4c, 0x90, 0x70, 0xc6,
+    0xc3, 0x02, 0x81, 0x09, 0x03, 0x80, 0x82, 0x7f, 0x84, 0x29, 0x55, 0x98, 0xad, 0x5f, 0xdf, 0xa1,
+    0x99, 0xe0, 0x11, 0xbd, 0x2c, 0x14, 0x2f, 0x4b, 0xa9, 0x21, 0x89, 0x8f, 0x93, 0x5b, 0xe7, 0x65,
+    0xf3, 0x86, 0xcb, 0xe5, 0xbd, 0x55, 0x82, 0x19, 0xd8, 0x02, 0x03, 0x1c, 0x2d, 0x2b, 0x40, 0x49,
+    0x58, 0x07, 0xb8, 0xa0, 0x17, 0x67, 0x34, 0xc2, 0x37, 0x37, 0xf7, 0x10, 0xcd, 0x05, 0xf4, 0x88,
+    0x0b, 0x93, 0x08, 0x52, 0x41, 0x67, 0x14, 0x33, 0x74, 0x44, 0x97, 0xf3, 0xcf, 0xe4, 0x92, 0xcd,
+    0x2b, 0xe0, 0x82, 0xa6, 0x86, 0x43, 0x78, 0x0c, 0x4e, 0x0a, 0x27, 0x6d, 0x2e, 0xf5, 0x09, 0x13,
+    0x9c, 0xdf, 0xa1, 0xad, 0x01, 0xdf, 0x8f, 0x58, 0x6c, 0x4b, 0xbd, 0xbd, 0x43, 0x5b, 0x0b, 0xce,
+    0xc1, 0x64, 0x5d, 0x1c, 0x31, 0xdf, 0x5f, 0x2d, 0xa1, 0x20, 0xaf, 0x51, 0x48, 0x9b, 0x44, 0x57,
+    0xc2, 0xf9, 0xdc, 0xa2, 0xac, 0x01, 0xed, 0xa4, 0x8e, 0x08, 0x5e, 0x56, 0x09, 0x6b, 0x00, 0x8f,
+    0xb8, 0x0d, 0xa1, 0x76, 0x15, 0x29, 0x29, 0x6b, 0x40, 0xbb, 0x3c, 0x72, 0x2f, 0x8e, 0xf8, 0xd5,
+    0x8a, 0xcc, 0x0a, 0xe2, 0x1a, 0x05, 0x0c, 0x69, 0x94, 0x78, 0x55, 0xb0, 0x20, 0xac, 0x01, 0x1c,
+    0x2f, 0xc1, 0x17, 0x2d, 0xab, 0x48, 0x49, 0x51, 0x42, 0x3b, 0x69, 0xc4, 0x17, 0xf4, 0x65, 0x33,
+    0x88, 0x61, 0xc8, 0xba, 0x04, 0xa2, 0xff, 0xdb, 0x14, 0x23, 0x34, 0x74, 0x79, 0x84, 0x9a, 0xbd,
+    0x9a, 0x36, 0xc2, 0x90, 0x41, 0x88, 0x22, 0xc2, 0x12, 0x98, 0x53, 0x8c, 0xd0, 0xc4, 0xa3, 0xb8,
+    0xf4, 0xb4, 0x92, 0x34, 0x81, 0xf6, 0xa9, 0x3f, 0x8b, 0x08, 0x8e, 0x82, 0x5b, 0x04, 0x33, 0x30,
+    0x12, 0x81, 0xcf, 0x4a, 0xd2, 0x08, 0x82, 0xc9, 0x53, 0x4c, 0xfd, 0x92, 0xc9, 0x9c, 0x60, 0x04,
+    0xa6, 0xb8, 0xaf, 0x92, 0xc6, 0x49, 0x89, 0xcc, 0x29, 0x66, 0xa8, 0x0b, 0x06, 0x69, 0x05, 0x29,
+    0x09, 0x26, 0x60, 0xcb, 0x83, 0x00, 0x21, 0xc4, 0x45, 0x9e, 0x5b, 0x04, 0x23, 0x10, 0xfe, 0x84,
+    0x1e, 0x99, 0xd1, 0x52, 0x3c, 0x25, 0xc9, 0x04, 0x6e, 0xa7, 0x76, 0x55, 0xae, 0x32, 0x69, 0x02,
+    0x1d, 0x32, 0x1b, 0xd4, 0x5a, 0xf8, 0xeb, 0xdb, 0x14, 0x13, 0xf4, 0x08, 0xa4, 0xcf, 0xc2, 0x39,
+    0x2b, 0x90, 0x39, 0xc1, 0x04, 0x3c, 0x8e, 0x13, 0x88, 0x09, 0x30, 0x24, 0xbd, 0x45, 0x30, 0x01,
+    0x4f, 0x30, 0x44, 0x86, 0xc0, 0x32, 0xc2, 0xd5, 0xb0, 0xbb, 0x34, 0x23, 0x9c, 0xd1, 0xcb, 0x12,
+    0x07, 0x09, 0x33, 0x20, 0xe2, 0x55, 0x04, 0xa4, 0x4c, 0x90, 0x2e, 0xd8, 0x71, 0x5e, 0x76, 0x82,
+    0x4c, 0x1a, 0x41, 0x1c, 0x86, 0x78, 0x05, 0x24, 0x92, 0x46, 0x50, 0x7a, 0x4d, 0x03, 0x9b, 0x8b,
+    0x30, 0xe1, 0x0e, 0xc9, 0x04, 0x06, 0x5f, 0x29, 0x36, 0xe6, 0xad, 0x24, 0xcd, 0x20, 0x3f, 0x21,
+    0x15, 0x8c, 0x9f, 0x18, 0x8d, 0x12, 0xee, 0x37, 0x9d, 0x97, 0x10, 0x4c, 0x19, 0x21, 0x3c, 0x24,
+    0xb8, 0x7a, 0xbf, 0x92, 0x34, 0x83, 0x62, 0x87, 0x5f, 0x55, 0x40, 0x98, 0x34, 0x81, 0x06, 0xb1,
+    0x5f, 0xd6, 0x83, 0x09, 0x13, 0x60, 0x48, 0x22, 0x56, 0x5a, 0x20, 0x91, 0x32, 0x42, 0xf0, 0x95,
+    0x6b, 0x69, 0x23, 0x65, 0xd2, 0x04, 0x1a, 0xb1, 0x59, 0x29, 0x67, 0x4c, 0x18, 0x01, 0xe2, 0xa5,
+    0x79, 0x25, 0x61, 0x02, 0x88, 0x99, 0x63, 0x59, 0x87, 0x4c, 0x9a, 0x41, 0x11, 0x49, 0x2a, 0x03,
+    0x22, 0x4b, 0x1b, 0x61, 0x2c, 0x98, 0x52, 0xf8, 0xc5, 0xcb, 0x01, 0x5f, 0x92, 0x8c, 0x60, 0x3e,
+    0x65, 0x15, 0x3e, 0x31, 0x65, 0x84, 0x24, 0xdc, 0x99, 0x7b, 0xdc, 0x2f, 0x5d, 0x6f, 0x41, 0x31,
+    0x41, 0x27, 0xc4, 0x07, 0x6b, 0x52, 0x8e, 0xc4, 0x2c, 0x6d, 0x84, 0x41, 0xd8, 0x19, 0x96, 0x1d,
+    0x20, 0x93, 0x26, 0xd0, 0xa9, 0xbf, 0x24, 0x21, 0xbf, 0xac, 0x0c, 0x8f, 0x82, 0x62, 0x84, 0xde,
+    0x78, 0x33, 0x1e, 0xf1, 0x72, 0xfc, 0xe6, 0x04, 0x13, 0x10, 0xe7, 0x48, 0x61, 0x29, 0x4e, 0x99,
+    0x34, 0x83, 0xfc, 0x90, 0xa5, 0x71, 0x05, 0x25, 0xd2, 0x46, 0x18, 0xf7, 0x67, 0x7c, 0xc5, 0x54,
+    0x17, 0x14, 0x13, 0xf4, 0x9c, 0x44, 0x31, 0x29, 0x47, 0xb3, 0x4c, 0x9a, 0x40, 0x9f, 0x70, 0xb9,
+    0x81, 0xdf, 0x78, 0xcb, 0xb2, 0x23, 0x4a, 0x92, 0x11, 0x9c, 0x46, 0xcc, 0xf1, 0x4a, 0xa0, 0x48,
+    0x2a, 0x41, 0xc7, 0xa1, 0x0b, 0x13, 0x4d, 0xb4, 0x80, 0x30, 0x71, 0xc4, 0x79, 0xd3, 0x2d, 0x82,
+    0x19, 0x08, 0xe5, 0x27, 0x42, 0xa6, 0xb7, 0x29, 0x26, 0xe8, 0x88, 0xa6, 0x21, 0x43, 0x5f, 0xb1,
+    0x9a, 0x56, 0xc2, 0x86, 0xc4, 0x61, 0x53, 0x9c, 0xd0, 0xa5, 0xce, 0xdc, 0x17, 0x2b, 0x47, 0xb7,
+    0x29, 0x46, 0x68, 0xcb, 0x23, 0x89, 0x87, 0x81, 0xec, 0x2d, 0x82, 0x11, 0xd8, 0x21, 0x18, 0xf1,
+    0x96, 0x38, 0x99, 0x36, 0xc2, 0x0e, 0xd8, 0x67, 0x56, 0x82, 0x30, 0x65, 0x84, 0x1c, 0xf1, 0x90,
+    0xfb, 0xa9, 0x9f, 0x96, 0xb0, 0x9c, 0x62, 0x84, 0x82, 0x57, 0x07, 0xc1, 0xe3, 0x46, 0xd1, 0x12,
+    0x5c, 0xd2, 0x8c, 0xf0, 0x1e, 0xf9, 0x9c, 0xe2, 0x5e, 0xba, 0xd5, 0xb4, 0x19, 0xc6, 0xdc, 0x2b,
+    0x3c, 0x23, 0xb3, 0x9a, 0x36, 0xc2, 0xfa, 0x3c, 0x0d, 0x28, 0x29, 0x61, 0x32, 0x6d, 0x84, 0x0d,
+    0xc9, 0x0c, 0xdf, 0x43, 0xcf, 0x2a, 0x7c, 0x16, 0x24, 0x33, 0x98, 0x47, 0xc9, 0x45, 0x0f, 0x97,
+    0x03, 0xec, 0x0a, 0xc3, 0x55, 0xaa, 0xb1, 0x88, 0x09, 0x38, 0x8a, 0xab, 0x0a, 0xdb, 0x32, 0x6d,
+    0x86, 0xf1, 0x70, 0x46, 0x12, 0xb2, 0xa8, 0x74, 0x6b, 0x41, 0x32, 0x82, 0xcf, 0xc9, 0x9c, 0x96,
+    0x38, 0x4c, 0x55, 0x20, 0x2f, 0xe5, 0x2e, 0xd0, 0xbd, 0x37, 0x2f, 0xf3, 0x8d, 0xba, 0x4f, 0xb4,
+    0x5d, 0x39, 0x64, 0x33, 0x2f, 0xe9, 0x71, 0xb7, 0x38, 0xc5, 0x22, 0x08, 0x17, 0x81, 0xa0, 0x54,
+    0x36, 0x2b, 0x77, 0x42, 0x3c, 0x83, 0x62, 0xf5, 0xf1, 0xa9, 0x85, 0xf9, 0xd7, 0xd8, 0x9b, 0x3c,
+    0xa6, 0x89, 0x45, 0xac, 0xef, 0x53, 0x06, 0xff, 0x63, 0xa8, 0xd6, 0x4d, 0xf1, 0xf4, 0x05, 0xb7,
+    0x16, 0x24, 0x8d, 0x69, 0xe5, 0x68, 0xc6, 0xd7, 0x96, 0xcb, 0x02, 0xb1, 0x21, 0x5b, 0x9e, 0x26,
+    0xf9, 0xda, 0xe2, 0x91, 0x85, 0xc7, 0x91, 0xac, 0xe6, 0xf0, 0xd8, 0xc2, 0xed, 0xd0, 0xf1, 0x7d,
+    0xbb, 0x94, 0x05, 0xa7, 0x6b, 0x6d, 0x52, 0x96, 0x5c, 0x8f, 0x33, 0x16, 0x2a, 0xbb, 0x93, 0x7f,
+    0xce, 0x26, 0xe3, 0x31, 0xcc, 0x38, 0x12, 0x0b, 0xf7, 0xeb, 0x2a, 0x36, 0x35, 0xc3, 0x93, 0x55,
+    0xa1, 0xc6, 0x89, 0x58, 0x4e, 0x30, 0x6f, 0x2e, 0xee, 0x84, 0xee, 0x83, 0x0a, 0xa6, 0xa1, 0xab,
+    0xd8, 0x4e, 0x9c, 0x1d, 0xf9, 0x69, 0x8a, 0x43, 0x5e, 0x8a, 0x3d, 0xc5, 0xb2, 0x0c, 0x79, 0x0e,
+    0xec, 0xee, 0xbe, 0x62, 0x60, 0xa7, 0xcf, 0xad, 0x33, 0x16, 0xe3, 0x36, 0xef, 0x96, 0x38, 0x6e,
+    0xa4, 0x54, 0x65, 0x50, 0x94, 0x36, 0xf4, 0x64, 0x5b, 0x6e, 0xb3, 0x57, 0x66, 0x6b, 0xd4, 0xf6,
+    0x26, 0x69, 0x14, 0xe6, 0xf9, 0xac, 0xc1, 0x74, 0xaa, 0x57, 0xf5, 0xe2, 0xa0, 0x03, 0x1e, 0x4d,
+    0xcb, 0x9a, 0x54, 0x80, 0x23, 0x97, 0x46, 0x72, 0x17, 0xff, 0x77, 0x96, 0x0b, 0x43, 0xad, 0x0e,
+    0xbd, 0xc7, 0xe4, 0x19, 0x28, 0x99, 0x75, 0x02, 0x52, 0x93, 0x55, 0x3f, 0xf4, 0xb0, 0xda, 0x7d,
+    0x55, 0x65, 0x27, 0xd6, 0x1e, 0x7a, 0x66, 0x69, 0x47, 0x9c, 0x59, 0x6a, 0x43, 0x34, 0x2d, 0x76,
+    0xdf, 0xbb, 0xe0, 0xb5, 0x71, 0x28, 0x44, 0x94, 0x44, 0x11, 0xca, 0xf4, 0x05, 0xd6, 0x22, 0x8e,
+    0x79, 0x15, 0xa7, 0xbc, 0x60, 0xca, 0x6f, 0xf9, 0x1c, 0xcf, 0x01, 0x59, 0x24, 0x91, 0x67, 0xba,
+    0x44, 0x69, 0xd9, 0x58, 0x48, 0x7d, 0x79, 0x2c, 0x0b, 0xcf, 0xaa, 0x01, 0xae, 0xee, 0xb3, 0x38,
+    0x29, 0xcf, 0x02, 0xae, 0x50, 0xc5, 0xc9, 0xcc, 0x3b, 0x8f, 0xc4, 0xa1, 0x94, 0x5c, 0x64, 0xd8,
+    0xd1, 0xf2, 0x37, 0x28, 0xe9, 0x0c, 0x0f, 0x75, 0xc6, 0x1e, 0xbf, 0x9a, 0x08, 0x55, 0x73, 0x81,
+    0xeb, 0x19, 0x42, 0x40, 0xf7, 0x22, 0x9c, 0x1b, 0xbc, 0x89, 0x41, 0x4c, 0xc5, 0xc0, 0x81, 0xa7,
+    0x75, 0xd0, 0x0b, 0x17, 0x25, 0xf6, 0xd3, 0xdf, 0xfc, 0x0e, 0x3a, 0x10, 0x9e, 0xca, 0xd3, 0x28,
+    0xbf, 0x22, 0xc1, 0xe2, 0x3b, 0xab, 0x4d, 0x12, 0x1c, 0x74, 0x6c, 0x2d, 0x36, 0x36, 0xef, 0x61,
+    0xe3, 0x9c, 0x82, 0xff, 0xc6, 0xed, 0xf4, 0x8f, 0xe2, 0x24, 0x43, 0xaf, 0xcd, 0x41, 0xe3, 0x1e,
+    0x0e, 0x9a, 0xef, 0x8f, 0x1f, 0x59, 0x7b, 0x93, 0x45, 0xd6, 0x7b, 0x18, 0x3b, 0x62, 0x1b, 0xdc,
+    0x9a, 0x1c, 0x6c, 0xdd, 0xc3, 0x81, 0x98, 0x12, 0x3c, 0x92, 0x07, 0x81, 0xb5, 0x26, 0x11, 0x71,
+    0xe6, 0x0c, 0xdf, 0x23, 0xae, 0xc9, 0xc6, 0xf6, 0x3d, 0x6c, 0xb4, 0xa2, 0xe5, 0x22, 0xe1, 0x8f,
+    0xe4, 0x43, 0x82, 0x1f, 0xce, 0xc8, 0xce, 0x7d, 0x8c, 0xa4, 0x51, 0x44, 0x43, 0x67, 0xf9, 0x58,
+    0x56, 0x32, 0xb8, 0xd5, 0xb9, 0x76, 0x32, 0xa3, 0xb6, 0x26, 0x33, 0xaf, 0xee, 0x61, 0x66, 0xe8,
+    0x3c, 0x92, 0x8d, 0x61, 0x0b, 0x9c, 0x69, 0xc8, 0x12, 0xbe, 0xbe, 0x7a, 0xbe, 0xbe, 0xa7, 0xfe,
+    0x1e, 0x85, 0xd8, 0xfa, 0x67, 0xb0, 0x80, 0xf0, 0x8c, 0x81, 0x97, 0xa9, 0xaf, 0x38, 0xfd, 0xb8,
+    0x72, 0xe0, 0x93, 0xa3, 0x2d, 0xac, 0x1e, 0x0c, 0x15, 0xc6, 0x31, 0x3b, 0x1a, 0x9a, 0xd9, 0xf9,
+    0x5a, 0xe5, 0x88, 0x5a, 0xc5, 0x72, 0x0b, 0x5b, 0x0d, 0x4e, 0x3f, 0xe0, 0x97, 0x60, 0xda, 0x58,
+    0x08, 0x1a, 0x81, 0xc6, 0xcd, 0xe1, 0xe1, 0x94, 0xcd, 0xd2, 0x08, 0x68, 0xa2, 0x70, 0xcb, 0x5e,
+    0x5a, 0x78, 0x64, 0xfc, 0x73, 0x5c, 0x9a, 0x6d, 0x71, 0x88, 0x7a, 0x09, 0x8c, 0x30, 0x47, 0x9e,
+    0xe5, 0x8e, 0xeb, 0xca, 0xf3, 0xe1, 0xd2, 0xb6, 0xcb, 0x03, 0xd3, 0xc2, 0xa8, 0x6f, 0xac, 0x75,
+    0x2e, 0x58, 0x17, 0x2c, 0x95, 0x26, 0x31, 0x93, 0x05, 0xa4, 0x2f, 0xa4, 0x3b, 0xae, 0x84, 0x4a,
+    0xc2, 0xf2, 0xc9, 0xb6, 0x96, 0x41, 0x52, 0xf5, 0xc4, 0x79, 0x4b, 0x9e, 0xb5, 0x57, 0x05, 0x2d,
+    0xca, 0xa0, 0xe4, 0xd6, 0xc3, 0x84, 0x61, 0xfe, 0xdb, 0x94, 0x3a, 0x73, 0xd0, 0x8d, 0xff, 0xfe,
+    0x37, 0x7f, 0xfd, 0x43, 0x76, 0xf6, 0xfb, 0x76, 0x06, 0xc1, 0x6a, 0x26, 0x98, 0x88, 0xe2, 0x15,
+    0x00, 0x75, 0xd1, 0x86, 0xea, 0xf9, 0xf7, 0x3b, 0xa0, 0xec, 0xf0, 0x9e, 0x1c, 0x36, 0x32, 0xec,
+    0x59, 0x39, 0x5a, 0xfe, 0x00, 0xc6, 0x7e, 0xfc, 0xb7, 0x3a, 0xc6, 0x50, 0xb9, 0xc5, 0xcf, 0x55,
+    0x0e, 0x91, 0x9a, 0xc7, 0x38, 0x26, 0xe6, 0xa4, 0xbf, 0xa9, 0x32, 0x57, 0x8d, 0x89, 0xee, 0xef,
+    0x7c, 0x65, 0xbf, 0xcb, 0x9e, 0xc6, 0xea, 0x2f, 0xf2, 0x8b, 0x02, 0x56, 0x0e, 0xf1, 0x65, 0xb1,
+    0x41, 0xe6, 0xe3, 0xaa, 0x07, 0x33, 0x0b, 0xdd, 0xd7, 0x29, 0xe5, 0xe6, 0x93, 0x28, 0x65, 0xe1,
+    0x20, 0x2b, 0x7a, 0x79, 0x95, 0xd3, 0x2a, 0xdc, 0x66, 0xf9, 0x94, 0xda, 0x99, 0x61, 0xd6, 0x50,
+    0xd0, 0x4a, 0xee, 0x7a, 0xc8, 0xb1, 0x7b, 0x48, 0x91, 0x3d, 0x4b, 0xd7, 0xa5, 0x1e, 0xfc, 0xf4,
+    0x37, 0xff, 0x0a, 0xcf, 0xfe, 0xe6, 0x55, 0xe3, 0x13, 0x79, 0x80, 0xdd, 0x86, 0x39, 0xc0, 0x25,
+    0x61, 0xbe, 0x98, 0x58, 0x90, 0x29, 0xcc, 0xb4, 0xad, 0x78, 0x19, 0x3a, 0xb7, 0x6f, 0x3b, 0xc8,
+    0x6b, 0x11, 0x23, 0xa0, 0x88, 0xba, 0xa4, 0x4d, 0x7a, 0xa2, 0xd1, 0x22, 0x6f, 0x5c, 0x80, 0x5f,
+    0x10, 0xc8, 0x05, 0x0b, 0x60, 0xf9, 0x3f, 0xfe, 0x68, 0x1e, 0x3b, 0xe2, 0x67, 0x06, 0xd0, 0xeb,
+    0xe5, 0x04, 0xf2, 0xd0, 0x88, 0x24, 0x69, 0xf4, 0xe8, 0x31, 0xf3, 0xb7, 0x3f, 0xac, 0xcb, 0xd0,
+    0x94, 0x8a, 0x97, 0x4e, 0x7a, 0x8e, 0x0e, 0x30, 0x93, 0xd5, 0x65, 0xf3, 0x47, 0x33, 0xf4, 0xc3,
+    0x6f, 0xd7, 0x65, 0xc8, 0xc3, 0x83, 0x66, 0x7a, 0x76, 0x8e, 0xd2, 0x80, 0xb9, 0x22, 0x40, 0x7a,
+    0x24, 0x33, 0xff, 0x65, 0x5d, 0x66, 0xae, 0x58, 0x39, 0x55, 0x52, 0x71, 0x83, 0x07, 0xa4, 0xac,
+    0xf1, 0x82, 0x52, 0xf7, 0x5e, 0x23, 0x52, 0x41, 0xa5, 0x0b, 0x61, 0xac, 0xa6, 0x9c, 0x27, 0xb9,
+    0x33, 0xcc, 0xb5, 0x15, 0x1e, 0x15, 0xf5, 0xac, 0x1e, 0xf0, 0x2c, 0x95, 0xc1, 0x3a, 0x05, 0xcf,
+    0xff, 0x8b, 0x1d, 0xd5, 0x86, 0x7a, 0x2e, 0x52, 0xa8, 0xa0, 0x30, 0x00, 0x2d, 0x30, 0x00, 0xff,
+    0xfb, 0x77, 0xad, 0x9f, 0x79, 0x46, 0xfb, 0x4e, 0xb1, 0x07, 0xa2, 0xd8, 0x83, 0xdb, 0x87, 0xb3,
+    0x1f, 0x6f, 0x6b, 0xa1, 0xd5, 0xa1, 0x7b, 0x81, 0x15, 0xc5, 0x2b, 0xc6, 0x6b, 0x84, 0x74, 0xab,
+    0x2a, 0xbf, 0x33, 0x7c, 0x18, 0x3f, 0xc6, 0xec, 0x36, 0x9e, 0xc4, 0xec, 0x8a, 0x59, 0x41, 0xc5,
+    0xe4, 0x92, 0xef, 0xd9, 0x0a, 0xc7, 0x95, 0xd8, 0x5f, 0x69, 0x72, 0x01, 0xb3, 0xa6, 0xb9, 0x85,
+    0x9c, 0x06, 0x53, 0xfb, 0xfb, 0xdf, 0xfc, 0xc5, 0xbf, 0x11, 0x95, 0x7e, 0x9f, 0x55, 0xfa, 0x60,
+    0x63, 0x8b, 0x75, 0xfc, 0x82, 0x86, 0x56, 0x70, 0xb8, 0xee, 0x58, 0x45, 0x69, 0x1a, 0x86, 0xea,
+    0x71, 0xe8, 0xd2, 0xeb, 0xc7, 0x5a, 0x8d, 0x3f, 0xff, 0x3b, 0xf0, 0x4b, 0xeb, 0x32, 0xb3, 0x08,
+    0x1a, 0x3b, 0x26, 0x6e, 0x86, 0x3d, 0xab, 0xf1, 0x62, 0xe7, 0xb1, 0xec, 0xfc, 0xe5, 0xdf, 0xaf,
+    0xcf, 0xcb, 0xe6, 0xc6, 0x1a, 0xbc, 0x6c, 0x6e, 0x3c, 0x96, 0x95, 0xdf, 0xfe, 0xd7, 0x75, 0x59,
+    0x09, 0x79, 0xc3, 0xc4, 0x49, 0x9f, 0x25, 0x11, 0x9f, 0x89, 0x65, 0x14, 0x7e, 0x2d, 0x36, 0x1c,
+    0x3d, 0xd8, 0xa8, 0xa2, 0x56, 0x2a, 0x0d, 0x2a, 0x0c, 0x42, 0x6b, 0x9c, 0xc0, 0xb4, 0x06, 0xf4,
+    0xf1, 0x97, 0x32, 0xa6, 0xc0, 0xc0, 0x05, 0x92, 0x8b, 0xd1, 0x7d, 0x3a, 0x86, 0xe1, 0x7d, 0x3a,
+    0x2e, 0x2a, 0xfe, 0x79, 0x46, 0xf5, 0x4e, 0xf1, 0x9d, 0x53, 0x5c, 0x72, 0x15, 0xaf, 0x76, 0x60,
+    0xfe, 0x76, 0xbb, 0x12, 0xf5, 0xfd, 0x17, 0x99, 0xd9, 0xea, 0x9c, 0x7e, 0x6b, 0x6d, 0xd4, 0x37,
+    0x37, 0x36, 0xfe, 0xa5, 0x25, 0xae, 0xec, 0xb2, 0xfe, 0x08, 0x78, 0x45, 0xd2, 0xce, 0xc6, 0x86,
+    0xa4, 0xc8, 0x25, 0xa4, 0xf5, 0xed, 0xe5, 0xd6, 0x93, 0xd8, 0xcb, 0x6c, 0x0d, 0xa3, 0x62, 0x31,
+    0x63, 0x49, 0xa9, 0xd8, 0xcc, 0xd5, 0xb5, 0x0a, 0xa5, 0xd9, 0x14, 0xc0, 0x35, 0x0d, 0xa7, 0xc8,
+    0x6b, 0x34, 0x9d, 0x3f, 0xfe, 0x69, 0x56, 0xf7, 0x83, 0x8d, 0xa6, 0x2c, 0xff, 0x97, 0x35, 0x9b,
+    0x3f, 0xfe, 0x99, 0x79, 0x48, 0x4a, 0x3e, 0x16, 0x11, 0x73, 0x4c, 0x53, 0xa5, 0x4a, 0xf6, 0x78,
+    0x89, 0x2f, 0xca, 0x10, 0xf3, 0x28, 0x6b, 0x51, 0x29, 0x29, 0x81, 0xc9, 0x97, 0x5b, 0x32, 0xfc,
+    0xa7, 0xeb, 0x32, 0x2c, 0xd7, 0x5f, 0x4c, 0x66, 0xa4, 0x0d, 0xfd, 0xb0, 0x2c, 0x16, 0xa0, 0x1f,
+    0x6c, 0x42, 0x64, 0x55, 0xea, 0xa8, 0x0c, 0xf5, 0x4d, 0xf6, 0xff, 0xcb, 0xce, 0xe4, 0x40, 0xb1,
+    0x52, 0x2e, 0x0a, 0xb9, 0x00, 0x89, 0xd9, 0xb8, 0x35, 0xe0, 0xf6, 0xb2, 0xf6, 0x78, 0xf8, 0xb1,
+    0xb6, 0x37, 0x16, 0x4b, 0x9e, 0x43, 0x0b, 0x47, 0x1a, 0x14, 0x64, 0xd5, 0x2d, 0x20, 0x2b, 0x57,
+    0xc2, 0xdf, 0xbf, 0x7f, 0x8f, 0x4e, 0xec, 0x92, 0xc6, 0x0e, 0xb7, 0x20, 0x61, 0x7d, 0x39, 0xa1,
+    0x8e, 0xf7, 0x15, 0xa0, 0x20, 0xa1, 0x44, 0xb5, 0x8f, 0x9b, 0x20, 0x0f, 0x7e, 0x65, 0xbd, 0xe3,
+    0x21, 0x8d, 0xb3, 0x6a, 0x80, 0xa8, 0x04, 0x9c, 0x4d, 0x8e, 0x6b, 0x7b, 0x67, 0x20, 0xb9, 0x14,
+    0x94, 0xcf, 0x9a, 0xf0, 0x04, 0x6f, 0x60, 0x13, 0xba, 0x5e, 0xb7, 0xe0, 0x99, 0x1a, 0x37, 0x18,
+    0x54, 0x70, 0xd5, 0xa6, 0x01, 0x6e, 0x30, 0x50, 0xe2, 0xc6, 0xbd, 0x23, 0x7c, 0xfb, 0x13, 0xa0,
+    0x2e, 0xb8, 0xa9, 0x93, 0xf0, 0x28, 0x97, 0x45, 0xef, 0x48, 0x09, 0xfa, 0xd0, 0x85, 0x48, 0xf2,
+    0x80, 0x85, 0x24, 0x74, 0x98, 0xb8, 0x21, 0x4e, 0x08, 0xbe, 0x6e, 0x01, 0x5d, 0x83, 0x39, 0x83,
+    0xd9, 0x03, 0x25, 0x7e, 0xe2, 0x59, 0x2d, 0x5c, 0x2f, 0xaf, 0xa0, 0xce, 0x34, 0xa8, 0x0e, 0xbe,
+    0x63, 0xa1, 0xd1, 0x6c, 0x59, 0x05, 0x74, 0xd4, 0xbb, 0x2b, 0x9b, 0xc3, 0x6e, 0x6d, 0xaf, 0xb9,
+    0x58, 0x88, 0x7b, 0xd3, 0x9c, 0x17, 0x90, 0x1d, 0x49, 0xca, 0xfc, 0xbd, 0xf1, 0xc1, 0xa4, 0xb6,
+    0xd7, 0x63, 0x4e, 0xc4, 0x63, 0x3e, 0x4d, 0xac, 0x16, 0x8f, 0x16, 0x08, 0x42, 0xba, 0x12, 0xd4,
+    0x3f, 0x6b, 0x43, 0xb7, 0xf6, 0xcf, 0x8e, 0xa1, 0x27, 0x0b, 0x04, 0x12, 0x95, 0x88, 0xc3, 0xc1,
+    0xe0, 0x10, 0xd8, 0xf2, 0x17, 0x1e, 0xe8, 0x6a, 0x92, 0x73, 0x86, 0x54, 0x75, 0x4b, 0x7a, 0x9f,
+    0xfa, 0x78, 0x06, 0x96, 0xdc, 0xf0, 0xf0, 0x85, 0xc3, 0x83, 0xa2, 0x39, 0x40, 0x57, 0x37, 0xa7,
+    0x33, 0x01, 0xce, 0x7a, 0x78, 0xe5, 0xe3, 0xd0, 0x27, 0x09, 0xde, 0xd0, 0x14, 0x63, 0x6b, 0x80,
+    0xac, 0xc4, 0x4c, 0xc6, 0xdd, 0x26, 0xce, 0x7c, 0x63, 0x9f, 0xe4, 0x75, 0x20, 0x49, 0x93, 0xbf,
+    0x07, 0xd9, 0x09, 0xbb, 0x42, 0x7f, 0xb7, 0xa2, 0x39, 0x08, 0xec, 0xa9, 0x1b, 0x74, 0x76, 0x08,
+    0x3a, 0xba, 0x1f, 0x71, 0xe2, 0x56, 0x9b, 0x03, 0x54, 0x35, 0x64, 0xdc, 0xc3, 0xde, 0x84, 0xbf,
+    0xd6, 0x11, 0xf7, 0x5d, 0xf4, 0x32, 0x80, 0x80, 0xa4, 0x7a, 0x2b, 0x43, 0x7f, 0xd2, 0xc2, 0x71,
+    0x9a, 0x80, 0xa3, 0xcb, 0x7b, 0x06, 0x69, 0xea, 0x71, 0xdd, 0x1a, 0x40, 0x73, 0x30, 0xf4, 0x07,
+    0xa6, 0x0a, 0xae, 0x90, 0xaa, 0x16, 0xc0, 0x87, 0x3e, 0xca, 0xeb, 0x9a, 0xc4, 0x90, 0x3d, 0x4e,
+    0xa2, 0x34, 0x00, 0xcf, 0x86, 0x62, 0x86, 0x07, 0xea, 0x9e, 0x39, 0xcd, 0xd4, 0x2c, 0xb4, 0xd0,
+    0x70, 0x84, 0xdc, 0xe7, 0xa0, 0xd3, 0xd0, 0x35, 0xa7, 0xea, 0xd6, 0x8f, 0x80, 0x33, 0xf8, 0x93,
+    0xb7, 0x1d, 0xab, 0x80, 0xa4, 0x32, 0x7f, 0x0b, 0xf3, 0x8f, 0x21, 0x64, 0x88, 0xa1, 0xdf, 0x9d,
+    0x42, 0xff, 0x5b, 0x1a, 0x48, 0xb3, 0xbd, 0x0f, 0x03, 0xac, 0xe9, 0x72, 0xbb, 0x1c, 0x2e, 0x40,
+    0x52, 0x6b, 0xfe, 0xe0, 0x1c, 0xcd, 0x45, 0x84, 0x97, 0x63, 0xf6, 0xc1, 0xac, 0x81, 0xda, 0x0f,
+    0xce, 0xd5, 0xc6, 0x45, 0x66, 0x0f, 0xf9, 0xd5, 0xd4, 0x27, 0xf3, 0xa2, 0x86, 0xb1, 0x0e, 0xd3,
+    0x1a, 0x9d, 0xb7, 0x6b, 0x7b, 0xad, 0x88, 0x5f, 0xb9, 0xe3, 0x24, 0x62, 0x80, 0xc2, 0x16, 0x9c,
+    0xb7, 0xd5, 0x2f, 0xe5, 0x9b, 0xfd, 0x73, 0x7c, 0x19, 0xef, 0x73, 0xab, 0xe9, 0x27, 0xdc, 0xea,
+    0xd3, 0xe4, 0x8a, 0x47, 0x73, 0x14, 0x16, 0x3e, 0x52, 0xe2, 0x0e, 0x26, 0xfd, 0x89, 0xb8, 0x84,
+    0x2c, 0x61, 0x21, 0x45, 0xb3, 0x82, 0x04, 0x75, 0x2d, 0xdd, 0xc9, 0x48, 0xd4, 0x82, 0x5b, 0xfa,
+    0x23, 0xd1, 0x85, 0x58, 0x01, 0x50, 0xd5, 0xb6, 0xbf, 0x8d, 0x63, 0x1e, 0x6f, 0xca, 0x74, 0xf9,
+    0x2c, 0x6f, 0x3b, 0x12, 0x95, 0x88, 0x77, 0x43, 0xe8, 0x40, 0xf8, 0xc3, 0xa3, 0x19, 0x8c, 0x2d,
+    0x70, 0xa0, 0x31, 0xb6, 0x1e, 0x08, 0x6a, 0xb3, 0x0f, 0x46, 0x9f, 0xc5, 0xc5, 0xb8, 0x55, 0x1b,
+    0xd2, 0x1e, 0x9a, 0x05, 0xb1, 0x47, 0xc6, 0x41, 0x07, 0x91, 0xe5, 0xef, 0xa9, 0x47, 0xf9, 0x7e,
+    0x13, 0xc6, 0xd1, 0x3e, 0x09, 0xe7, 0x16, 0x9f, 0x5a, 0xd9, 0x49, 0x7c, 0x40, 0x00, 0x59, 0x0d,
+    0x19, 0x9d, 0xbc, 0xd8, 0x07, 0x10, 0x05, 0xe9, 0x7b, 0x0c, 0x4c, 0xfc, 0x11, 0xee, 0xe5, 0xb9,
+    0x22, 0xa8, 0xe6, 0xe2, 0x99, 0x12, 0x79, 0x7e, 0x00, 0x95, 0x9d, 0x53, 0xdf, 0x8f, 0xad, 0x03,
+    0x12, 0xcd, 0x38, 0x00, 0x80, 0xa4, 0xb6, 0xa6, 0x10, 0xd2, 0x1f, 0xc2, 0x98, 0x08, 0xd0, 0x02,
+    0x11, 0xc7, 0xc3, 0xbe, 0x3e, 0x1c, 0x6b, 0x6c, 0x3c, 0xb4, 0x5d, 0xca, 0x14, 0xe3, 0x73, 0x9f,
+    0x8a, 0x71, 0xa7, 0xce, 0xdf, 0xfc, 0x30, 0x2c, 0x2e, 0x1f, 0x08, 0xad, 0xce, 0xb5, 0xbc, 0xa9,
+    0x13, 0x46, 0xc6, 0x87, 0xa1, 0x5a, 0x3f, 0x3e, 0xa2, 0xdf, 0x19, 0x92, 0x25, 0xa8, 0x48, 0x75,
+    0xbc, 0x22, 0x5d, 0x3d, 0x3e, 0x20, 0xa4, 0xd8, 0xc7, 0xf7, 0xc6, 0xb2, 0x3f, 0xbe, 0x1c, 0x7f,
+    0x0f, 0xde, 0x9b, 0x62, 0x4c, 0x31, 0x56, 0x87, 0x14, 0xad, 0xc1, 0x31, 0x98, 0x9f, 0x16, 0x67,
+    0xa1, 0x8d, 0xfa, 0x91, 0xdd, 0xd2, 0x0a, 0x83, 0x04, 0xe8, 0x1a, 0x11, 0xa0, 0xfa, 0x0a, 0xfb,
+    0x03, 0xa3, 0x0a, 0x22, 0x2e, 0x69, 0x7b, 0xc6, 0x1a, 0xf5, 0x3d, 0xef, 0xc1, 0xf0, 0x38, 0x27,
+    0x7e, 0x80, 0x7b, 0x27, 0x32, 0x7d, 0x01, 0x9a, 0x86, 0xaf, 0xf1, 0x04, 0xf9, 0x8a, 0x13, 0x08,
+    0x90, 0xce, 0x3d, 0x0e, 0x66, 0x08, 0xe7, 0x33, 0xc8, 0xd8, 0x58, 0x8d, 0x3a, 0x82, 0xc1, 0x3e,
+    0xf1, 0xf0, 0x52, 0xcb, 0x80, 0x5a, 0x6d, 0xba, 0xe0, 0x38, 0x12, 0x8f, 0xd4, 0xa3, 0xbd, 0x8b,
+    0x16, 0xa5, 0xcb, 0xaf, 0xe8, 0xaf, 0xfe, 0xc5, 0x75, 0xe3, 0xf5, 0x77, 0x31, 0x5e, 0x7f, 0x0b,
+    0xf3, 0x1e, 0x46, 0x51, 0xd8, 0x5d, 0x8d, 0x5d, 0x99, 0x1c, 0x4e, 0xd0, 0x6b, 0xe1, 0x8b, 0xb8,
+    0xc2, 0x31, 0x00, 0x4d, 0x2d, 0xb1, 0x16, 0x70, 0xd6, 0x73, 0xda, 0x3c, 0x24, 0xbe, 0x5b, 0x56,
+    0x96, 0x45, 0x07, 0x2d, 0x35, 0x87, 0xe3, 0xfd, 0xd3, 0x0f, 0x72, 0xcb, 0x89, 0x9d, 0x3a, 0xf3,
+    0x12, 0x83, 0x74, 0xb5, 0x5d, 0x3d, 0xe9, 0xe0, 0xf4, 0xbb, 0xb4, 0x91, 0x40, 0x50, 0xcb, 0xe0,
+    0xb4, 0x0b, 0xce, 0xa4, 0x9b, 0xfa, 0xa9, 0x4f, 0x03, 0x20, 0x43, 0xc3, 0x81, 0xa2, 0x56, 0xcd,
+    0x43, 0x9c, 0x35, 0x70, 0x07, 0xe7, 0x44, 0xf2, 0x2d, 0xff, 0x21, 0x09, 0x6c, 0xd1, 0x35, 0x43,
+    0xb5, 0x2d, 0x3a, 0x19, 0xc8, 0x8e, 0x69, 0x71, 0x87, 0xd4, 0x5b, 0x1c, 0x62, 0x83, 0x16, 0x47,
+    0xc6, 0x4e, 0xd4, 0xde, 0x7a, 0xd8, 0x81, 0x71, 0x33, 0xa4, 0x30, 0xab, 0x6b, 0xf1, 0xbc, 0x1d,
+    0x40, 0x53, 0xb7, 0xa3, 0x0b, 0x51, 0x78, 0xc7, 0x67, 0x56, 0x97, 0xe1, 0x35, 0x8a, 0xb8, 0xd9,
+    0x42, 0xd6, 0x01, 0x0f, 0x94, 0xa0, 0xd3, 0x3e, 0x04, 0xac, 0xb8, 0x1a, 0x4b, 0xdd, 0x2c, 0x9a,
+    0x3c, 0xc4, 0xe5, 0x02, 0x40, 0xc1, 0x13, 0xb5, 0x65, 0xed, 0xbf, 0x03, 0xcb, 0x8a, 0x57, 0x9e,
+    0x00, 0x4d, 0x0a, 0x21, 0x4f, 0x81, 0x81, 0xed, 0xbf, 0x53, 0xdb, 0x82, 0xfd, 0x7d, 0xb0, 0xb1,
+    0x4d, 0xdb, 0x3e, 0x63, 0xa5, 0x87, 0x04, 0x9a, 0x5a, 0x6f, 0x46, 0x27, 0x18, 0x80, 0x45, 0x30,
+    0xa8, 0x65, 0x3d, 0xb2, 0x49, 0x40, 0x56, 0xcb, 0xed, 0x00, 0x3a, 0x7f, 0x38, 0x65, 0x37, 0xd0,
+    0x41, 0xb9, 0xd8, 0x0e, 0x34, 0x3e, 0xf8, 0x6c, 0x80, 0x1b, 0x7d, 0x2e, 0xc1, 0xd5, 0xe1, 0x45,
+    0x91, 0xf1, 0xdc, 0xfa, 0xb2, 0xd9, 0x1e, 0x7d, 0x25, 0x42, 0x50, 0x75, 0xe7, 0x4c, 0x7a, 0xb2,
+    0x43, 0xa3, 0x80, 0x5b, 0x07, 0x2c, 0xc6, 0xf7, 0x3b, 0x30, 0x00, 0x7a, 0x6a, 0xc0, 0xf1, 0x78,
+    0x74, 0x28, 0x22, 0xa9, 0x94, 0x89, 0xfb, 0x80, 0xc7, 0x69, 0x34, 0xc3, 0x0b, 0x2f, 0x31, 0xa0,
+    0x82, 0x47, 0xea, 0x90, 0x1d, 0xe3, 0xa9, 0xce, 0xf5, 0x35, 0x50, 0x7a, 0xdc, 0x66, 0x98, 0xff,
+    0x83, 0x26, 0x98, 0x6a, 0x9d, 0xc1, 0x68, 0x69, 0x79, 0xf4, 0x12, 0x23, 0xa3, 0x7c, 0xac, 0x00,
+    0x51, 0x0d, 0x68, 0xa2, 0x99, 0xc1, 0x43, 0x8b, 0x0b, 0x50, 0x1b, 0x52, 0x88, 0x0c, 0xe8, 0x6a,
+    0x87, 0x01, 0x02, 0x3e, 0xa4, 0x30, 0x8d, 0x00, 0xf6, 0x3b, 0x38, 0x8b, 0x00, 0xd3, 0x8e, 0x3e,
+    0x43, 0x2d, 0xe4, 0xa3, 0x01, 0x18, 0xd9, 0x23, 0x98, 0xb4, 0x2d, 0xaf, 0xc0, 0x2d, 0xe1, 0x15,
+    0xcc, 0xd8, 0x10, 0xa0, 0x6a, 0x1c, 0xa6, 0x1c, 0x30, 0xfb, 0x9c, 0x62, 0x9c, 0x2a, 0xed, 0x92,
+    0x70, 0x7d, 0x4d, 0x8d, 0x32, 0x0f, 0x85, 0x32, 0x8b, 0x2b, 0xba, 0xc5, 0x6e, 0x42, 0xa1, 0xc7,
+    0x9a, 0x21, 0x83, 0x46, 0xb9, 0x8b, 0x3b, 0xce, 0x29, 0x75, 0xad, 0x1e, 0xc1, 0xe0, 0x05, 0x07,
+    0x8c, 0xc6, 0x2e, 0x8f, 0x26, 0x20, 0x60, 0xf8, 0x23, 0x84, 0xcb, 0x23, 0x79, 0xf7, 0x67, 0xdd,
+    0x02, 0x8a, 0x66, 0xd6, 0x3a, 0x96, 0x6d, 0x01, 0xf3, 0x9f, 0xe0, 0x7b, 0x53, 0x10, 0x43, 0xa6,
+    0xc7, 0xf0, 0x48, 0xad, 0x98, 0x07, 0x5d, 0xa8, 0x0a, 0xe2, 0xaf, 0xa9, 0xcf, 0xae, 0x0b, 0x43,
+    0x06, 0x44, 0x75, 0x5f, 0xf6, 0x5a, 0xe3, 0x26, 0x3a, 0x8d, 0xc0, 0x81, 0xd8, 0xa4, 0xec, 0x7e,
+    0x24, 0xab, 0x0d, 0xec, 0x70, 0x00, 0x42, 0x18, 0x83, 0xab, 0x60, 0xd3, 0xe5, 0x6a, 0x30, 0x8d,
+    0x8f, 0xd4, 0x23, 0x00, 0xc6, 0xf1, 0x44, 0x8c, 0xc9, 0x49, 0x31, 0xcf, 0x51, 0x07, 0x56, 0x9f,
+    0x20, 0xb2, 0xa2, 0xe2, 0xa2, 0x65, 0xec, 0xca, 0x40, 0x44, 0x57, 0x9f, 0x34, 0xa3, 0x0b, 0x97,
+    0x19, 0x27, 0x75, 0xa1, 0xf1, 0x14, 0x97, 0x1b, 0x71, 0x70, 0x9d, 0x8e, 0x35, 0xda, 0x82, 0xfa,
+    0xd2, 0xf4, 0x99, 0x4d, 0x6c, 0x52, 0x98, 0x30, 0xa4, 0xaa, 0xdb, 0x3d, 0xe8, 0xe3, 0xaa, 0x05,
+    0x07, 0xa5, 0x92, 0xf9, 0x0b, 0xcf, 0x02, 0x0f, 0xd4, 0xa8, 0xa3, 0x01, 0xe8, 0xd8, 0xd8, 0xe3,
+    0x0b, 0x94, 0x56, 0x1e, 0x81, 0x03, 0x51, 0x33, 0x87, 0xec, 0x1e, 0x4b, 0x13, 0x06, 0x81, 0x6b,
+    0x97, 0xd9, 0x11, 0x15, 0x33, 0xc8, 0xee, 0xb1, 0xa6, 0xf5, 0xd0, 0x76, 0xbe, 0xe4, 0x30, 0xeb,
+    0xec, 0x71, 0x9c, 0x08, 0x16, 0x0e, 0x56, 0x3d, 0xee, 0x47, 0xcd, 0x56, 0x07, 0xdf, 0x6e, 0x46,
+    0x11, 0x89, 0x98, 0xd5, 0x7f, 0x71, 0x86, 0xf9, 0x91, 0xa8, 0x1e, 0x2c, 0xfb, 0x1d, 0x88, 0x61,
+    0x4e, 0x6d, 0x1a, 0x95, 0x9d, 0x2e, 0xfd, 0x3e, 0x3e, 0xd1, 0x58, 0xf0, 0x3e, 0x04, 0xa5, 0x4d,
+    0x16, 0xd9, 0xa1, 0x5d, 0x5a, 0xf0, 0xfe, 0xfe, 0x3d, 0xfb, 0x18, 0x7f, 0xce, 0xab, 0x30, 0xb9,
+    0xe0, 0x34, 0x0d, 0xef, 0xdd, 0x72, 0x70, 0x90, 0xfa, 0x7e, 0x61, 0x11, 0xf0, 0x72, 0x5d, 0xc5,
+    0x22, 0xf4, 0x23, 0x6a, 0xc4, 0xf3, 0x86, 0xab, 0x97, 0x15, 0x43, 0x5f, 0x5f, 0xa1, 0xc1, 0x8a,
+    0x88, 0x4b, 0xc4, 0x32, 0x1c, 0x1e, 0x83, 0x7d, 0xf8, 0x7b, 0xb7, 0xed, 0x27, 0x59, 0x47, 0xce,
+    0x37, 0xa1, 0x55, 0x16, 0x92, 0x9d, 0x8c, 0x54, 0xbd, 0x78, 0x7f, 0x75, 0xb7, 0x99, 0x72, 0x29,
+    0x59, 0x42, 0xd7, 0x5c, 0x4b, 0x96, 0x99, 0x8d, 0x8b, 0xc9, 0x3f, 0xfc, 0x2e, 0xaf, 0xfe, 0xc1,
+    0xab, 0xc9, 0x59, 0x0d, 0xbf, 0xe4, 0x72, 0xf2, 0x4f, 0xff, 0xfa, 0x9f, 0xcc, 0x8b, 0xb3, 0x19,
+    0x1f, 0x6b, 0x2f, 0x27, 0x67, 0xf9, 0x9f, 0x62, 0x3d, 0x39, 0x2b, 0xea, 0xe1, 0x0b, 0xca, 0x19,
+    0x70, 0xbd, 0x15, 0xe5, 0xc6, 0xb6, 0xf7, 0xf8, 0xf5, 0xe4, 0xac, 0x26, 0xc3, 0x82, 0xb2, 0xd4,
+    0x01, 0x27, 0xdb, 0x6b, 0xa8, 0x58, 0x55, 0x96, 0x45, 0x5d, 0xc8, 0x2e, 0x5c, 0x35, 0x33, 0xdf,
+    0xc0, 0x58, 0xd8, 0xd7, 0xac, 0x33, 0xed, 0xe2, 0xcb, 0x9e, 0x89, 0x3a, 0x42, 0xdd, 0xd9, 0xdc,
+    0x05, 0xe3, 0x36, 0x6e, 0xab, 0x5d, 0x52, 0xe3, 0x35, 0xbe, 0x4b, 0x5c, 0xb5, 0x5c, 0xab, 0x39,
+    0xb6, 0x77, 0x77, 0xb6, 0xb7, 0xc0, 0xd8, 0x0f, 0xd4, 0x53, 0xce, 0x1d, 0xa8, 0xe5, 0xc3, 0x48,
+    0x6d, 0xfc, 0xb7, 0xb6, 0x1a, 0x78, 0x4b, 0x3c, 0x30, 0xa2, 0x6e, 0x4a, 0x63, 0xe7, 0x35, 0x18,
+    0x54, 0xcd, 0x6a, 0xe7, 0x36, 0x30, 0x82, 0x59, 0xce, 0x9a, 0x1f, 0x74, 0x3b, 0xcb, 0xdb, 0x03,
+    0x4d, 0x00, 0xb6, 0xbd, 0xb3, 0xb9, 0x85, 0x9b, 0xd4, 0x07, 0x5a, 0x81, 0x40, 0x6b, 0x27, 0x23,
+    0x4d, 0x25, 0xaf, 0xb7, 0xa0, 0xbd, 0xdd, 0xe3, 0xfe, 0x89, 0xa6, 0xc1, 0x3b, 0x5b, 0xaf, 0xc0,
+    0xdd, 0x35, 0x27, 0xc7, 0x2d, 0x4d, 0xe7, 0x6c, 0x6d, 0x81, 0x54, 0x26, 0x9a, 0xf0, 0x0f, 0xda,
+    0xbc, 0x81, 0x47, 0x0d, 0x8e, 0x8e, 0xf7, 0x75, 0x9b, 0xee, 0xbb, 0x1a, 0x15, 0x69, 0x6c, 0x35,
+    0x20, 0xc7, 0x7e, 0xeb, 0x48, 0xd7, 0x3b, 0xc8, 0xc7, 0xb9, 0x4e, 0xd1, 0xb6, 0xb7, 0x1b, 0xaf,
+    0x76, 0xa0, 0x07, 0xfb, 0x6a, 0x7f, 0xdd, 0xd8, 0xdd, 0x11, 0xfd, 0x33, 0xd1, 0xc4, 0xe5, 0xdb,
+    0xaf, 0xb7, 0x36, 0xa0, 0x98, 0x7e, 0xa7, 0x39, 0xd2, 0xe4, 0x69, 0x6c, 0x02, 0x3b, 0xc7, 0xad,
+    0xa1, 0x46, 0x72, 0xdb, 0xaf, 0xbe, 0x81, 0xaa, 0x86, 0x13, 0x9d, 0xe6, 0x6f, 0x42, 0xbb, 0x61,
+    0xa6, 0xa8, 0xd6, 0x86, 0xcd, 0xd7, 0xa0, 0x2f, 0x1f, 0xba, 0x6a, 0x76, 0x1b, 0xdf, 0x80, 0xee,
+    0xd7, 0xf6, 0x06, 0x27, 0x1a, 0xe9, 0xe3, 0x08, 0xeb, 0xe8, 0xe4, 0x8f, 0x63, 0xa3, 0xa7, 0x6e,
+    0xee, 0x56, 0xe3, 0xf5, 0x06, 0x28, 0x5c, 0xb7, 0x33, 0xd0, 0x68, 0x6d, 0x63, 0x13, 0x9a, 0x7b,
+    0x70, 0xdc, 0xd5, 0x29, 0x1c, 0x96, 0x72, 0xb4, 0xaf, 0x11, 0xec, 0xce, 0xe6, 0xeb, 0xed, 0x1d,
+    0x5c, 0xfb, 0xdd, 0xd7, 0xa8, 0xf6, 0x36, 0x08, 0xed, 0xac, 0xa3, 0x19, 0x1e, 0xbb, 0xf8, 0xf1,
+    0x8b, 0xde, 0x89, 0xa6, 0xff, 0x1a, 0x3b, 0xaf, 0x40, 0x68, 0xad, 0xd1, 0x40, 0xc3, 0xed, 0x46,
+    0x03, 0x44, 0xff, 0x5e, 0xb3, 0x34, 0xba, 0xb5, 0xb5, 0xf9, 0x1a, 0xb5, 0xa9, 0xab, 0x59, 0xc8,
+    0xdf, 0x7e, 0xb5, 0xdd, 0x80, 0x3c, 0x87, 0xa3, 0x89, 0x46, 0x74, 0x1b, 0xbb, 0xd0, 0x01, 0xcd,
+    0xe6, 0x99, 0xc6, 0x28, 0x6c, 0x7f, 0xd3, 0x80, 0x36, 0x8d, 0x35, 0x73, 0x97, 0xc6, 0xee, 0x06,
+    0xea, 0xe4, 0xb8, 0xaf, 0xc9, 0xf2, 0xea, 0x35, 0xf4, 0x51, 0x67, 0x30, 0xd6, 0xb0, 0xbb, 0xb1,
+    0x0b, 0xec, 0x76, 0x0e, 0xbb, 0x6d, 0x5d, 0x57, 0xa3, 0xa5, 0x1c, 0x37, 0xfb, 0x6d, 0x0d, 0x33,
+    0x5b, 0xa8, 0x74, 0x93, 0x23, 0xdd, 0xfb, 0x17, 0xe8, 0xc9, 0x5d, 0x34, 0x40, 0x7d, 0x6d, 0x16,
+    0xd4, 0xff, 0xc9, 0x27, 0x0d, 0xc7, 0xdf, 0xa0, 0x07, 0xea, 0x1d, 0x6b, 0x4a, 0xd9, 0x82, 0xce,
+    0x44, 0xe5, 0xd4, 0x44, 0xe5, 0xdb, 0xdb, 0x5b, 0x68, 0x3c, 0x4e, 0xc0, 0x74, 0xab, 0xc7, 0xd1,
+    0xd6, 0xeb, 0x57, 0x68, 0x18, 0xb4, 0xbd, 0xbd, 0x0b, 0xca, 0x79, 0xa0, 0x5b, 0x8f, 0x83, 0xc1,
+    0xb4, 0x0b, 0x35, 0xb5, 0x8e, 0x3e, 0xe9, 0x2c, 0xd9, 0x0e, 0xd4, 0x74, 0xd2, 0x6d, 0x7e, 0xd4,
+    0x15, 0xd3, 0x80, 0x36, 0x8d, 0x34, 0xab, 0xac, 0xdb, 0xe0, 0x14, 0xb1, 0xa6, 0xd1, 0x99, 0x86,
+    0xe1, 0x57, 0xbb, 0x20, 0xe0, 0xc3, 0x66, 0x57, 0xeb, 0xd4, 0x5e, 0x01, 0x37, 0xad, 0x41, 0x6f,
+    0xa8, 0xe9, 0xa7, 0xd7, 0xf8, 0x21, 0xa8, 0xc1, 0x44, 0xd7, 0x09, 0x0d, 0x6c, 0x77, 0xbb, 0x79,
+    0xac, 0xc9, 0xb2, 0x8b, 0x2a, 0x3c, 0x6c, 0x7e, 0x38, 0xd4, 0xb4, 0xfb, 0xd5, 0x2e, 0xe4, 0xd9,
+    0x07, 0x47, 0xad, 0xad, 0x0a, 0x0f, 0x70, 0xe9, 0xf2, 0x80, 0x16, 0x6f, 0x40, 0x39, 0x07, 0x23,
+    0x8d, 0xab, 0xde, 0xde, 0xde, 0xc0, 0x72, 0xa0, 0x18, 0x6d, 0xdc, 0xf0, 0x0a, 0xac, 0x5a, 0x47,
+    0xb3, 0x94, 0x06, 0x76, 0x42, 0x04, 0x49, 0x4d, 0x9d, 0x47, 0x47, 0xf7, 0xf6, 0xa9, 0xd3, 0xd2,
+    0x8d, 0x84, 0x0d, 0x94, 0xde, 0xf8, 0x48, 0xd3, 0x99, 0x3b, 0x18, 0x6c, 0x75, 0xdb, 0x03, 0x9d,
+    0x7d, 0xdd, 0x84, 0xf1, 0x3d, 0xd0, 0xf9, 0xad, 0xdd, 0x1d, 0xd0, 0xab, 0xf1, 0xe9, 0xb1, 0x26,
+    0x0b, 0x58, 0x09, 0x68, 0x4f, 0xf7, 0x54, 0x67, 0xc8, 0xb7, 0x70, 0x24, 0x1c, 0xf6, 0x3e, 0x3c,
+    0xf1, 0x74, 0x33, 0x8b, 0x44, 0xf5, 0xf3, 0x4d, 0x16, 0x3e, 0xd9, 0x64, 0x33, 0xab, 0x4f, 0x31,
+    0xdb, 0x14, 0x93, 0x88, 0xc7, 0x4f, 0x35, 0x77, 0x9e, 0x66, 0xaa, 0x59, 0x1c, 0x33, 0xaa, 0x4e,
+    0x36, 0x0b, 0x62, 0x75, 0xba, 0x79, 0xfb, 0x44, 0x91, 0x7a, 0xc2, 0x99, 0xe5, 0x5c, 0x77, 0xca,
+    0x99, 0x65, 0x37, 0x4f, 0x3a, 0xff, 0xa1, 0x64, 0xe2, 0xe1, 0xd3, 0xce, 0xbc, 0x96, 0x5f, 0x76,
+    0x1f, 0xd3, 0x0f, 0xff, 0x7d, 0x8d, 0x59, 0x5c, 0xce, 0x0a, 0xbe, 0x8b, 0x12, 0x47, 0x41, 0x0c,
+    0x33, 0xb9, 0x7d, 0x7c, 0x67, 0xd5, 0x0c, 0x78, 0x8a, 0x17, 0x23, 0x3e, 0x72, 0x0b, 0xf9, 0x3f,
+    0x3c, 0x80, 0x2f, 0x79, 0xf4, 0x6a, 0x1d, 0xce, 0x0a, 0x5d, 0x18, 0xa9, 0xce, 0xa4, 0x18, 0xa6,
+    0x99, 0x79, 0x95, 0xf7, 0x4c, 0x34, 0x8d, 0x87, 0x97, 0x95, 0xe7, 0x8b, 0x85, 0xbc, 0x5a, 0x86,
+    0x59, 0x69, 0xf6, 0xf8, 0x02, 0x3b, 0xe1, 0xee, 0xcc, 0x94, 0x50, 0xbc, 0xd3, 0xb3, 0xa3, 0xf6,
+    0x01, 0x64, 0x8a, 0xb7, 0xb5, 0x1d, 0xa8, 0xe7, 0x36, 0x44, 0x5c, 0x07, 0xd7, 0x55, 0xbb, 0x58,
+    0x12, 0x60, 0x15, 0x3d, 0x4d, 0x15, 0xe2, 0x8e, 0xd4, 0xbe, 0xda, 0x9f, 0x11, 0x8e, 0xf7, 0xbe,
+    0x0d, 0xd4, 0x7e, 0x93, 0x88, 0xef, 0x17, 0x8d, 0xd4, 0x31, 0x1b, 0x49, 0x91, 0x87, 0x53, 0x0d,
+    0x0f, 0x57, 0xc8, 0xc3, 0xb9, 0x86, 0x87, 0x1b, 0x94, 0x83, 0x66, 0x77, 0x8d, 0x8d, 0x37, 0x55,
+    0xec, 0x37, 0xd5, 0xe1, 0x93, 0x6d, 0x03, 0x0f, 0xfb, 0xfb, 0x6a, 0x1e, 0x6c, 0x37, 0x81, 0x0c,
+    0x9a, 0x49, 0xbe, 0x3d, 0x03, 0x1e, 0xf6, 0x0f, 0x35, 0x3c, 0x78, 0x58, 0x85, 0xe6, 0x0d, 0xa9,
+    0xcd, 0xa6, 0x90, 0xe1, 0x58, 0xbd, 0x13, 0xcb, 0xc6, 0xce, 0xda, 0xd7, 0x74, 0x96, 0x8d, 0x07,
+    0x2f, 0xf6, 0x35, 0x61, 0xad, 0xcd, 0x6d, 0xc8, 0x30, 0x50, 0x4f, 0x4e, 0xec, 0x08, 0x87, 0xfa,
+    0x48, 0xad, 0x30, 0x76, 0x8c, 0x55, 0x68, 0xe2, 0x12, 0x3b, 0x41, 0x39, 0x4c, 0x34, 0x72, 0xb8,
+    0x5a, 0x40, 0x86, 0x73, 0xb5, 0x07, 0xb7, 0x97, 0x58, 0xc2, 0x47, 0x4d, 0x09, 0x37, 0xc8, 0xc3,
+    0x27, 0x35, 0x0f, 0x0e, 0xde, 0x2f, 0xd3, 0x6a, 0x6a, 0x32, 0xb8, 0x20, 0xea, 0x56, 0x5b, 0x2d,
+    0x6a, 0xc7, 0xc3, 0x0c, 0x47, 0x9a, 0x0c, 0x3e, 0xb4, 0xa2, 0xd5, 0x55, 0xb7, 0xc2, 0x09, 0x97,
+    0x90, 0x41, 0xb3, 0xbe, 0xef, 0x70, 0x2c, 0x41, 0x13, 0xc9, 0x38, 0x91, 0x83, 0xc1, 0xaf, 0x3a,
+    0xa4, 0x72, 0x70, 0xb3, 0x75, 0xeb, 0x54, 0x53, 0x02, 0x7e, 0x6d, 0xb6, 0xa5, 0x99, 0x96, 0x39,
+    0x37, 0x73, 0xc8, 0xf0, 0x49, 0xbd, 0xc8, 0xe2, 0x7e, 0x06, 0x39, 0xb4, 0xdf, 0xa9, 0xe5, 0xe0,
+    0xce, 0xa1, 0x84, 0xf6, 0x89, 0xa6, 0x04, 0x6c, 0x66, 0x5b, 0xd3, 0x4c, 0x17, 0x7b, 0xb3, 0xad,
+    0xe9, 0x4d, 0x3a, 0x5b, 0xe0, 0x8c, 0x4e, 0x5d, 0x02, 0x8d, 0xf0, 0x72, 0xa6, 0x91, 0x5a, 0x61,
+    0x68, 0x62, 0xe3, 0x02, 0x82, 0x5a, 0xed, 0x29, 0x5e, 0x0c, 0xde, 0xd1, 0x84, 0x83, 0xd3, 0xcf,
+    0xc0, 0xe4, 0xc1, 0x3b, 0x35, 0x93, 0xd3, 0x39, 0x30, 0x79, 0x70, 0xa2, 0x66, 0x72, 0x66, 0x43,
+    0x86, 0xc3, 0x7d, 0x4d, 0x06, 0xf4, 0x65, 0x87, 0x1d, 0xf5, 0xd0, 0x9b, 0x79, 0x60, 0x48, 0x0f,
+    0x8f, 0xd4, 0x86, 0x74, 0xc6, 0xb0, 0x8a, 0x63, 0x4d, 0x15, 0x68, 0x40, 0x0e, 0x35, 0x06, 0x64,
+    0x16, 0x42, 0x77, 0x1f, 0xf6, 0xd5, 0xdd, 0x3d, 0x4b, 0xbe, 0x87, 0x0c, 0x13, 0xf5, 0x26, 0x97,
+    0xd9, 0x12, 0xab, 0xf8, 0xa8, 0xae, 0xc2, 0x9b, 0x43, 0x86, 0xa3, 0x13, 0x4d, 0x86, 0x10, 0x4f,
+    0xab, 0xf5, 0xd5, 0x72, 0xf0, 0x12, 0x70, 0x07, 0x47, 0x13, 0xb5, 0x3b, 0xf0, 0x52, 0x68, 0xc5,
+    0xd1, 0xa9, 0xba, 0x15, 0xcc, 0x85, 0xee, 0x3e, 0x6e, 0xab, 0xbb, 0x9b, 0xe1, 0xf1, 0xbe, 0xe3,
+    0xae, 0x5a, 0xd4, 0x2c, 0xc4, 0x12, 0xfa, 0x9a, 0x12, 0xbe, 0x87, 0x66, 0x1e, 0xbf, 0x57, 0x37,
+    0x93, 0x45, 0x58, 0xc2, 0x48, 0x53, 0x02, 0x5e, 0x02, 0x76, 0x3c, 0x56, 0x8f, 0xac, 0xcf, 0xd8,
+    0x9b, 0xef, 0x34, 0xbd, 0xf9, 0x19, 0x2f, 0x03, 0x7b, 0x37, 0xd0, 0x64, 0x58, 0x2c, 0x71, 0xdb,
+    0x9a, 0xda, 0x46, 0xcd, 0xf1, 0x1e, 0xab, 0x93, 0x8e, 0x5a, 0x0e, 0xf3, 0x19, 0x66, 0xd0, 0x6c,
+    0xe1, 0x9a, 0x7b, 0xd0, 0xcc, 0x93, 0x23, 0x75, 0x33, 0xe7, 0x01, 0x74, 0xd6, 0x49, 0x4f, 0xdd,
+    0x59, 0xf3, 0xc5, 0x15, 0x64, 0x18, 0xaa, 0x17, 0x24, 0xe6, 0x11, 0x66, 0x18, 0x69, 0x32, 0x5c,
+    0x81, 0x1c, 0x4e, 0x34, 0x3b, 0x11, 0xe7, 0xa8, 0xb4, 0x27, 0x1a, 0xa5, 0x9d, 0xdf, 0x80, 0xf7,
+    0x3f, 0xf9, 0xa4, 0xf6, 0xfe, 0x3e, 0xde, 0x40, 0xdf, 0x6d, 0xaa, 0x3b, 0xcb, 0xc7, 0xe1, 0xdf,
+    0xd5, 0x0c, 0x7f, 0x7f, 0x0e, 0x82, 0xea, 0x6a, 0xd6, 0xfc, 0xfc, 0x08, 0x98, 0xec, 0x8e, 0xd4,
+    0x4c, 0xfa, 0x31, 0x0c, 0x9c, 0xee, 0x58, 0x3d, 0x70, 0x7c, 0x6c, 0x66, 0x57, 0xd3, 0xcc, 0x00,
+    0xfd, 0x66, 0x4f, 0xe3, 0x37, 0x03, 0x17, 0xaa, 0xe8, 0xb5, 0xd5, 0x55, 0x04, 0x78, 0x47, 0x61,
+    0xef, 0x50, 0x1d, 0x0d, 0x06, 0x38, 0xfc, 0x7b, 0x9a, 0xe1, 0x1f, 0x04, 0x20, 0xc9, 0x5e, 0x4f,
+    0x2d, 0xc9, 0x00, 0x2f, 0x6a, 0xef, 0x69, 0x96, 0x35, 0x03, 0xf4, 0x38, 0x3d, 0x8d, 0xc7, 0x09,
+    0xa2, 0x14, 0x32, 0x8c, 0xd4, 0x1b, 0xaf, 0x02, 0x74, 0x07, 0x3d, 0x8d, 0x3b, 0x08, 0x2e, 0x31,
+    0xc3, 0x99, 0x26, 0xc3, 0x15, 0xb6, 0xe2, 0x5c, 0xd3, 0x8a, 0x6b, 0xf0, 0x59, 0x3d, 0xcd, 0xb6,
+    0xe3, 0x00, 0x3f, 0x3a, 0xd4, 0xfb, 0xa8, 0xa9, 0x02, 0x83, 0x5e, 0xdd, 0x96, 0xf2, 0x10, 0x7b,
+    0xb3, 0xaf, 0xe9, 0xcd, 0x10, 0x43, 0xd6, 0xbe, 0x26, 0x64, 0x0d, 0x19, 0x87, 0x0c, 0xc7, 0xea,
+    0xe5, 0x98, 0x10, 0xef, 0x4b, 0xef, 0x0f, 0xd4, 0xcd, 0x0c, 0x17, 0xd0, 0x8a, 0xfe, 0x50, 0xdd,
+    0x8a, 0x10, 0xbd, 0x7f, 0x5f, 0xe3, 0xfd, 0x79, 0x00, 0x25, 0x0c, 0x34, 0x8b, 0xfb, 0x0b, 0xfc,
+    0xbc, 0xdd, 0xb0, 0xa9, 0x76, 0xee, 0x0b, 0x9c, 0x5c, 0x0f, 0x3b, 0xea, 0x66, 0x2e, 0x66, 0xd0,
+    0x8a, 0xe1, 0xa1, 0xba, 0x15, 0x0b, 0x0f, 0x34, 0x6a, 0x78, 0xa4, 0xd6, 0xa8, 0x05, 0x0e, 0xde,
+    0xa1, 0x66, 0xf0, 0x2e, 0x7c, 0xe4, 0xa1, 0xab, 0xe1, 0x61, 0x09, 0x4e, 0x6d, 0xf8, 0x51, 0xed,
+    0xd4, 0xbe, 0xc7, 0xdb, 0x78, 0xdf, 0x6b, 0x5e, 0x3d, 0x44, 0x38, 0xc9, 0x1e, 0x69, 0x5e, 0x74,
+    0x45, 0x18, 0xba, 0x8f, 0x34, 0xa1, 0x7b, 0x94, 0x82, 0x24, 0x47, 0xa7, 0x6a, 0x49, 0x46, 0x57,
+    0x60, 0xab, 0x47, 0xe7, 0x6a, 0x5b, 0x2d, 0x3e, 0x7a, 0x32, 0xd6, 0x30, 0x19, 0xe3, 0x3c, 0x6b,
+    0xac, 0x99, 0x67, 0xc5, 0x0e, 0x96, 0xd0, 0xd2, 0x94, 0xe0, 0x82, 0xa0, 0xc6, 0x6d, 0xb5, 0xa0,
+    0x62, 0xfc, 0x3c, 0xd4, 0xb8, 0xa3, 0xee, 0xcd, 0x78, 0x86, 0x3c, 0x1c, 0x6a, 0x78, 0xc0, 0xee,
+    0x1e, 0x6b, 0xba, 0x3b, 0xc6, 0x69, 0xf5, 0x58, 0x33, 0xad, 0x8e, 0xf1, 0x13, 0xae, 0x63, 0xcd,
+    0x7b, 0x8a, 0x18, 0x8d, 0xf9, 0x58, 0x63, 0xcc, 0x63, 0x9c, 0x46, 0x8d, 0x35, 0xd3, 0xa8, 0xf8,
+    0x12, 0x66, 0x07, 0xe3, 0x33, 0xf5, 0xec, 0x20, 0x5e, 0x62, 0x2b, 0x3e, 0x6a, 0x5a, 0x71, 0x83,
+    0xad, 0xf8, 0xa4, 0x6e, 0x45, 0xe2, 0xd9, 0xf8, 0x0a, 0x44, 0xad, 0x0f, 0xc9, 0x67, 0x68, 0xe6,
+    0xe4, 0x9d, 0xba, 0x99, 0x49, 0x00, 0xb6, 0x7a, 0xa2, 0xd9, 0xe3, 0x96, 0xe0, 0x8c, 0x75, 0xa2,
+    0x99, 0xb1, 0x26, 0x68, 0xcc, 0x27, 0x1a, 0x63, 0x9e, 0xe0, 0x97, 0x06, 0x26, 0x23, 0x75, 0x0c,
+    0x93, 0x24, 0x58, 0xc5, 0x44, 0x53, 0x05, 0x86, 0x07, 0x13, 0x4d, 0x78, 0x90, 0xdc, 0x60, 0x33,
+    0x3f, 0xa9, 0x9b, 0x99, 0x12, 0xaf, 0xb6, 0x77, 0xda, 0x54, 0xaf, 0x6c, 0xa7, 0xb3, 0x6b, 0xc8,
+    0x70, 0xa8, 0x5e, 0xa9, 0x4f, 0x71, 0x6c, 0xea, 0x96, 0xfb, 0xd3, 0x25, 0xf8, 0xac, 0xd3, 0x8f,
+    0x6a, 0x9f, 0x95, 0x22, 0x93, 0xa7, 0x1a, 0x26, 0xc5, 0x9d, 0xa4, 0x67, 0x9a, 0x58, 0xee, 0x12,
+    0xfb, 0xe2, 0x4c, 0xd3, 0x17, 0x97, 0xe9, 0x25, 0x64, 0x38, 0x55, 0xbf, 0x8d, 0xb9, 0xc2, 0x7b,
+    0xd0, 0xce, 0x35, 0x9b, 0xc6, 0xaf, 0x09, 0x18, 0x90, 0x0f, 0x4d, 0xb5, 0x01, 0xb9, 0x76, 0x80,
+    0x87, 0x0f, 0x9a, 0x4d, 0xda, 0xd7, 0x1c, 0x4b, 0x18, 0x68, 0x4a, 0x58, 0x60, 0x86, 0xa1, 0x3a,
+    0xc3, 0x12, 0xaf, 0x31, 0xfa, 0xa8, 0xd9, 0x77, 0x76, 0x83, 0x46, 0xec, 0x93, 0xc6, 0x88, 0xdd,
+    0x04, 0x10, 0x70, 0x7e, 0xea, 0xa9, 0x03, 0xce, 0x9b, 0x2b, 0x18, 0x59, 0x9f, 0xce, 0xbb, 0xf7,
+    0xde, 0xb8, 0x57, 0x2c, 0x2c, 0xde, 0xbb, 0x6c, 0x98, 0x6f, 0x74, 0x5f, 0x73, 0xe1, 0x50, 0xae,
+    0x92, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d,
+    0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e,
+    0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f,
+    0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0x3e, 0x2f, 0x1d, 0xfe, 0xff, 0xb2, 0x74, 0xb8, 0x72,
+    0x06, 0xae, 0x97, 0xfa, 0x09, 0x5b, 0xf8, 0x8c, 0x46, 0xd9, 0xe6, 0x4c, 0xd3, 0x8a, 0x61, 0x50,
+    0x00, 0x6a, 0xf7, 0x1d, 0x73, 0xda, 0x54, 0x9f, 0x1e, 0xd8, 0x80, 0xa7, 0x1b, 0x9a, 0xc7, 0xe2,
+    0xb9, 0x36, 0x83, 0xcc, 0xa1, 0xcf, 0x92, 0xe5, 0x31, 0x64, 0xca, 0x73, 0x6d, 0x3c, 0xf5, 0xee,
+    0xec, 0x5c, 0x4c, 0xda, 0xfd, 0xd9, 0xf9, 0x06, 0xe0, 0xd5, 0x3d, 0xda, 0xeb, 0x6f, 0x9b, 0x7e,
+    0xf5, 0x24, 0xdb, 0xa6, 0xf1, 0x83, 0x08, 0x95, 0x0d, 0xd3, 0x0b, 0x67, 0x85, 0xe3, 0xf2, 0xab,
+    0x07, 0xba, 0x73, 0xb9, 0x0b, 0x67, 0xcd, 0x0d, 0xd2, 0x0b, 0xc7, 0xb8, 0x35, 0xfa, 0xdf, 0xff,
+    0x67, 0xbc, 0x83, 0x1c, 0xea, 0x7d, 0xf0, 0xbe, 0x68, 0x28, 0xfc, 0x9f, 0xff, 0x66, 0x47, 0x60,
+    0xc2, 0xc1, 0xaf, 0x4a, 0x19, 0xee, 0xbf, 0x1f, 0x9e, 0x5a, 0xa7, 0x31, 0x99, 0x3d, 0xfa, 0x52,
+    0xef, 0xdf, 0xfe, 0xa7, 0xb5, 0x58, 0x89, 0x88, 0xf1, 0x46, 0xef, 0x51, 0xb3, 0xf7, 0xf3, 0x58,
+    0xf9, 0xe1, 0x7f, 0xad, 0xc5, 0x8a, 0x2b, 0x96, 0x13, 0x0c, 0x37, 0x47, 0xe2, 0x6d, 0x26, 0x3f,
+    0x83, 0x99, 0x9f, 0xfe, 0xdb, 0x9f, 0xac, 0x75, 0x51, 0x30, 0xaa, 0x21, 0x4d, 0x8c, 0xdc, 0xf0,
+    0xab, 0xd0, 0xe7, 0xe4, 0xbe, 0xbb, 0xc5, 0xef, 0xfd, 0x74, 0xd3, 0x18, 0xbf, 0x27, 0xa4, 0x30,
+    0x9c, 0x0b, 0xe7, 0x02, 0x3f, 0x8e, 0x70, 0xef, 0x47, 0x9b, 0x44, 0x83, 0xad, 0x7d, 0x12, 0xc5,
+    0xba, 0x93, 0xa3, 0x47, 0x2c, 0x86, 0x51, 0xb8, 0xfc, 0xd6, 0xea, 0xe2, 0x55, 0x19, 0x0d, 0xab,
+    0xc7, 0xc2, 0x34, 0xd1, 0x7c, 0x0f, 0xb0, 0x71, 0x07, 0xb2, 0x61, 0xc4, 0x6c, 0xdd, 0xad, 0xe6,
+    0x88, 0xa7, 0x2b, 0x7c, 0xdd, 0x32, 0x8f, 0x7b, 0x63, 0x7a, 0x29, 0xae, 0x55, 0x19, 0xb6, 0x62,
+    0x75, 0xd3, 0x85, 0xb7, 0xb8, 0xb7, 0xed, 0x23, 0x9e, 0x90, 0x84, 0x5a, 0x13, 0x2f, 0xe2, 0xe9,
+    0xcc, 0xc3, 0x52, 0x74, 0x32, 0x68, 0xf1, 0xc0, 0x66, 0x21, 0xb5, 0x9a, 0xbe, 0x7f, 0x2b, 0xeb,
+    0x53, 0x58, 0x6d, 0xb0, 0x17, 0xf4, 0x82, 0x06, 0x8b, 0x64, 0x79, 0xdb, 0x0a, 0x1e, 0xc1, 0x13,
+    0x4b, 0x3c, 0xc9, 0x3e, 0xf9, 0xb4, 0xce, 0x27, 0xd5, 0xa4, 0x52, 0xb0, 0xd8, 0xa2, 0xd7, 0x8e,
+    0x9f, 0xba, 0xd4, 0xb5, 0xa6, 0x11, 0x0f, 0xac, 0x08, 0x5b, 0x8c, 0xcd, 0xba, 0xf2, 0xe0, 0x31,
+    0xde, 0x40, 0x4f, 0x31, 0x53, 0x28, 0xef, 0x1f, 0x78, 0xf1, 0xd0, 0xeb, 0x7e, 0x5f, 0x3f, 0x89,
+    0x13, 0xc8, 0xbe, 0x4a, 0x53, 0xf1, 0x03, 0x81, 0xa4, 0xdc, 0x72, 0x05, 0x48, 0x54, 0x7a, 0x01,
+    0x01, 0xf9, 0x7f, 0xf3, 0xc5, 0x94, 0x5f, 0xaf, 0x71, 0x36, 0xe5, 0x8a, 0xda, 0x75, 0xc1, 0x52,
+    0x3d, 0x06, 0x89, 0xa7, 0x71, 0xf1, 0xc1, 0xaf, 0x29, 0xb0, 0x58, 0x8f, 0xd9, 0x0d, 0xfd, 0x76,
+    0xf3, 0x45, 0x23, 0xa2, 0x46, 0x0b, 0x39, 0x16, 0xf0, 0xc7, 0x9a, 0xc7, 0x5f, 0xff, 0xf6, 0x21,
+    0xac, 0x62, 0x0f, 0x3c, 0x9a, 0x51, 0x71, 0x93, 0xc1, 0x63, 0xf9, 0xfc, 0xab, 0xbf, 0x7d, 0x08,
+    0x9f, 0x24, 0x4d, 0x3c, 0x1e, 0x3d, 0x9a, 0xd3, 0xa6, 0x80, 0x3f, 0xda, 0xe3, 0xfc, 0xd3, 0x83,
+    0x58, 0xf5, 0xed, 0x34, 0x78, 0x3c, 0xa7, 0x88, 0x7e, 0xe2, 0x4f, 0xd4, 0x54, 0x0c, 0xcd, 0xdd,
+    0x61, 0xf6, 0xcf, 0x6c, 0x6b, 0xb2, 0xc6, 0xd9, 0x69, 0x92, 0x00, 0x4e, 0xf2, 0x1f, 0xa7, 0x76,
+    0x80, 0x9f, 0x91, 0x10, 0xd6, 0x82, 0x5c, 0xd2, 0x7d, 0xf1, 0xb0, 0x66, 0xb9, 0xd9, 0x77, 0xf0,
+    0xb0, 0x4b, 0xfe, 0xd1, 0x1a, 0xe3, 0x67, 0x20, 0xe5, 0x9d, 0x67, 0x78, 0xff, 0xee, 0x52, 0x58,
+    0xe9, 0x31, 0x4d, 0x12, 0xbc, 0x0a, 0xf1, 0xcd, 0x4b, 0x59, 0x22, 0x7e, 0x2b, 0x90, 0x47, 0x01,
+    0xd6, 0x04, 0xad, 0x63, 0x8b, 0xc4, 0x8a, 0x23, 0xe7, 0x6d, 0xed, 0xa5, 0xfc, 0x7c, 0xd4, 0x1f,
+    0x5e, 0xbe, 0xdd, 0xb6, 0x6d, 0xfa, 0xca, 0xd9, 0x75, 0x36, 0x1b, 0x1b, 0xaf, 0x37, 0x37, 0xa7,
+    0xe2, 0x28, 0x95, 0xcc, 0x59, 0x9c, 0xa9, 0xb2, 0xb9, 0xbb, 0x84, 0x7f, 0x5e, 0x12, 0x80, 0x50,
+    0xfe, 0x2f, 0xdf, 0x85, 0xde, 0xe0, 0x54, 0xa9, 0x00, 0x00,
+};
+
+#define ASSET_INDEX_HTML_ETAG "ee96df2187196bdd"
+
+static const WebAsset WEB_ASSETS[] = {
+    { "/app.css", "text/css", "\"541f3ad0b0ce94bc\"", "public, max-age=31536000, immutable", ASSET_APP_CSS, sizeof(ASSET_APP_CSS) },
+    { "/app.js", "application/javascript", "\"4bbe6c8c120711fd\"", "public, max-age=31536000, immutable", ASSET_APP_JS, sizeof(ASSET_APP_JS) },
+    { "/", "text/html", "\"ee96df2187196bdd\"", "no-cache", ASSET_INDEX_HTML, sizeof(ASSET_INDEX_HTML) },
+};
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
+
+#endif
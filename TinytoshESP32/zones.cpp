@@ -1,200 +1,229 @@
+// Generated by tz/build_zones.py from tzdata 2025b and tz/zones.txt. Do not edit.
 #include "zones.h"
 
-const char* POSIX_TIMEZONE_MAP = R"(
-{
-  "Africa/Abidjan": "GMT0",
-  "Africa/Accra": "GMT0",
-  "Africa/Algiers": "CET-1",
-  "Africa/Bissau": "GMT0",
-  "Africa/Cairo": "EET-2",
-  "Africa/Casablanca": "WET0WEST,M3.5.0/2,M10.5.0/3",
-  "Africa/Ceuta": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Africa/El_Aaiun": "WET0WEST,M3.5.0/2,M10.5.0/3",
-  "Africa/Johannesburg": "SAST-2",
-  "Africa/Juba": "EAT-3",
-  "Africa/Khartoum": "CAT-2",
-  "Africa/Lagos": "WAT-1",
-  "Africa/Maputo": "CAT-2",
-  "Africa/Monrovia": "GMT0",
-  "Africa/Nairobi": "EAT-3",
-  "Africa/Ndjamena": "WAT-1",
-  "Africa/Sao_Tome": "GMT0",
-  "Africa/Tripoli": "EET-2",
-  "Africa/Tunis": "CET-1",
-  "Africa/Windhoek": "CAT-2",
-  "America/Adak": "HST10HDT,M3.2.0,M11.1.0",
-  "America/Anchorage": "AKST9AKDT,M3.2.0,M11.1.0",
-  "America/Araguaina": "BRT3",
-  "America/Argentina/Buenos_Aires": "ART3",
-  "America/Bogota": "COT5",
-  "America/Caracas": "VET4",
-  "America/Chicago": "CST6CDT,M3.2.0,M11.1.0",
-  "America/Denver": "MST7MDT,M3.2.0,M11.1.0",
-  "America/Edmonton": "MST7MDT,M3.2.0,M11.1.0",
-  "America/El_Salvador": "CST6",
-  "America/Godthab": "WGT3WGST,M3.5.0/-2,M10.5.0/-1",
-  "America/Guatemala": "CST6",
-  "America/Halifax": "AST4ADT,M3.2.0,M11.1.0",
-  "America/Havana": "CST5CDT,M3.2.0/0,M11.1.0/1",
-  "America/Jamaica": "EST5",
-  "America/La_Paz": "BOT4",
-  "America/Lima": "PET5",
-  "America/Los_Angeles": "PST8PDT,M3.2.0,M11.1.0",
-  "America/Mexico_City": "CST6",
-  "America/Montevideo": "UYT3",
-  "America/New_York": "EST5EDT,M3.2.0,M11.1.0",
-  "America/Phoenix": "MST7",
-  "America/Port-au-Prince": "EST5EDT,M3.2.0,M11.1.0",
-  "America/Puerto_Rico": "AST4",
-  "America/Santiago": "CLST3CLT,M9.1.6/23,M4.1.6/23",
-  "America/Sao_Paulo": "BRT3",
-  "America/St_Johns": "NST3:30NDT,M3.2.0,M11.1.0",
-  "America/Tijuana": "PST8PDT,M3.2.0,M11.1.0",
-  "America/Toronto": "EST5EDT,M3.2.0,M11.1.0",
-  "America/Vancouver": "PST8PDT,M3.2.0,M11.1.0",
-  "Antarctica/Palmer": "CLST3CLT,M9.1.6/23,M4.1.6/23",
-  "Asia/Almaty": "ALMT6",
-  "Asia/Amman": "EET-2EEST,M3.5.5/0,M10.5.5/1",
-  "Asia/Anadyr": "ANAT-12ANAT+1,M3.4.6,M10.4.6",
-  "Asia/Ashgabat": "TMT-5",
-  "Asia/Atyrau": "ORAT-5",
-  "Asia/Baghdad": "AST3",
-  "Asia/Baku": "AZT-4AZT+1,M3.4.6,M10.4.6",
-  "Asia/Bangkok": "ICT-7",
-  "Asia/Barnaul": "OMST-6",
-  "Asia/Beirut": "EET-2EEST,M3.5.0,M10.5.0/0",
-  "Asia/Bishkek": "KGT-6",
-  "Asia/Chita": "YAKT-8",
-  "Asia/Colombo": "IST-5:30",
-  "Asia/Damascus": "EET-2EEST,M3.5.5/0,M10.5.5/0",
-  "Asia/Dhaka": "BDT-6",
-  "Asia/Dubai": "GST-4",
-  "Asia/Dushanbe": "TJT-5",
-  "Asia/Famagusta": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Asia/Gaza": "EET-2EEST,M3.5.5/0,M10.5.5/1",
-  "Asia/Hong_Kong": "HKT-8",
-  "Asia/Hovd": "HOVT-7",
-  "Asia/Irkutsk": "IRKT-8",
-  "Asia/Jakarta": "WIB-7",
-  "Asia/Jayapura": "WIT-9",
-  "Asia/Jerusalem": "IST-2IDT,M3.4.4/26,M10.5.0/0",
-  "Asia/Kabul": "AFT-4:30",
-  "Asia/Kamchatka": "PETT-12",
-  "Asia/Karachi": "PKT-5",
-  "Asia/Kathmandu": "NPT-5:45",
-  "Asia/Kolkata": "IST-5:30",
-  "Asia/Krasnoyarsk": "KRAT-7",
-  "Asia/Kuala_Lumpur": "MYT-8",
-  "Asia/Magadan": "MAGT-11",
-  "Asia/Makassar": "WITA-8",
-  "Asia/Manila": "PST-8",
-  "Asia/Nicosia": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Asia/Novokuznetsk": "OMST-6",
-  "Asia/Novosibirsk": "NOVT-7",
-  "Asia/Omsk": "OMST-6",
-  "Asia/Oral": "ORAT-5",
-  "Asia/Pontianak": "WIB-7",
-  "Asia/Pyongyang": "KST-9",
-  "Asia/Qatar": "AST3",
-  "Asia/Riyadh": "AST3",
-  "Asia/Sakhalin": "SAKT-11",
-  "Asia/Samarkand": "UZT-5",
-  "Asia/Seoul": "KST-9",
-  "Asia/Shanghai": "CST-8",
-  "Asia/Singapore": "SGT-8",
-  "Asia/Srednekolymsk": "SRET-11",
-  "Asia/Taipei": "CST-8",
-  "Asia/Tashkent": "UZT-5",
-  "Asia/Tbilisi": "GET-4",
-  "Asia/Tehran": "IRST-3:30IRDT,M3.3.4/0,M9.3.6/0",
-  "Asia/Tel_Aviv": "IST-2IDT,M3.4.4/26,M10.5.0/0",
-  "Asia/Thimphu": "BTT-6",
-  "Asia/Tokyo": "JST-9",
-  "Asia/Tomsk": "KRAT-7",
-  "Asia/Ulaanbaatar": "ULAT-8",
-  "Asia/Urumqi": "CST-6",
-  "Asia/Vientiane": "ICT-7",
-  "Asia/Vladivostok": "VLAT-10",
-  "Asia/Yakutsk": "YAKT-9",
-  "Asia/Yangon": "MMT-6:30",
-  "Asia/Yekaterinburg": "YECT-5",
-  "Asia/Yerevan": "ART-4",
-  "Atlantic/Azores": "AZOT1AZOST,M3.5.0/0,M10.5.0/1",
-  "Atlantic/Canary": "WET0WEST,M3.5.0,M10.5.0/3",
-  "Atlantic/Cape_Verde": "CVT1",
-  "Atlantic/Madeira": "WET0WEST,M3.5.0,M10.5.0/3",
-  "Atlantic/Reykjavik": "GMT0",
-  "Australia/Adelaide": "ACST-9:30ACDT,M10.1.0,M4.1.0/3",
-  "Australia/Brisbane": "AEST-10",
-  "Australia/Broken_Hill": "ACST-9:30ACDT,M10.1.0,M4.1.0/3",
-  "Australia/Darwin": "ACST-9:30",
-  "Australia/Eucla": "CWST-8:45",
-  "Australia/Hobart": "AEST-10AEDT,M10.1.0,M4.1.0/3",
-  "Australia/Lord_Howe": "LHST-10:30LHDT,M10.1.0,M4.1.0",
-  "Australia/Perth": "AWST-8",
-  "Australia/Sydney": "AEST-10AEDT,M10.1.0,M4.1.0/3",
-  "Europe/Amsterdam": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Andorra": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Astrakhan": "SAMT-4",
-  "Europe/Athens": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Europe/Belgrade": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Berlin": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Brussels": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Bucharest": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Europe/Budapest": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Chisinau": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Europe/Copenhagen": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Dublin": "GMT0IST,M3.5.0/1,M10.5.0/2",
-  "Europe/Gibraltar": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Helsinki": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Europe/Istanbul": "TRT-3",
-  "Europe/Kaliningrad": "EET-2",
-  "Europe/Kiev": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Europe/Kirov": "MSK-3",
-  "Europe/Lisbon": "WET0WEST,M3.5.0/1,M10.5.0/2",
-  "Europe/London": "GMT0BST,M3.5.0/1,M10.5.0/2",
-  "Europe/Luxembourg": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Madrid": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Malta": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Minsk": "MSK-3",
-  "Europe/Monaco": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Moscow": "MSK-3",
-  "Europe/Oslo": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Paris": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Prague": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Riga": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Europe/Rome": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Samara": "SAMT-4",
-  "Europe/Saratov": "SAMT-4",
-  "Europe/Simferopol": "MSK-3",
-  "Europe/Sofia": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Europe/Stockholm": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Tallinn": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Europe/Tirane": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Ulyanovsk": "SAMT-4",
-  "Europe/Uzhgorod": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Europe/Vienna": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Vilnius": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Europe/Volgograd": "MSK-3",
-  "Europe/Warsaw": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Europe/Zaporozhye": "EET-2EEST,M3.5.0/3,M10.5.0/4",
-  "Europe/Zurich": "CET-1CEST,M3.5.0,M10.5.0/3",
-  "Indian/Maldives": "MVT-5",
-  "Indian/Mauritius": "MUT-4",
-  "Indian/Reunion": "RET-4",
-  "Pacific/Auckland": "NZST-12NZDT,M9.5.0/2,M4.1.0/3",
-  "Pacific/Chatham": "CHAST-12:45CHADT,M9.5.0/2:45,M4.1.0/3:45",
-  "Pacific/Easter": "EAST5EADT,M9.1.6/23,M4.1.6/22",
-  "Pacific/Fiji": "FJT-12FJST,M11.2.0,M1.2.0",
-  "Pacific/Honolulu": "HST10",
-  "Pacific/Kiritimati": "LINT-14",
-  "Pacific/Majuro": "MHT-12",
-  "Pacific/Midway": "SST11",
-  "Pacific/Noumea": "NCT-11",
-  "Pacific/Pago_Pago": "SST11",
-  "Pacific/Port_Moresby": "PGT-10",
-  "Pacific/Tarawa": "GILT-12",
-  "Pacific/Tongatapu": "TOT-13",
-  "Pacific/Wake": "WAKT-12"
+// Sorted by IANA name (byte order) so lookups can binary search; the
+// static_assert below rejects an out-of-order or duplicate entry at build time.
+constexpr TimezoneEntry TIMEZONES[] = {
+  {"Africa/Abidjan",                 "GMT0"},
+  {"Africa/Accra",                   "GMT0"},
+  {"Africa/Algiers",                 "CET-1"},
+  {"Africa/Bissau",                  "GMT0"},
+  {"Africa/Cairo",                   "EET-2EEST,M4.5.5/0,M10.5.4/24"},
+  {"Africa/Casablanca",              "<+01>-1"},
+  {"Africa/Ceuta",                   "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Africa/El_Aaiun",                "<+01>-1"},
+  {"Africa/Johannesburg",            "SAST-2"},
+  {"Africa/Juba",                    "CAT-2"},
+  {"Africa/Khartoum",                "CAT-2"},
+  {"Africa/Lagos",                   "WAT-1"},
+  {"Africa/Maputo",                  "CAT-2"},
+  {"Africa/Monrovia",                "GMT0"},
+  {"Africa/Nairobi",                 "EAT-3"},
+  {"Africa/Ndjamena",                "WAT-1"},
+  {"Africa/Sao_Tome",                "GMT0"},
+  {"Africa/Tripoli",                 "EET-2"},
+  {"Africa/Tunis",                   "CET-1"},
+  {"Africa/Windhoek",                "CAT-2"},
+  {"America/Adak",                   "HST10HDT,M3.2.0,M11.1.0"},
+  {"America/Anchorage",              "AKST9AKDT,M3.2.0,M11.1.0"},
+  {"America/Araguaina",              "<-03>3"},
+  {"America/Argentina/Buenos_Aires", "<-03>3"},
+  {"America/Bogota",                 "<-05>5"},
+  {"America/Caracas",                "<-04>4"},
+  {"America/Chicago",                "CST6CDT,M3.2.0,M11.1.0"},
+  {"America/Denver",                 "MST7MDT,M3.2.0,M11.1.0"},
+  {"America/Edmonton",               "MST7MDT,M3.2.0,M11.1.0"},
+  {"America/El_Salvador",            "CST6"},
+  {"America/Godthab",                "<-02>2<-01>,M3.5.0/-1,M10.5.0/0"},
+  {"America/Guatemala",              "CST6"},
+  {"America/Halifax",                "AST4ADT,M3.2.0,M11.1.0"},
+  {"America/Havana",                 "CST5CDT,M3.2.0/0,M11.1.0/1"},
+  {"America/Jamaica",                "EST5"},
+  {"America/La_Paz",                 "<-04>4"},
+  {"America/Lima",                   "<-05>5"},
+  {"America/Los_Angeles",            "PST8PDT,M3.2.0,M11.1.0"},
+  {"America/Mexico_City",            "CST6"},
+  {"America/Montevideo",             "<-03>3"},
+  {"America/New_York",               "EST5EDT,M3.2.0,M11.1.0"},
+  {"America/Phoenix",                "MST7"},
+  {"America/Port-au-Prince",         "EST5EDT,M3.2.0,M11.1.0"},
+  {"America/Puerto_Rico",            "AST4"},
+  {"America/Santiago",               "<-04>4<-03>,M9.1.6/24,M4.1.6/24"},
+  {"America/Sao_Paulo",              "<-03>3"},
+  {"America/St_Johns",               "NST3:30NDT,M3.2.0,M11.1.0"},
+  {"America/Tijuana",                "PST8PDT,M3.2.0,M11.1.0"},
+  {"America/Toronto",                "EST5EDT,M3.2.0,M11.1.0"},
+  {"America/Vancouver",              "PST8PDT,M3.2.0,M11.1.0"},
+  {"Antarctica/Palmer",              "<-03>3"},
+  {"Asia/Almaty",                    "<+05>-5"},
+  {"Asia/Amman",                     "<+03>-3"},
+  {"Asia/Anadyr",                    "<+12>-12"},
+  {"Asia/Ashgabat",                  "<+05>-5"},
+  {"Asia/Atyrau",                    "<+05>-5"},
+  {"Asia/Baghdad",                   "<+03>-3"},
+  {"Asia/Baku",                      "<+04>-4"},
+  {"Asia/Bangkok",                   "<+07>-7"},
+  {"Asia/Barnaul",                   "<+07>-7"},
+  {"Asia/Beirut",                    "EET-2EEST,M3.5.0/0,M10.5.0/0"},
+  {"Asia/Bishkek",                   "<+06>-6"},
+  {"Asia/Chita",                     "<+09>-9"},
+  {"Asia/Colombo",                   "<+0530>-5:30"},
+  {"Asia/Damascus",                  "<+03>-3"},
+  {"Asia/Dhaka",                     "<+06>-6"},
+  {"Asia/Dubai",                     "<+04>-4"},
+  {"Asia/Dushanbe",                  "<+05>-5"},
+  {"Asia/Famagusta",                 "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Asia/Gaza",                      "EET-2EEST,M3.4.4/50,M10.4.4/50"},
+  {"Asia/Hong_Kong",                 "HKT-8"},
+  {"Asia/Hovd",                      "<+07>-7"},
+  {"Asia/Irkutsk",                   "<+08>-8"},
+  {"Asia/Jakarta",                   "WIB-7"},
+  {"Asia/Jayapura",                  "WIT-9"},
+  {"Asia/Jerusalem",                 "IST-2IDT,M3.4.4/26,M10.5.0"},
+  {"Asia/Kabul",                     "<+0430>-4:30"},
+  {"Asia/Kamchatka",                 "<+12>-12"},
+  {"Asia/Karachi",                   "PKT-5"},
+  {"Asia/Kathmandu",                 "<+0545>-5:45"},
+  {"Asia/Kolkata",                   "IST-5:30"},
+  {"Asia/Krasnoyarsk",               "<+07>-7"},
+  {"Asia/Kuala_Lumpur",              "<+08>-8"},
+  {"Asia/Magadan",                   "<+11>-11"},
+  {"Asia/Makassar",                  "WITA-8"},
+  {"Asia/Manila",                    "PST-8"},
+  {"Asia/Nicosia",                   "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Asia/Novokuznetsk",              "<+07>-7"},
+  {"Asia/Novosibirsk",               "<+07>-7"},
+  {"Asia/Omsk",                      "<+06>-6"},
+  {"Asia/Oral",                      "<+05>-5"},
+  {"Asia/Pontianak",                 "WIB-7"},
+  {"Asia/Pyongyang",                 "KST-9"},
+  {"Asia/Qatar",                     "<+03>-3"},
+  {"Asia/Riyadh",                    "<+03>-3"},
+  {"Asia/Sakhalin",                  "<+11>-11"},
+  {"Asia/Samarkand",                 "<+05>-5"},
+  {"Asia/Seoul",                     "KST-9"},
+  {"Asia/Shanghai",                  "CST-8"},
+  {"Asia/Singapore",                 "<+08>-8"},
+  {"Asia/Srednekolymsk",             "<+11>-11"},
+  {"Asia/Taipei",                    "CST-8"},
+  {"Asia/Tashkent",                  "<+05>-5"},
+  {"Asia/Tbilisi",                   "<+04>-4"},
+  {"Asia/Tehran",                    "<+0330>-3:30"},
+  {"Asia/Tel_Aviv",                  "IST-2IDT,M3.4.4/26,M10.5.0"},
+  {"Asia/Thimphu",                   "<+06>-6"},
+  {"Asia/Tokyo",                     "JST-9"},
+  {"Asia/Tomsk",                     "<+07>-7"},
+  {"Asia/Ulaanbaatar",               "<+08>-8"},
+  {"Asia/Urumqi",                    "<+06>-6"},
+  {"Asia/Vientiane",                 "<+07>-7"},
+  {"Asia/Vladivostok",               "<+10>-10"},
+  {"Asia/Yakutsk",                   "<+09>-9"},
+  {"Asia/Yangon",                    "<+0630>-6:30"},
+  {"Asia/Yekaterinburg",             "<+05>-5"},
+  {"Asia/Yerevan",                   "<+04>-4"},
+  {"Atlantic/Azores",                "<-01>1<+00>,M3.5.0/0,M10.5.0/1"},
+  {"Atlantic/Canary",                "WET0WEST,M3.5.0/1,M10.5.0"},
+  {"Atlantic/Cape_Verde",            "<-01>1"},
+  {"Atlantic/Madeira",               "WET0WEST,M3.5.0/1,M10.5.0"},
+  {"Atlantic/Reykjavik",             "GMT0"},
+  {"Australia/Adelaide",             "ACST-9:30ACDT,M10.1.0,M4.1.0/3"},
+  {"Australia/Brisbane",             "AEST-10"},
+  {"Australia/Broken_Hill",          "ACST-9:30ACDT,M10.1.0,M4.1.0/3"},
+  {"Australia/Darwin",               "ACST-9:30"},
+  {"Australia/Eucla",                "<+0845>-8:45"},
+  {"Australia/Hobart",               "AEST-10AEDT,M10.1.0,M4.1.0/3"},
+  {"Australia/Lord_Howe",            "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0"},
+  {"Australia/Perth",                "AWST-8"},
+  {"Australia/Sydney",               "AEST-10AEDT,M10.1.0,M4.1.0/3"},
+  {"Europe/Amsterdam",               "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Andorra",                 "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Astrakhan",               "<+04>-4"},
+  {"Europe/Athens",                  "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Belgrade",                "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Berlin",                  "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Brussels",                "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Bucharest",               "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Budapest",                "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Chisinau",                "EET-2EEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Copenhagen",              "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Dublin",                  "IST-1GMT0,M10.5.0,M3.5.0/1"},
+  {"Europe/Gibraltar",               "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Helsinki",                "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Istanbul",                "<+03>-3"},
+  {"Europe/Kaliningrad",             "EET-2"},
+  {"Europe/Kiev",                    "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Kirov",                   "MSK-3"},
+  {"Europe/Lisbon",                  "WET0WEST,M3.5.0/1,M10.5.0"},
+  {"Europe/London",                  "GMT0BST,M3.5.0/1,M10.5.0"},
+  {"Europe/Luxembourg",              "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Madrid",                  "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Malta",                   "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Minsk",                   "<+03>-3"},
+  {"Europe/Monaco",                  "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Moscow",                  "MSK-3"},
+  {"Europe/Oslo",                    "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Paris",                   "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Prague",                  "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Riga",                    "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Rome",                    "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Samara",                  "<+04>-4"},
+  {"Europe/Saratov",                 "<+04>-4"},
+  {"Europe/Simferopol",              "MSK-3"},
+  {"Europe/Sofia",                   "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Stockholm",               "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Tallinn",                 "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Tirane",                  "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Ulyanovsk",               "<+04>-4"},
+  {"Europe/Uzhgorod",                "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Vienna",                  "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Vilnius",                 "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Volgograd",               "MSK-3"},
+  {"Europe/Warsaw",                  "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Europe/Zaporozhye",              "EET-2EEST,M3.5.0/3,M10.5.0/4"},
+  {"Europe/Zurich",                  "CET-1CEST,M3.5.0,M10.5.0/3"},
+  {"Indian/Maldives",                "<+05>-5"},
+  {"Indian/Mauritius",               "<+04>-4"},
+  {"Indian/Reunion",                 "<+04>-4"},
+  {"Pacific/Auckland",               "NZST-12NZDT,M9.5.0,M4.1.0/3"},
+  {"Pacific/Chatham",                "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45"},
+  {"Pacific/Easter",                 "<-06>6<-05>,M9.1.6/22,M4.1.6/22"},
+  {"Pacific/Fiji",                   "<+12>-12"},
+  {"Pacific/Honolulu",               "HST10"},
+  {"Pacific/Kiritimati",             "<+14>-14"},
+  {"Pacific/Majuro",                 "<+12>-12"},
+  {"Pacific/Midway",                 "SST11"},
+  {"Pacific/Noumea",                 "<+11>-11"},
+  {"Pacific/Pago_Pago",              "SST11"},
+  {"Pacific/Port_Moresby",           "<+10>-10"},
+  {"Pacific/Tarawa",                 "<+12>-12"},
+  {"Pacific/Tongatapu",              "<+13>-13"},
+  {"Pacific/Wake",                   "<+12>-12"}
+};
+
+constexpr size_t TIMEZONE_COUNT = sizeof(TIMEZONES) / sizeof(TIMEZONES[0]);
+
+static constexpr int compareZoneNames(const char* a, const char* b) {
+  while (*a && *a == *b) { a++; b++; }
+  return (unsigned char)*a - (unsigned char)*b;
+}
+
+static constexpr bool timezonesSorted() {
+  for (size_t i = 1; i < TIMEZONE_COUNT; i++) {
+    if (compareZoneNames(TIMEZONES[i - 1].iana, TIMEZONES[i].iana) >= 0) return false;
+  }
+  return true;
+}
+
+static_assert(timezonesSorted(), "TIMEZONES must be strictly sorted by IANA name");
+
+const char* findPosixTimezone(const char* iana) {
+  size_t lo = 0, hi = TIMEZONE_COUNT;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    int cmp = strcmp(TIMEZONES[mid].iana, iana);
+    if (cmp == 0) return TIMEZONES[mid].posix;
+    if (cmp < 0) lo = mid + 1;
+    else hi = mid;
+  }
+  return nullptr;
 }
-)";
\ No newline at end of file
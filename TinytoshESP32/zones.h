@@ -1,6 +1,18 @@
 #ifndef ZONES_H
 #define ZONES_H
 
-extern const char* POSIX_TIMEZONE_MAP; 
+#include <Arduino.h>
+
+struct TimezoneEntry {
+  const char* iana;
+  const char* posix;
+};
+
+// IANA -> POSIX TZ rules, sorted by IANA name and kept in flash
+extern const TimezoneEntry TIMEZONES[];
+extern const size_t TIMEZONE_COUNT;
+
+// Returns the POSIX rule for an IANA zone, or nullptr if the zone is unknown
+const char* findPosixTimezone(const char* iana);
 
 #endif
\ No newline at end of file
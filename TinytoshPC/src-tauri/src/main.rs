@@ -1,10 +1,11 @@
 #![cfg_attr(not(debug_assertions), windows_subsystem = "windows")]
 
 use std::thread;
-use std::time::Duration;
+use std::time::{Duration, Instant};
 use std::sync::Mutex; 
 use std::env; 
 use std::collections::HashMap;
+use std::net::UdpSocket;
 use tauri::menu::{Menu, MenuItem};
 use tauri::tray::{TrayIconBuilder, TrayIconEvent, MouseButton};
 use tauri::{Manager, WindowEvent, Size, LogicalSize}; 
@@ -24,7 +25,10 @@ use any_ascii::any_ascii;
 const LOOP_INTERVAL_MS: u64 = 1000;          // Base speed of the main background loop
 
 // Wi-Fi Telemetry & Connection
-const WIFI_THROTTLE_TICKS: i32 = 3;         // 3 ticks * 1000ms = 3 seconds. Prevents overloading the ESP32's sync web server
+const WIFI_THROTTLE_TICKS: i32 = 3;         // Samples go out over UDP every tick; the HTTP post doubles as the liveness/pairing check (and feeds older firmware)
+const UDP_TELEMETRY_PORT: u16 = 4211;       // Must match UdpTelemetryService::TELEMETRY_PORT on the ESP32
+const UDP_MULTICAST_GROUP: &str = "239.84.84.1"; // Used instead of unicast when several devices are on the network
+const TELEMETRY_KEYFRAME_TICKS: u32 = 10;   // Every Nth sample is sent in full so a lost delta heals within N seconds
 const MAX_WIFI_FAILURES: i32 = 6;           // Consecutive failed HTTP requests before dropping connection and rescanning
 const HTTP_REQUEST_TIMEOUT_MS: u64 = 500;   // Max time to wait for ESP32 to acknowledge the telemetry payload
 
@@ -37,11 +41,29 @@ const SERIAL_BAUD_RATE: u32 = 115_200;      // Communication speed. Must exactly
 const SERIAL_TIMEOUT_MS: u64 = 100;         // Max time to wait for a standard serial read/write operation
 const USB_SCAN_INTERVAL_TICKS: i32 = 2;     // How often to check for newly plugged in USB devices (2 ticks * 500ms = 1.0 second)
 
-// USB Serial Formatting (Buffer Safety)
+// USB Serial Formatting (Buffer Safety, line protocol only)
 const SERIAL_CHUNK_SIZE: usize = 64;        // Bytes sent per chunk to prevent overflowing the ESP32's hardware buffer
 const SERIAL_CHUNK_DELAY_MS: u64 = 5;       // Brief 5ms pause between chunks so ESP32 can process the incoming bytes
 const SERIAL_CMD_DELAY_MS: u64 = 150;       // Pause after a full command finishes before firing the next one
 const SERIAL_READ_BUFFER_SIZE: usize = 1024;// Max memory allocated to read incoming serial data from the ESP32
+const SERIAL_MAX_PENDING: usize = 65_536;   // Drop unframed input (log text) piling up beyond this
+
+// USB Serial Framing (see SerialFrame.h in the firmware)
+const FRAME_VERSION: u8 = 1;                // Protocol version offered in HELLO
+const SERIAL_FAST_BAUD_RATE: u32 = 921_600; // Requested in HELLO. Only UART bridge chips switch; native USB CDC answers 0 and ignores the rate
+const FRAME_HELLO_TIMEOUT_MS: u64 = 300;    // Older firmware never answers HELLO; after this the port stays on the line protocol
+const FRAME_HELLO_RETRY_SEC: u64 = 5;       // The line protocol re-offers HELLO this often, in case the device was still booting
+const FRAME_REPLY_TIMEOUT_MS: u64 = 1000;   // Max wait for the reply to a framed request
+const FRAME_CREDIT_TIMEOUT_MS: u64 = 200;   // Max wait for a credit before assuming it was lost and refilling the window
+
+const FRAME_HELLO: u8 = b'H';
+const FRAME_TELEMETRY: u8 = b'T';
+const FRAME_GET_UPDATE: u8 = b'G';
+const FRAME_SAVE_CFG: u8 = b'S';
+const FRAME_UPDATE: u8 = b'U';
+const FRAME_ACK: u8 = b'A';
+const FRAME_CREDIT: u8 = b'K';
+const FRAME_FEATURE_TELEMETRY_DELTA: u8 = 0x01; // HELLO reply feature bit: device applies delta telemetry
 
 // USB Settings Sync (UI Panel)
 const FETCH_CONFIG_MAX_RETRIES: i32 = 30;   // How many times to poll the serial buffer while waiting for the config JSON
@@ -63,12 +85,66 @@ struct AppState {
     discovered_wifi: Mutex<HashMap<String, String>>,
     target_wifi_ip: Mutex<String>,
     command_queue: Mutex<Vec<String>>,
-    serial_buffer: Mutex<String>,
+    serial_link: Mutex<SerialLink>,
     latest_config: Mutex<String>,
+    device_state: Mutex<serde_json::Map<String, serde_json::Value>>,
+    device_cursor: Mutex<Option<DeviceCursor>>,
     user_forced_wifi: Mutex<bool>,
     media_info: Mutex<MediaStats>,
 }
 
+#[derive(Default, Clone, Copy, PartialEq)]
+enum LinkMode {
+    #[default]
+    Unknown,
+    Framed,
+    Lines,
+}
+
+// Per-port protocol state. Always locked after `port`.
+#[derive(Default)]
+struct SerialLink {
+    mode: LinkMode,
+    window: u8,
+    credits: u8,
+    max_frame: usize,
+    delta_ok: bool,
+    next_id: u8,
+    last_hello: Option<Instant>,
+    rx: Vec<u8>,
+}
+
+// Turns successive samples into keyframes and deltas. A delta ("delta":1) holds pc_id plus
+// the fields that changed since the previous sample; the device keeps the rest.
+#[derive(Default)]
+struct TelemetryEncoder {
+    last: serde_json::Map<String, serde_json::Value>,
+    since_keyframe: u32,
+}
+
+impl TelemetryEncoder {
+    fn encode(&mut self, sample: &serde_json::Map<String, serde_json::Value>, delta_ok: bool) -> String {
+        self.since_keyframe += 1;
+        let keyframe = !delta_ok || self.last.is_empty() || self.since_keyframe >= TELEMETRY_KEYFRAME_TICKS;
+
+        let out = if keyframe {
+            self.since_keyframe = 0;
+            sample.clone()
+        } else {
+            let mut delta = serde_json::Map::new();
+            delta.insert("delta".to_string(), 1.into());
+            for (key, value) in sample {
+                if key == "pc_id" || self.last.get(key) != Some(value) {
+                    delta.insert(key.clone(), value.clone());
+                }
+            }
+            delta
+        };
+        self.last = sample.clone();
+        serde_json::Value::Object(out).to_string()
+    }
+}
+
 #[derive(serde::Serialize, Clone, Default)]
 struct MediaStats {
     media_status: String,
@@ -99,6 +175,210 @@ struct PortStatus {
 
 // Functions 
 
+// Framed Serial Protocol
+
+fn crc16(data: &[u8]) -> u16 {
+    let mut crc: u16 = 0xFFFF;
+    for &b in data {
+        crc ^= (b as u16) << 8;
+        for _ in 0..8 {
+            crc = if crc & 0x8000 != 0 { (crc << 1) ^ 0x1021 } else { crc << 1 };
+        }
+    }
+    crc
+}
+
+// 0x00, COBS(kind, id, payload, crc16 LE), 0x00
+fn encode_frame(kind: u8, id: u8, payload: &[u8]) -> Vec<u8> {
+    let mut raw = Vec::with_capacity(payload.len() + 4);
+    raw.push(kind);
+    raw.push(id);
+    raw.extend_from_slice(payload);
+    let crc = crc16(&raw);
+    raw.extend_from_slice(&crc.to_le_bytes());
+
+    let mut out = Vec::with_capacity(raw.len() + raw.len() / 254 + 3);
+    out.push(0);
+    let mut code_pos = out.len();
+    out.push(0);
+    let mut code: u8 = 1;
+    for &b in &raw {
+        if b != 0 {
+            out.push(b);
+            code += 1;
+            if code < 0xFF { continue; }
+        }
+        out[code_pos] = code;
+        code_pos = out.len();
+        out.push(0);
+        code = 1;
+    }
+    out[code_pos] = code;
+    out.push(0);
+    out
+}
+
+fn decode_frame(encoded: &[u8]) -> Option<(u8, u8, Vec<u8>)> {
+    let mut raw = Vec::with_capacity(encoded.len());
+    let mut i = 0;
+    while i < encoded.len() {
+        let code = encoded[i] as usize;
+        if code == 0 || i + code > encoded.len() { return None; }
+        raw.extend_from_slice(&encoded[i + 1..i + code]);
+        i += code;
+        if code < 0xFF && i < encoded.len() { raw.push(0); }
+    }
+    if raw.len() < 4 { return None; }
+    let (body, crc) = raw.split_at(raw.len() - 2);
+    if crc16(body) != u16::from_le_bytes([crc[0], crc[1]]) { return None; }
+    Some((body[0], body[1], body[2..].to_vec()))
+}
+
+// One read from the port. Returns None when nothing arrived before the port timeout,
+// otherwise the framed replies completed by this read. Credits and legacy lines are
+// handled here; anything between delimiters that fails to decode is device log text.
+fn read_serial(state: &AppState, port: &mut Box<dyn SerialPort>, link: &mut SerialLink) -> Option<Vec<(u8, u8, Vec<u8>)>> {
+    let mut temp_buf = [0u8; SERIAL_READ_BUFFER_SIZE];
+    match port.read(&mut temp_buf) {
+        Ok(bytes_read) if bytes_read > 0 => link.rx.extend_from_slice(&temp_buf[..bytes_read]),
+        _ => return None,
+    }
+
+    let mut replies = Vec::new();
+    if link.mode == LinkMode::Lines {
+        loop {
+            let newline = link.rx.iter().position(|&b| b == b'\n');
+            let delimiter = link.rx.iter().position(|&b| b == 0);
+            match (newline, delimiter) {
+                // A frame opening before the line ends is a late HELLO reply, whose bytes may include '\n'
+                (_, Some(open)) if newline.map_or(true, |pos| open < pos) => {
+                    let Some(length) = link.rx[open + 1..].iter().position(|&b| b == 0) else { break };
+                    let close = open + 1 + length;
+                    let frame = decode_frame(&link.rx[open + 1..close]);
+                    link.rx.drain(..=close);
+                    replies.extend(frame);
+                }
+                (Some(pos), _) => {
+                    let line: Vec<u8> = link.rx.drain(..=pos).collect();
+                    let line = String::from_utf8_lossy(&line);
+                    if let Some(payload) = line.trim().strip_prefix("SYS_UPDATE:") {
+                        if let Some(merged) = merge_device_update(state, payload) {
+                            *state.latest_config.lock().unwrap() = merged;
+                        }
+                    }
+                }
+                _ => break,
+            }
+        }
+    } else {
+        while let Some(pos) = link.rx.iter().position(|&b| b == 0) {
+            let chunk: Vec<u8> = link.rx.drain(..=pos).collect();
+            match decode_frame(&chunk[..pos]) {
+                Some((FRAME_CREDIT, _, data)) => {
+                    let returned = data.first().copied().unwrap_or(0);
+                    link.credits = link.credits.saturating_add(returned).min(link.window);
+                }
+                Some(frame) => replies.push(frame),
+                None => {}
+            }
+        }
+    }
+    if link.rx.len() > SERIAL_MAX_PENDING { link.rx.clear(); }
+
+    // A reply to any HELLO we offered switches the link over, however late it comes. The
+    // first one counts: a device that queued several may change baud right after it.
+    if link.mode != LinkMode::Framed {
+        let hello = replies.iter().position(|(kind, _, data)| *kind == FRAME_HELLO && data.len() >= 8);
+        if let Some(pos) = hello {
+            let (_, _, data) = replies.remove(pos);
+            accept_hello(port, link, &data);
+        }
+    }
+    Some(replies)
+}
+
+// Sends one frame once the device has room for it and returns its request id
+fn send_frame(state: &AppState, port: &mut Box<dyn SerialPort>, link: &mut SerialLink, kind: u8, payload: &[u8]) -> Result<u8, String> {
+    if payload.len() + 4 > link.max_frame { return Err("Payload too large".into()); }
+
+    let start = Instant::now();
+    while link.credits == 0 && start.elapsed() < Duration::from_millis(FRAME_CREDIT_TIMEOUT_MS) {
+        read_serial(state, port, link);
+    }
+    if link.credits == 0 { link.credits = link.window; }
+
+    link.next_id = link.next_id.wrapping_add(1).max(1);
+    let id = link.next_id;
+    port.write_all(&encode_frame(kind, id, payload)).map_err(|e| e.to_string())?;
+    link.credits -= 1;
+    Ok(id)
+}
+
+// Sends HELLO outside the credit window; the device returns no credit for it.
+// Older firmware reads the bytes as one bad line once the caller ends it with '\n'.
+fn offer_hello(port: &mut Box<dyn SerialPort>, link: &mut SerialLink) {
+    let mut hello = vec![FRAME_VERSION];
+    hello.extend_from_slice(&SERIAL_FAST_BAUD_RATE.to_le_bytes());
+    link.next_id = link.next_id.wrapping_add(1).max(1);
+    link.last_hello = Some(Instant::now());
+    let _ = port.write_all(&encode_frame(FRAME_HELLO, link.next_id, &hello));
+}
+
+fn accept_hello(port: &mut Box<dyn SerialPort>, link: &mut SerialLink, data: &[u8]) {
+    link.mode = LinkMode::Framed;
+    link.window = data[1].max(1);
+    link.credits = link.window;
+    link.max_frame = u16::from_le_bytes([data[2], data[3]]) as usize;
+    link.delta_ok = data.get(8).map_or(false, |features| features & FRAME_FEATURE_TELEMETRY_DELTA != 0);
+    let baud = u32::from_le_bytes([data[4], data[5], data[6], data[7]]);
+    if baud != 0 { let _ = port.set_baud_rate(baud); }
+}
+
+// Offers the framed protocol. Firmware that answers HELLO switches over; anything else
+// stays on the line protocol, where the HELLO is re-offered every FRAME_HELLO_RETRY_SEC
+// and a late reply still switches the link over (read_serial).
+fn negotiate_serial_link(state: &AppState, port: &mut Box<dyn SerialPort>, link: &mut SerialLink) {
+    *link = SerialLink { window: 1, credits: 1, max_frame: 64, ..SerialLink::default() };
+
+    offer_hello(port, link);
+    let start = Instant::now();
+    while link.mode != LinkMode::Framed && start.elapsed() < Duration::from_millis(FRAME_HELLO_TIMEOUT_MS) {
+        read_serial(state, port, link);
+    }
+    if link.mode == LinkMode::Framed { return; }
+
+    let _ = port.write(b"\n");
+    link.mode = LinkMode::Lines;
+    link.rx.clear();
+}
+
+fn retry_serial_hello(port: &mut Box<dyn SerialPort>, link: &mut SerialLink) {
+    let due = link.last_hello.map_or(true, |sent| sent.elapsed() >= Duration::from_secs(FRAME_HELLO_RETRY_SEC));
+    if link.mode != LinkMode::Lines || !due { return; }
+    offer_hello(port, link);
+    let _ = port.write(b"\n");
+}
+
+fn serial_link_framed(state: &AppState) -> bool {
+    state.serial_link.lock().unwrap().mode == LinkMode::Framed
+}
+
+// Sends a framed request and waits for the reply carrying the same request id
+fn serial_request(state: &AppState, kind: u8, payload: &[u8], reply_kind: u8) -> Result<Vec<u8>, String> {
+    let mut port_guard = state.port.lock().unwrap();
+    let port = port_guard.as_mut().ok_or("Not connected")?;
+    let mut link = state.serial_link.lock().unwrap();
+    let id = send_frame(state, port, &mut link, kind, payload)?;
+
+    let start = Instant::now();
+    while start.elapsed() < Duration::from_millis(FRAME_REPLY_TIMEOUT_MS) {
+        for (reply, reply_id, data) in read_serial(state, port, &mut link).unwrap_or_default() {
+            if reply == reply_kind && reply_id == id { return Ok(data); }
+        }
+    }
+    Err("Serial timeout".into())
+}
+
 #[tauri::command]
 fn set_autostart(app: tauri::AppHandle, enable: bool) -> Result<(), String> {
     let autostart_manager = app.autolaunch();
@@ -190,6 +470,7 @@ async fn toggle_connection(state: tauri::State<'_, AppState>, port_name: String,
     match serialport::new(actual_port, SERIAL_BAUD_RATE).timeout(Duration::from_millis(SERIAL_TIMEOUT_MS)).open() {
         Ok(p) => {
             *port_guard = Some(p);
+            *state.serial_link.lock().unwrap() = SerialLink::default();
             *name_guard = port_name;
             *manual_guard = false;
             *forced_wifi = false; 
@@ -204,6 +485,45 @@ async fn toggle_connection(state: tauri::State<'_, AppState>, port_name: String,
     }
 }
 
+// Position in the device's state history: revisions restart every boot, so they
+// only compare within the boot id the device stamped them with.
+#[derive(Clone, Copy, PartialEq)]
+struct DeviceCursor {
+    rev: u32,
+    boot: u32,
+}
+
+// Merges a device state reply into the local copy and returns the full state as JSON.
+// Replies to a cursor hold only the keys changed since it (null = removed); a new
+// boot id means the device rebooted and sent everything.
+fn merge_device_update(state: &AppState, payload: &str) -> Option<String> {
+    let update: serde_json::Value = serde_json::from_str(payload).ok()?;
+    let update = update.as_object()?;
+    let field = |key: &str| update.get(key).and_then(|v| v.as_u64()).map(|v| v as u32);
+    let reply = match (field("rev"), field("boot")) {
+        (Some(rev), Some(boot)) => Some(DeviceCursor { rev, boot }),
+        _ => None,
+    };
+
+    let mut cursor = state.device_cursor.lock().unwrap();
+    let mut merged = state.device_state.lock().unwrap();
+    let full = match (*cursor, reply) {
+        (Some(old), Some(new)) => new.boot != old.boot,
+        _ => true,
+    };
+    if full { merged.clear(); }
+
+    for (key, value) in update {
+        if value.is_null() { merged.remove(key); } else { merged.insert(key.clone(), value.clone()); }
+    }
+    *cursor = reply;
+    Some(serde_json::Value::Object(merged.clone()).to_string())
+}
+
+fn cached_device_state(state: &AppState) -> String {
+    serde_json::Value::Object(state.device_state.lock().unwrap().clone()).to_string()
+}
+
 #[tauri::command]
 async fn fetch_device_data(state: tauri::State<'_, AppState>) -> Result<String, String> {
     let active = state.active_port_name.lock().unwrap().clone();
@@ -211,16 +531,34 @@ async fn fetch_device_data(state: tauri::State<'_, AppState>) -> Result<String,
     if active.starts_with("WiFi:") {
         let ip = state.target_wifi_ip.lock().unwrap().clone();
         if ip.is_empty() { return Err("No IP".into()); }
-        let url = format!("http://{}/update", ip);
+        let url = match *state.device_cursor.lock().unwrap() {
+            Some(c) => format!("http://{}/update?since={}&boot={}", ip, c.rev, c.boot),
+            None => format!("http://{}/update", ip),
+        };
         
         let agent = ureq::builder().timeout(Duration::from_secs(FETCH_CONFIG_TIMEOUT_SEC)).build();
         match agent.get(&url).call() {
-            Ok(response) => response.into_string().map_err(|e| e.to_string()),
+            Ok(response) if response.status() == 304 => Ok(cached_device_state(&state)),
+            Ok(response) => {
+                let body = response.into_string().map_err(|e| e.to_string())?;
+                merge_device_update(&state, &body).ok_or_else(|| "Invalid device state".to_string())
+            }
             Err(e) => Err(e.to_string())
         }
+    } else if active.starts_with("Serial:") && serial_link_framed(&state) {
+        let since = match *state.device_cursor.lock().unwrap() {
+            Some(c) => [c.rev.to_le_bytes(), c.boot.to_le_bytes()].concat(),
+            None => Vec::new(),
+        };
+        let reply = serial_request(&state, FRAME_GET_UPDATE, &since, FRAME_UPDATE)?;
+        merge_device_update(&state, &String::from_utf8_lossy(&reply)).ok_or_else(|| "Invalid device state".to_string())
     } else if active.starts_with("Serial:") {
         state.latest_config.lock().unwrap().clear();
-        state.command_queue.lock().unwrap().push("GET_UPDATE\n".to_string());
+        let command = match *state.device_cursor.lock().unwrap() {
+            Some(c) => format!("GET_UPDATE:{}:{}\n", c.rev, c.boot),
+            None => "GET_UPDATE\n".to_string(),
+        };
+        state.command_queue.lock().unwrap().push(command);
         
         for _ in 0..FETCH_CONFIG_MAX_RETRIES {
             let cfg = state.latest_config.lock().unwrap().clone();
@@ -247,6 +585,11 @@ async fn save_device_settings(state: tauri::State<'_, AppState>, query: String,
             Ok(_) => Ok("Success".into()),
             Err(e) => Err(e.to_string())
         }
+    } else if active.starts_with("Serial:") && serial_link_framed(&state) {
+        match serial_request(&state, FRAME_SAVE_CFG, json_payload.as_bytes(), FRAME_ACK)?.first() {
+            Some(1) => Ok("Saved via Serial".into()),
+            _ => Err("Device rejected the settings".into()),
+        }
     } else if active.starts_with("Serial:") {
         state.command_queue.lock().unwrap().push(format!("SAVE_CFG:{}\n", json_payload));
         Ok("Sent via Serial".into())
@@ -272,8 +615,10 @@ fn main() {
         discovered_wifi: Mutex::new(HashMap::new()),
         target_wifi_ip: Mutex::new(String::new()),
         command_queue: Mutex::new(Vec::new()),
-        serial_buffer: Mutex::new(String::new()),
+        serial_link: Mutex::new(SerialLink::default()),
         latest_config: Mutex::new(String::new()),
+        device_state: Mutex::new(serde_json::Map::new()),
+        device_cursor: Mutex::new(None),
         user_forced_wifi: Mutex::new(false),
         media_info: Mutex::new(MediaStats::default()),
     };
@@ -472,6 +817,12 @@ fn main() {
                 let mut background_scanning = false;
                 let mut previous_target = String::new();
                 let mut wifi_tick = 0;
+                let udp_socket = UdpSocket::bind("0.0.0.0:0").ok();
+                if let Some(sock) = &udp_socket { let _ = sock.set_multicast_ttl_v4(1); }
+                let mut udp_seq: u32 = 0;
+                let mut serial_telemetry = TelemetryEncoder::default();
+                let mut wifi_telemetry = TelemetryEncoder::default();
+                let mut wifi_delta_ip = String::new();
                 
                 let agent = ureq::builder()
                     .timeout_connect(Duration::from_millis(HTTP_REQUEST_TIMEOUT_MS))
@@ -508,8 +859,11 @@ fn main() {
                         media: media_data
                     };
                     
-                    let payload = serde_json::to_string(&data).unwrap_or("{}".to_string());
-                    if let Ok(mut stats_lock) = state.stats.lock() { *stats_lock = payload.clone(); }
+                    let sample = match serde_json::to_value(&data) {
+                        Ok(serde_json::Value::Object(map)) => map,
+                        _ => serde_json::Map::new(),
+                    };
+                    if let Ok(mut stats_lock) = state.stats.lock() { *stats_lock = serde_json::Value::Object(sample.clone()).to_string(); }
 
                     let manual_disconnect = *state.manual_disconnect.lock().unwrap();
                     let mut user_forced_wifi = *state.user_forced_wifi.lock().unwrap();
@@ -547,6 +901,7 @@ fn main() {
                                 if let Ok(p) = serialport::new(target_port.clone(), SERIAL_BAUD_RATE).timeout(Duration::from_millis(SERIAL_TIMEOUT_MS)).open() {
                                     let mut port_guard = state.port.lock().unwrap();
                                     *port_guard = Some(p);
+                                    *state.serial_link.lock().unwrap() = SerialLink::default();
                                     *state.active_port_name.lock().unwrap() = format!("Serial: {}", target_port);
                                     is_port_open = true;
                                 }
@@ -559,39 +914,43 @@ fn main() {
                     if is_port_open {
                         let mut port_guard = state.port.lock().unwrap();
                         if let Some(port) = port_guard.as_mut() {
+                            let mut link = state.serial_link.lock().unwrap();
+                            if link.mode == LinkMode::Unknown {
+                                negotiate_serial_link(&state, port, &mut link);
+                                serial_telemetry = TelemetryEncoder::default();
+                            } else {
+                                retry_serial_hello(port, &mut link);
+                            }
+                            let payload = serial_telemetry.encode(&sample, link.delta_ok);
+
                             let mut cmds = state.command_queue.lock().unwrap();
-                            let has_cmds = !cmds.is_empty();
-                            for cmd in cmds.iter() {
-                                for chunk in cmd.as_bytes().chunks(SERIAL_CHUNK_SIZE) {
-                                    let _ = port.write(chunk);
-                                    thread::sleep(Duration::from_millis(SERIAL_CHUNK_DELAY_MS)); 
+                            let written = if link.mode == LinkMode::Framed {
+                                // Framed requests are sent straight from the UI commands
+                                cmds.clear();
+                                drop(cmds);
+                                send_frame(&state, port, &mut link, FRAME_TELEMETRY, payload.as_bytes()).is_ok()
+                            } else {
+                                let has_cmds = !cmds.is_empty();
+                                for cmd in cmds.iter() {
+                                    for chunk in cmd.as_bytes().chunks(SERIAL_CHUNK_SIZE) {
+                                        let _ = port.write(chunk);
+                                        thread::sleep(Duration::from_millis(SERIAL_CHUNK_DELAY_MS)); 
+                                    }
                                 }
-                            }
-                            cmds.clear();
-                            if has_cmds { thread::sleep(Duration::from_millis(SERIAL_CMD_DELAY_MS)); }
+                                cmds.clear();
+                                drop(cmds);
+                                if has_cmds { thread::sleep(Duration::from_millis(SERIAL_CMD_DELAY_MS)); }
+                                port.write(format!("{}\n", payload).as_bytes()).is_ok()
+                            };
 
-                            if port.write(format!("{}\n", payload).as_bytes()).is_ok() {
+                            if written {
                                 sent_via_serial = true;
                                 scan_counter = 0; 
                                 wifi_failures = 0; 
                                 *state.status_msg.lock().unwrap() = "🔌 Connected via USB".to_string();
                                 *state.target_wifi_ip.lock().unwrap() = String::new(); 
                                 
-                                let mut temp_buf: Vec<u8> = vec![0; SERIAL_READ_BUFFER_SIZE];
-                                while let Ok(bytes_read) = port.read(&mut temp_buf) {
-                                    if bytes_read == 0 { break; }
-                                    let incoming = String::from_utf8_lossy(&temp_buf[..bytes_read]);
-                                    state.serial_buffer.lock().unwrap().push_str(&incoming);
-                                }
-
-                                let mut buf_guard = state.serial_buffer.lock().unwrap();
-                                while let Some(pos) = buf_guard.find('\n') {
-                                    let line = buf_guard[..pos].trim().to_string();
-                                    *buf_guard = buf_guard[pos + 1..].to_string();
-                                    if line.starts_with("SYS_UPDATE:") {
-                                        *state.latest_config.lock().unwrap() = line.replace("SYS_UPDATE:", "");
-                                    }
-                                }
+                                while read_serial(&state, port, &mut link).is_some() {}
                             } else {
                                 *port_guard = None;
                                 is_port_open = false; 
@@ -607,6 +966,8 @@ fn main() {
                     }
 
                     // 4. WI-FI COMMUNICATION
+                    // The device moved on while USB fed it, so Wi-Fi deltas restart from a keyframe
+                    if sent_via_serial { wifi_telemetry = TelemetryEncoder::default(); }
                     if !sent_via_serial && !manual_disconnect {
                         let mut target_ip = state.target_wifi_ip.lock().unwrap().clone();
                         
@@ -626,6 +987,22 @@ fn main() {
                         }
                         
                         if !target_ip.is_empty() {
+                            // Deltas only go to a device that said it takes them, and never over
+                            // multicast, where other units may run older firmware
+                            let multicast = state.discovered_wifi.lock().unwrap().len() > 1;
+                            let payload = wifi_telemetry.encode(&sample, wifi_delta_ip == target_ip && !multicast);
+
+                            if let Some(sock) = &udp_socket {
+                                udp_seq = udp_seq.wrapping_add(1);
+                                let mut datagram = Vec::with_capacity(payload.len() + 8);
+                                datagram.extend_from_slice(b"TTLM");
+                                datagram.extend_from_slice(&udp_seq.to_le_bytes());
+                                datagram.extend_from_slice(payload.as_bytes());
+
+                                let dest_ip = if multicast { UDP_MULTICAST_GROUP.to_string() } else { target_ip.clone() };
+                                let _ = sock.send_to(&datagram, format!("{}:{}", dest_ip, UDP_TELEMETRY_PORT));
+                            }
+
                             wifi_tick += 1;
 
                             if wifi_tick >= WIFI_THROTTLE_TICKS {
@@ -635,9 +1012,10 @@ fn main() {
                                 
                                 match agent.post(&url)
                                     .set("Content-Type", "application/json")
-                                    .set("Connection", "close")
                                     .send_string(&payload) {
-                                    Ok(_) => {
+                                    Ok(response) => {
+                                        let body = response.into_string().unwrap_or_default();
+                                        wifi_delta_ip = if body.contains("\"delta\":1") { target_ip.clone() } else { String::new() };
                                         wifi_failures = 0; 
                                         background_scanning = false;
                                         let wifi_map = state.discovered_wifi.lock().unwrap();
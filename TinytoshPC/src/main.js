@@ -581,9 +581,11 @@ async function fetchDeviceData() {
             setCb('showStock', d.show_stock);
             setVal('stock_symbol', d.stock_symbol);
             setCb('stock_fn', d.stock_fn, true);
+            setCb('stock_chart', d.stock_chart, true);
             setCb('showCrypto', d.show_crypto);
             setVal('crypto_id', d.crypto_id);
             setCb('crypto_fn', d.crypto_fn, true);
+            setCb('crypto_chart', d.crypto_chart, true);
             setCb('showCurrency', d.show_currency);
             setVal('currency_base', d.currency_base);
             setVal('currency_target', d.currency_target);
@@ -592,6 +594,8 @@ async function fetchDeviceData() {
             setCb('showMedia', d.show_media);
             setCb('hide_empty_pc', d.hide_empty_pc, true);
             setCb('hide_empty_media', d.hide_empty_media, true);
+            setVal('pc_multi', d.pc_multi);
+            setVal('pc_view', d.pc_view);
 
             if (d.anim_mask !== undefined) {
                 const mask = d.anim_mask;